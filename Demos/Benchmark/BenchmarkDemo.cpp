@@ -73,7 +73,9 @@ void PrintUsage(const std::string& executableName)
         << "\t--simulation-duration\tSets the simulation duration (virtual time) to SECONDS. Default: 1s" << std::endl
         << "\t--configuration\tPath and filename of the participant configuration YAML or JSON file. Default: empty"
         << std::endl
-        << "\t--write-csv\tPath and filename of csv file with benchmark results. Default: empty" << std::endl;
+        << "\t--write-csv\tPath and filename of csv file with benchmark results. Default: empty" << std::endl
+        << "\t--loan-buffers\tFill loaned buffers of the publishers in place instead of publishing copies of the data."
+        << std::endl;
 }
 
 struct BenchmarkConfig
@@ -86,6 +88,7 @@ struct BenchmarkConfig
     std::string registryUri = "silkit://localhost:0";
     std::string silKitConfigPath = "";
     std::string writeCsv = "";
+    bool loanBuffers = false;
 };
 
 bool Parse(int argc, char** argv, BenchmarkConfig& config)
@@ -113,6 +116,7 @@ bool Parse(int argc, char** argv, BenchmarkConfig& config)
         PrintUsage(argv[0]);
         return false;
     }
+    config.loanBuffers = consumeFlag("--loan-buffers");
 
     // Some more human-readable shortcuts for the options.
     // Consume a named option and return its argument,
@@ -265,12 +269,21 @@ uint32_t relateParticipant(uint32_t idx, uint32_t numberOfParticipants)
     }
 }
 
-void PublishMessages(IDataPublisher* publisher, uint32_t messageCount, uint32_t messageSizeInBytes)
+void PublishMessages(IDataPublisher* publisher, uint32_t messageCount, uint32_t messageSizeInBytes, bool loanBuffers)
 {
     for (uint32_t i = 0; i < messageCount; i++)
     {
-        std::vector<uint8_t> data(messageSizeInBytes, '*');
-        publisher->Publish(std::move(data));
+        if (loanBuffers)
+        {
+            auto data = publisher->Loan(messageSizeInBytes);
+            std::fill(data.begin(), data.end(), static_cast<uint8_t>('*'));
+            publisher->Commit();
+        }
+        else
+        {
+            std::vector<uint8_t> data(messageSizeInBytes, '*');
+            publisher->Publish(std::move(data));
+        }
     }
 }
 
@@ -316,7 +329,7 @@ void ParticipantsThread(std::shared_ptr<SilKit::Config::IParticipantConfiguratio
                 std::cout << ".";
             }
         }
-        PublishMessages(publisher, benchmark.messageCount, benchmark.messageSizeInBytes);
+        PublishMessages(publisher, benchmark.messageCount, benchmark.messageSizeInBytes, benchmark.loanBuffers);
     }, stepSize);
 
     auto lifecycleFuture = lifecycleService->StartLifecycle();
@@ -351,6 +364,8 @@ void PrintParameters(BenchmarkConfig benchmark)
               << std::left << std::setw(38) << "- Messages per simulation step (1ms): " << benchmark.messageCount
               << std::endl
               << std::left << std::setw(38) << "- Message size (bytes): " << benchmark.messageSizeInBytes << std::endl
+              << std::left << std::setw(38) << "- Loaned buffers: " << (benchmark.loanBuffers ? "yes" : "no")
+              << std::endl
               << std::left << std::setw(38) << "- Registry URI: " << benchmark.registryUri << std::endl
               << std::left << std::setw(38) << "- Configuration: " << benchmark.silKitConfigPath << std::endl
               << std::left << std::setw(38) << "- CSV output: " << benchmark.writeCsv << std::endl;
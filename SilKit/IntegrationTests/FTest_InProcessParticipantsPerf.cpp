@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <dirent.h>
+#endif
+
+#include "silkit/services/orchestration/all.hpp"
+
+#include "SimTestHarness.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using Clock = std::chrono::steady_clock;
+
+// Returns the number of threads of this process, or -1 if it cannot be determined on this platform
+auto GetNumberOfThreads() -> int
+{
+#if defined(__linux__)
+    auto* dir = opendir("/proc/self/task");
+    if (dir == nullptr)
+    {
+        return -1;
+    }
+    int numberOfThreads{0};
+    while (auto* entry = readdir(dir))
+    {
+        if (entry->d_name[0] != '.')
+        {
+            ++numberOfThreads;
+        }
+    }
+    closedir(dir);
+    return numberOfThreads;
+#else
+    return -1;
+#endif
+}
+
+class FTest_InProcessParticipantsPerf : public testing::Test
+{
+protected:
+    struct Result
+    {
+        int numberOfThreads{-1};
+        std::chrono::duration<double, std::micro> meanStepLatency{};
+    };
+
+    // Runs numberOfParticipants synchronized participants in this process for numberOfSteps steps of 1ms. Returns the
+    // number of threads of the process while the simulation is running, and the mean wall-clock time per step.
+    auto ExecuteTest(int numberOfParticipants, int numberOfSteps) -> Result
+    {
+        std::vector<std::string> syncParticipantNames;
+        for (auto i = 0; i < numberOfParticipants; ++i)
+        {
+            syncParticipantNames.push_back("Ecu" + std::to_string(i));
+        }
+
+        SilKit::Tests::SimTestHarnessArgs args;
+        args.syncParticipantNames = syncParticipantNames;
+        SilKit::Tests::SimTestHarness testHarness{args};
+
+        Result result;
+        Clock::time_point firstStepStart{};
+        Clock::time_point lastStepEnd{};
+
+        for (auto i = 0; i < numberOfParticipants; ++i)
+        {
+            auto* simParticipant = testHarness.GetParticipant(syncParticipantNames[i]);
+            auto* lifecycleService = simParticipant->GetOrCreateLifecycleService();
+            auto* timeSyncService = simParticipant->GetOrCreateTimeSyncService();
+
+            if (i != 0)
+            {
+                timeSyncService->SetSimulationStepHandler([](auto, auto) {}, 1ms);
+                continue;
+            }
+
+            timeSyncService->SetSimulationStepHandler(
+                [numberOfSteps, lifecycleService, &result, &firstStepStart, &lastStepEnd](auto now, auto) {
+                if (now == 0ns)
+                {
+                    firstStepStart = Clock::now();
+                }
+                if (now == 1ms)
+                {
+                    result.numberOfThreads = GetNumberOfThreads();
+                }
+                if (now == std::chrono::milliseconds{numberOfSteps})
+                {
+                    lastStepEnd = Clock::now();
+                    lifecycleService->Stop("Step limit reached");
+                }
+            }, 1ms);
+        }
+
+        EXPECT_TRUE(testHarness.Run(120s)) << "TestSim Harness timed out";
+
+        result.meanStepLatency = (lastStepEnd - firstStepStart) / numberOfSteps;
+        return result;
+    }
+};
+
+TEST_F(FTest_InProcessParticipantsPerf, test_threads_and_step_latency)
+{
+    // Larger set for production
+    //std::vector<int> numberOfParticipantsList{1, 10, 30, 60};
+    //const int numberOfSteps{10000};
+
+    // For testing
+    std::vector<int> numberOfParticipantsList{1, 10, 30};
+    const int numberOfSteps{500};
+
+    std::cout << std::endl;
+    std::cout << "# NumberOfParticipants NumberOfThreads MeanStepLatency(us)" << std::endl;
+    for (auto numberOfParticipants : numberOfParticipantsList)
+    {
+        const auto result = ExecuteTest(numberOfParticipants, numberOfSteps);
+        std::cout << std::left << std::setw(22) << numberOfParticipants << " " << std::setw(15)
+                  << result.numberOfThreads << " " << result.meanStepLatency.count() << std::endl;
+    }
+}
+
+} // namespace
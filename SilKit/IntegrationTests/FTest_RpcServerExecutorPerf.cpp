@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "silkit/services/all.hpp"
+#include "silkit/services/orchestration/all.hpp"
+
+#include "SimTestHarness.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+using namespace SilKit::Services::Rpc;
+
+using Clock = std::chrono::steady_clock;
+
+class FTest_RpcServerExecutorPerf : public testing::Test
+{
+protected:
+    // The client issues numberOfCalls calls in its first simulation step, each of which keeps the server busy for
+    // handlerDuration. Returns the calls per second, measured from the first call until the last result arrived.
+    auto ExecuteTest(uint32_t executorThreads, int numberOfCalls, std::chrono::microseconds handlerDuration) -> double
+    {
+        SilKit::Tests::SimTestHarnessArgs args;
+        args.syncParticipantNames = {"Client", "Server"};
+        args.deferParticipantCreation = true;
+        SilKit::Tests::SimTestHarness testHarness{args};
+
+        RpcSpec dataSpec{"RpcServerExecutorPerf", "application/octet-stream"};
+
+        auto* serverParticipant = testHarness.GetParticipant("Server", ServerConfiguration(executorThreads));
+        serverParticipant->GetOrCreateTimeSyncService()->SetSimulationStepHandler([](auto, auto) {}, 1ms);
+        (void)serverParticipant->Participant()->CreateRpcServer(
+            "RpcServer", dataSpec, [handlerDuration](IRpcServer* server, RpcCallEvent event) {
+            // Simulate a CPU-bound call handler
+            const auto handlerEnd = Clock::now() + handlerDuration;
+            while (Clock::now() < handlerEnd)
+            {
+            }
+            server->SubmitResult(event.callHandle, event.argumentData);
+        });
+
+        auto* clientParticipant = testHarness.GetParticipant("Client", "");
+        auto* lifecycleService = clientParticipant->GetOrCreateLifecycleService();
+        auto* timeSyncService = clientParticipant->GetOrCreateTimeSyncService();
+
+        int numberOfResults{0};
+        Clock::time_point firstCallStart{};
+        Clock::time_point lastResultEnd{};
+
+        auto* client = clientParticipant->Participant()->CreateRpcClient(
+            "RpcClient", dataSpec,
+            [numberOfCalls, lifecycleService, &numberOfResults, &lastResultEnd](IRpcClient*,
+                                                                                 const RpcCallResultEvent& event) {
+            EXPECT_EQ(event.callStatus, RpcCallStatus::Success);
+            if (++numberOfResults == numberOfCalls)
+            {
+                lastResultEnd = Clock::now();
+                lifecycleService->Stop("All calls returned");
+            }
+        });
+
+        timeSyncService->SetSimulationStepHandler([numberOfCalls, client, &firstCallStart](auto now, auto) {
+            if (now != 0ns)
+            {
+                return;
+            }
+            firstCallStart = Clock::now();
+            for (auto i = 0; i < numberOfCalls; ++i)
+            {
+                client->Call(std::vector<uint8_t>{1, 2, 3});
+            }
+        }, 1ms);
+
+        EXPECT_TRUE(testHarness.Run(120s)) << "TestSim Harness timed out";
+        EXPECT_EQ(numberOfResults, numberOfCalls);
+
+        const std::chrono::duration<double> duration = lastResultEnd - firstCallStart;
+        return numberOfCalls / duration.count();
+    }
+
+    static auto ServerConfiguration(uint32_t executorThreads) -> std::string
+    {
+        return R"(
+RpcServers:
+  - Name: RpcServer
+    ExecutorThreads: )"
+               + std::to_string(executorThreads);
+    }
+};
+
+TEST_F(FTest_RpcServerExecutorPerf, test_rpc_server_executor_throughput)
+{
+    // Larger set for production
+    //std::vector<uint32_t> executorThreadsList{0, 1, 2, 4, 8};
+    //const int numberOfCalls{10000};
+
+    // For testing
+    std::vector<uint32_t> executorThreadsList{0, 1, 2, 4};
+    const int numberOfCalls{1000};
+    const auto handlerDuration = 200us;
+
+    std::cout << std::endl;
+    std::cout << "# ExecutorThreads Throughput(calls/s)" << std::endl;
+    for (auto executorThreads : executorThreadsList)
+    {
+        const auto throughput = ExecuteTest(executorThreads, numberOfCalls, handlerDuration);
+        std::cout << std::left << std::setw(17) << executorThreads << " " << throughput << std::endl;
+    }
+}
+
+} // namespace
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "silkit/services/all.hpp"
+#include "silkit/services/orchestration/all.hpp"
+
+#include "SimTestHarness.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using Clock = std::chrono::steady_clock;
+
+class FTest_TimeAdvancePerf : public testing::Test
+{
+protected:
+    enum class TimeAdvanceMode
+    {
+        Distributed,
+        Coordinated,
+    };
+
+    // Runs numberOfParticipants synchronized participants for numberOfSteps steps and returns the steps per second
+    auto ExecuteTest(int numberOfParticipants, int numberOfSteps, TimeAdvanceMode mode) -> double
+    {
+        const auto coordinatorName = ParticipantName(0);
+
+        std::string participantConfiguration;
+        if (mode == TimeAdvanceMode::Coordinated)
+        {
+            participantConfiguration = R"(
+Experimental:
+  TimeSynchronization:
+    TimeAdvanceCoordinator: )" + coordinatorName;
+        }
+
+        std::vector<std::string> syncParticipantNames;
+        for (auto i = 0; i < numberOfParticipants; ++i)
+        {
+            syncParticipantNames.push_back(ParticipantName(i));
+        }
+
+        SilKit::Tests::SimTestHarnessArgs args;
+        args.syncParticipantNames = syncParticipantNames;
+        args.deferParticipantCreation = true;
+        args.internalSystemMonitorConfiguration = participantConfiguration;
+        SilKit::Tests::SimTestHarness testHarness{args};
+
+        std::vector<std::vector<std::chrono::nanoseconds>> simStepTimePoints(numberOfParticipants);
+        Clock::time_point firstStepStart{};
+        Clock::time_point lastStepEnd{};
+
+        for (auto i = 0; i < numberOfParticipants; ++i)
+        {
+            auto* simParticipant = testHarness.GetParticipant(ParticipantName(i), participantConfiguration);
+            auto* lifecycleService = simParticipant->GetOrCreateLifecycleService();
+            auto* timeSyncService = simParticipant->GetOrCreateTimeSyncService();
+
+            auto& timePoints = simStepTimePoints[i];
+            timePoints.reserve(numberOfSteps + 1);
+
+            timeSyncService->SetSimulationStepHandler(
+                [i, numberOfSteps, lifecycleService, &timePoints, &firstStepStart, &lastStepEnd](auto now, auto) {
+                timePoints.push_back(now);
+                if (i != 0)
+                {
+                    return;
+                }
+                if (now == 0ns)
+                {
+                    firstStepStart = Clock::now();
+                }
+                if (now == std::chrono::milliseconds{numberOfSteps})
+                {
+                    lastStepEnd = Clock::now();
+                    lifecycleService->Stop("Step limit reached");
+                }
+            }, 1ms);
+        }
+
+        EXPECT_TRUE(testHarness.Run(120s)) << "TestSim Harness timed out";
+
+        // Both modes must result in the same time points of the simulation steps: Each participant executed the steps
+        // without gaps, and none of them ran ahead of the participant that stopped the simulation
+        for (const auto& timePoints : simStepTimePoints)
+        {
+            EXPECT_GE(timePoints.size(), static_cast<size_t>(numberOfSteps));
+            EXPECT_LE(timePoints.size(), static_cast<size_t>(numberOfSteps + 1));
+            for (size_t step = 0; step < timePoints.size(); ++step)
+            {
+                EXPECT_EQ(timePoints[step], std::chrono::milliseconds{step});
+            }
+        }
+
+        const std::chrono::duration<double> duration = lastStepEnd - firstStepStart;
+        return numberOfSteps / duration.count();
+    }
+
+    static auto ParticipantName(int i) -> std::string
+    {
+        return "Participant" + std::to_string(i);
+    }
+};
+
+TEST_F(FTest_TimeAdvancePerf, test_time_advance_performance)
+{
+    // Larger set for production
+    //std::vector<int> numberOfParticipantsList{2, 5, 10, 20, 40, 80};
+    //const int numberOfSteps{10000};
+
+    // For testing
+    std::vector<int> numberOfParticipantsList{2, 5, 10};
+    const int numberOfSteps{1000};
+
+    std::cout << std::endl;
+    std::cout << "# NumberOfParticipants Distributed(steps/s) Coordinated(steps/s)" << std::endl;
+    for (auto numberOfParticipants : numberOfParticipantsList)
+    {
+        const auto distributed = ExecuteTest(numberOfParticipants, numberOfSteps, TimeAdvanceMode::Distributed);
+        const auto coordinated = ExecuteTest(numberOfParticipants, numberOfSteps, TimeAdvanceMode::Coordinated);
+        std::cout << std::left << std::setw(22) << numberOfParticipants << " " << std::setw(22) << distributed << " "
+                  << coordinated << std::endl;
+    }
+}
+
+} // namespace
@@ -820,6 +820,22 @@ extern "C"
         return globalCapi->SilKit_DataPublisher_Publish(self, data);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_PublishBatch(SilKit_DataPublisher* self,
+                                                                   const SilKit_ByteVector* data, size_t numSamples)
+    {
+        return globalCapi->SilKit_DataPublisher_PublishBatch(self, data, numSamples);
+    }
+
+    SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Loan(SilKit_DataPublisher* self, size_t size, uint8_t** outData)
+    {
+        return globalCapi->SilKit_DataPublisher_Loan(self, size, outData);
+    }
+
+    SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Commit(SilKit_DataPublisher* self)
+    {
+        return globalCapi->SilKit_DataPublisher_Commit(self);
+    }
+
     // DataSubscriber
 
     SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_Create(SilKit_DataSubscriber** outSubscriber,
@@ -838,6 +854,31 @@ extern "C"
         return globalCapi->SilKit_DataSubscriber_SetDataMessageHandler(self, context, dataHandler);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_SetDataMessageBatchHandler(
+        SilKit_DataSubscriber* self, void* context, SilKit_DataMessageBatchHandler_t batchHandler)
+    {
+        return globalCapi->SilKit_DataSubscriber_SetDataMessageBatchHandler(self, context, batchHandler);
+    }
+
+    SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_EnableReceiveQueue(
+        SilKit_DataSubscriber* self, size_t capacity, SilKit_ReceiveQueueOverflowPolicy overflowPolicy)
+    {
+        return globalCapi->SilKit_DataSubscriber_EnableReceiveQueue(self, capacity, overflowPolicy);
+    }
+
+    SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_TryTake(SilKit_DataSubscriber* self,
+                                                               SilKit_DataMessageEvent* outDataMessageEvent,
+                                                               SilKit_Bool* outTaken)
+    {
+        return globalCapi->SilKit_DataSubscriber_TryTake(self, outDataMessageEvent, outTaken);
+    }
+
+    SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_TakeAll(SilKit_DataSubscriber* self, void* context,
+                                                               SilKit_DataMessageHandler_t dataHandler)
+    {
+        return globalCapi->SilKit_DataSubscriber_TakeAll(self, context, dataHandler);
+    }
+
     // RpcServer
 
     SilKit_ReturnCode SilKitCALL SilKit_RpcServer_Create(SilKit_RpcServer** outServer, SilKit_Participant* participant,
@@ -884,6 +925,13 @@ extern "C"
         return globalCapi->SilKit_RpcClient_CallWithTimeout(self, argumentData, timeout, userContext);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_RpcClient_CallBatch(SilKit_RpcClient* self,
+                                                            const SilKit_ByteVector* argumentData, size_t numCalls,
+                                                            void* const* userContexts)
+    {
+        return globalCapi->SilKit_RpcClient_CallBatch(self, argumentData, numCalls, userContexts);
+    }
+
     SilKit_ReturnCode SilKitCALL SilKit_RpcClient_SetCallResultHandler(SilKit_RpcClient* self, void* context,
                                                                        SilKit_RpcCallResultHandler_t handler)
     {
@@ -445,6 +445,14 @@ public:
     MOCK_METHOD(SilKit_ReturnCode, SilKit_DataPublisher_Publish,
                 (SilKit_DataPublisher * self, const SilKit_ByteVector* data));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_DataPublisher_PublishBatch,
+                (SilKit_DataPublisher * self, const SilKit_ByteVector* data, size_t numSamples));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_DataPublisher_Loan,
+                (SilKit_DataPublisher * self, size_t size, uint8_t** outData));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_DataPublisher_Commit, (SilKit_DataPublisher * self));
+
     // DataSubscriber
 
     MOCK_METHOD(SilKit_ReturnCode, SilKit_DataSubscriber_Create,
@@ -454,6 +462,18 @@ public:
     MOCK_METHOD(SilKit_ReturnCode, SilKit_DataSubscriber_SetDataMessageHandler,
                 (SilKit_DataSubscriber * self, void* context, SilKit_DataMessageHandler_t dataHandler));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_DataSubscriber_SetDataMessageBatchHandler,
+                (SilKit_DataSubscriber * self, void* context, SilKit_DataMessageBatchHandler_t batchHandler));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_DataSubscriber_EnableReceiveQueue,
+                (SilKit_DataSubscriber * self, size_t capacity, SilKit_ReceiveQueueOverflowPolicy overflowPolicy));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_DataSubscriber_TryTake,
+                (SilKit_DataSubscriber * self, SilKit_DataMessageEvent* outDataMessageEvent, SilKit_Bool* outTaken));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_DataSubscriber_TakeAll,
+                (SilKit_DataSubscriber * self, void* context, SilKit_DataMessageHandler_t dataHandler));
+
     // RpcServer
 
     MOCK_METHOD(SilKit_ReturnCode, SilKit_RpcServer_Create,
@@ -479,6 +499,10 @@ public:
                 (SilKit_RpcClient * self, const SilKit_ByteVector* argumentData, SilKit_NanosecondsTime timeout,
                  void* userContext));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_RpcClient_CallBatch,
+                (SilKit_RpcClient * self, const SilKit_ByteVector* argumentData, size_t numCalls,
+                 void* const* userContexts));
+
     MOCK_METHOD(SilKit_ReturnCode, SilKit_RpcClient_SetCallResultHandler,
                 (SilKit_RpcClient * self, void* context, SilKit_RpcCallResultHandler_t handler));
 
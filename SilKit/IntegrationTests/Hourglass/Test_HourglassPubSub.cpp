@@ -119,6 +119,27 @@ MATCHER_P(PubSubSpecMatcher, pubSubSpecParam, "")
         return false;
     }
 
+    const auto& cppContentFilters = cppPubSubSpec.ContentFilters();
+    if (cDataSpec->contentFilterList.numContentFilters != cppContentFilters.size())
+    {
+        *result_listener << "number-of-content-filters does not match";
+        return false;
+    }
+
+    for (size_t i = 0; i < cppContentFilters.size(); ++i)
+    {
+        const auto& cContentFilter = cDataSpec->contentFilterList.contentFilters[i];
+        if (cContentFilter.offset != cppContentFilters[i].offset
+            || !std::equal(cppContentFilters[i].value.begin(), cppContentFilters[i].value.end(),
+                           cContentFilter.value.data, cContentFilter.value.data + cContentFilter.value.size)
+            || !std::equal(cppContentFilters[i].mask.begin(), cppContentFilters[i].mask.end(), cContentFilter.mask.data,
+                           cContentFilter.mask.data + cContentFilter.mask.size))
+        {
+            *result_listener << "content filters do not match";
+            return false;
+        }
+    }
+
     return true;
 }
 
@@ -178,6 +199,48 @@ TEST_F(Test_HourglassPubSub, SilKit_DataPublisher_Publish)
     publisher.Publish(byteSpan);
 }
 
+TEST_F(Test_HourglassPubSub, SilKit_DataPublisher_PublishBatch)
+{
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::PubSub::DataPublisher publisher{
+        participant, "DataPublisher1", PubSubSpec{"Topic1", "MediaType1"}, 0x42};
+
+    std::vector<uint8_t> bytes{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    const Span<const uint8_t> byteSpan{bytes};
+    const std::vector<Span<const uint8_t>> byteSpans{byteSpan, byteSpan};
+
+    EXPECT_CALL(capi, SilKit_DataPublisher_PublishBatch(mockDataPublisher, testing::_, 2))
+        .WillOnce([&bytes](SilKit_DataPublisher*, const SilKit_ByteVector* data, size_t) {
+        EXPECT_EQ(data[0].data, bytes.data());
+        EXPECT_EQ(data[1].size, bytes.size());
+        return SilKit_ReturnCode_SUCCESS;
+    });
+
+    publisher.PublishBatch(byteSpans);
+}
+
+TEST_F(Test_HourglassPubSub, SilKit_DataPublisher_Loan_Commit)
+{
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::PubSub::DataPublisher publisher{
+        participant, "DataPublisher1", PubSubSpec{"Topic1", "MediaType1"}, 0x42};
+
+    std::vector<uint8_t> loanedBuffer(9);
+
+    EXPECT_CALL(capi, SilKit_DataPublisher_Loan(mockDataPublisher, loanedBuffer.size(), testing::_))
+        .WillOnce(DoAll(SetArgPointee<2>(loanedBuffer.data()), Return(SilKit_ReturnCode_SUCCESS)));
+
+    const auto loaned = publisher.Loan(loanedBuffer.size());
+    EXPECT_EQ(loaned.data(), loanedBuffer.data());
+    EXPECT_EQ(loaned.size(), loanedBuffer.size());
+
+    EXPECT_CALL(capi, SilKit_DataPublisher_Commit(mockDataPublisher));
+
+    publisher.Commit();
+}
+
 // DataSubscriber
 
 TEST_F(Test_HourglassPubSub, SilKit_DataSubscriber_Create)
@@ -195,6 +258,7 @@ TEST_F(Test_HourglassPubSub, SilKit_DataSubscriber_Create)
     PubSubSpec pubSubSpec{topic, mediaType};
     pubSubSpec.AddLabel(labelKey1, labelValue1, MatchingLabel::Kind::Mandatory);
     pubSubSpec.AddLabel(labelKey2, labelValue2, MatchingLabel::Kind::Optional);
+    pubSubSpec.AddContentFilter({1, {0x12, 0x34}, {0xff, 0xf0}});
 
     EXPECT_CALL(capi, SilKit_DataSubscriber_Create(testing::_, participant, StrEq(subscriberName),
                                                    PubSubSpecMatcher(pubSubSpec), testing::_, testing::_));
@@ -222,4 +286,136 @@ TEST_F(Test_HourglassPubSub, SilKit_DataSubscriber_SetDataMessageHandler)
     });
 }
 
+TEST_F(Test_HourglassPubSub, SilKit_DataSubscriber_SetDataMessageBatchHandler)
+{
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::PubSub::DataSubscriber subscriber{
+        participant, "DataSubscriber1", PubSubSpec{"Topic1", "MediaType1"},
+        [](IDataSubscriber*, const DataMessageEvent&) {
+        // do nothing
+    }};
+
+    void* batchHandlerContext{nullptr};
+    SilKit_DataMessageBatchHandler_t batchHandler{nullptr};
+    EXPECT_CALL(capi, SilKit_DataSubscriber_SetDataMessageBatchHandler(mockDataSubscriber, testing::_, testing::_))
+        .WillOnce(DoAll(testing::SaveArg<1>(&batchHandlerContext), testing::SaveArg<2>(&batchHandler),
+                        Return(SilKit_ReturnCode_SUCCESS)));
+
+    std::vector<std::vector<uint8_t>> received;
+    subscriber.SetDataMessageBatchHandler([&received](IDataSubscriber*, const DataMessageBatchEvent& event) {
+        EXPECT_EQ(event.timestamp, std::chrono::nanoseconds{42});
+        for (const auto& sample : event.data)
+        {
+            received.emplace_back(sample.begin(), sample.end());
+        }
+    });
+    ASSERT_NE(batchHandler, nullptr);
+
+    uint8_t bytes[3] = {1, 2, 3};
+    SilKit_ByteVector cData[2] = {{bytes, 3}, {bytes, 1}};
+    SilKit_DataMessageBatchEvent cDataMessageBatchEvent;
+    SilKit_Struct_Init(SilKit_DataMessageBatchEvent, cDataMessageBatchEvent);
+    cDataMessageBatchEvent.timestamp = 42;
+    cDataMessageBatchEvent.numSamples = 2;
+    cDataMessageBatchEvent.data = cData;
+    batchHandler(batchHandlerContext, mockDataSubscriber, &cDataMessageBatchEvent);
+
+    EXPECT_EQ(received, (std::vector<std::vector<uint8_t>>{{1, 2, 3}, {1}}));
+}
+
+TEST_F(Test_HourglassPubSub, SilKit_DataSubscriber_SetDataMessageBatchHandler_Clear)
+{
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::PubSub::DataSubscriber subscriber{
+        participant, "DataSubscriber1", PubSubSpec{"Topic1", "MediaType1"},
+        [](IDataSubscriber*, const DataMessageEvent&) {
+        // do nothing
+    }};
+
+    EXPECT_CALL(capi, SilKit_DataSubscriber_SetDataMessageBatchHandler(mockDataSubscriber, nullptr, nullptr))
+        .WillOnce(Return(SilKit_ReturnCode_SUCCESS));
+
+    subscriber.SetDataMessageBatchHandler(nullptr);
+}
+
+TEST_F(Test_HourglassPubSub, SilKit_DataSubscriber_EnableReceiveQueue)
+{
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::PubSub::DataSubscriber subscriber{
+        participant, "DataSubscriber1", PubSubSpec{"Topic1", "MediaType1"},
+        [](IDataSubscriber*, const DataMessageEvent&) {
+        // do nothing
+    }};
+
+    EXPECT_CALL(capi, SilKit_DataSubscriber_EnableReceiveQueue(mockDataSubscriber, 16,
+                                                               SilKit_ReceiveQueueOverflowPolicy_DropNewest));
+
+    subscriber.EnableReceiveQueue(16, ReceiveQueueOverflowPolicy::DropNewest);
+}
+
+TEST_F(Test_HourglassPubSub, SilKit_DataSubscriber_TryTake)
+{
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::PubSub::DataSubscriber subscriber{
+        participant, "DataSubscriber1", PubSubSpec{"Topic1", "MediaType1"},
+        [](IDataSubscriber*, const DataMessageEvent&) {
+        // do nothing
+    }};
+
+    std::vector<uint8_t> data{1, 2, 3};
+    SilKit_DataMessageEvent cDataMessageEvent;
+    SilKit_Struct_Init(SilKit_DataMessageEvent, cDataMessageEvent);
+    cDataMessageEvent.timestamp = 42;
+    cDataMessageEvent.data = {data.data(), data.size()};
+
+    EXPECT_CALL(capi, SilKit_DataSubscriber_TryTake(mockDataSubscriber, testing::_, testing::_))
+        .WillOnce(DoAll(SetArgPointee<1>(cDataMessageEvent), SetArgPointee<2>(SilKit_True),
+                        Return(SilKit_ReturnCode_SUCCESS)))
+        .WillOnce(DoAll(SetArgPointee<2>(SilKit_False), Return(SilKit_ReturnCode_SUCCESS)));
+
+    DataMessageEvent dataMessageEvent{};
+    EXPECT_TRUE(subscriber.TryTake(dataMessageEvent));
+    EXPECT_EQ(dataMessageEvent.timestamp, std::chrono::nanoseconds{42});
+    EXPECT_EQ(dataMessageEvent.data.data(), data.data());
+    EXPECT_EQ(dataMessageEvent.data.size(), data.size());
+
+    EXPECT_FALSE(subscriber.TryTake(dataMessageEvent));
+}
+
+TEST_F(Test_HourglassPubSub, SilKit_DataSubscriber_TakeAll)
+{
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::PubSub::DataSubscriber subscriber{
+        participant, "DataSubscriber1", PubSubSpec{"Topic1", "MediaType1"},
+        [](IDataSubscriber*, const DataMessageEvent&) {
+        // do nothing
+    }};
+
+    std::vector<uint8_t> data{1, 2, 3};
+
+    EXPECT_CALL(capi, SilKit_DataSubscriber_TakeAll(mockDataSubscriber, testing::_, testing::_))
+        .WillOnce([&data](SilKit_DataSubscriber* self, void* context, SilKit_DataMessageHandler_t dataHandler) {
+        for (SilKit_NanosecondsTime timestamp = 1; timestamp <= 2; ++timestamp)
+        {
+            SilKit_DataMessageEvent cDataMessageEvent;
+            SilKit_Struct_Init(SilKit_DataMessageEvent, cDataMessageEvent);
+            cDataMessageEvent.timestamp = timestamp;
+            cDataMessageEvent.data = {data.data(), data.size()};
+            dataHandler(context, self, &cDataMessageEvent);
+        }
+        return SilKit_ReturnCode_SUCCESS;
+    });
+
+    const auto dataMessageEvents = subscriber.TakeAll();
+    ASSERT_EQ(dataMessageEvents.size(), 2u);
+    EXPECT_EQ(dataMessageEvents[0].timestamp, std::chrono::nanoseconds{1});
+    EXPECT_EQ(dataMessageEvents[1].timestamp, std::chrono::nanoseconds{2});
+    EXPECT_EQ(dataMessageEvents[1].data.data(), data.data());
+}
+
 } //namespace
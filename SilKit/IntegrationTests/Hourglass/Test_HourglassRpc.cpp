@@ -240,6 +240,31 @@ TEST_F(Test_HourglassRpc, SilKit_RpcClient_Call)
     rpcClient.Call(byteSpan, nullptr);
 }
 
+TEST_F(Test_HourglassRpc, SilKit_RpcClient_CallBatch)
+{
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::Rpc::RpcClient rpcClient{
+        participant, "RpcClient1", RpcSpec{"FunctionName1", "MediaType1"}, [](IRpcClient*, const RpcCallResultEvent&) {
+        // do nothing
+    }};
+
+    std::vector<uint8_t> bytes{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    const Span<const uint8_t> byteSpan{bytes};
+    const std::vector<Span<const uint8_t>> byteSpans{byteSpan, byteSpan};
+    std::vector<void*> userContexts{reinterpret_cast<void*>(uintptr_t(1)), reinterpret_cast<void*>(uintptr_t(2))};
+
+    EXPECT_CALL(capi, SilKit_RpcClient_CallBatch(mockRpcClient, testing::_, 2, userContexts.data()));
+
+    rpcClient.CallBatch(byteSpans, userContexts);
+
+    EXPECT_CALL(capi, SilKit_RpcClient_CallBatch(mockRpcClient, testing::_, 2, nullptr));
+
+    rpcClient.CallBatch(byteSpans, {});
+
+    EXPECT_THROW(rpcClient.CallBatch(byteSpans, Span<void* const>{userContexts.data(), 1}), SilKit::SilKitError);
+}
+
 TEST_F(Test_HourglassRpc, SilKit_RpcClient_SetCallResultHandler)
 {
     auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
@@ -213,6 +213,30 @@ TEST_F(ITest_Internals_DataPubSub, test_1pub_2sub_sync)
     RunSyncTest(pubsubs);
 }
 
+// One publisher participant, two subscriber participants on same topic, one of them only receives the even data
+TEST_F(ITest_Internals_DataPubSub, test_1pub_2sub_sync_content_filter)
+{
+    const uint32_t numMsgToPublish = defaultNumMsgToPublish;
+
+    std::vector<std::vector<uint8_t>> expectedDataUnordered;
+    for (uint32_t d = 0; d < numMsgToPublish; d += 2)
+    {
+        expectedDataUnordered.emplace_back(std::vector<uint8_t>(defaultMsgSize, static_cast<uint8_t>(d)));
+    }
+    const auto numMsgToReceiveFiltered = static_cast<uint32_t>(expectedDataUnordered.size());
+
+    DataSubscriberInfo filteringSubscriber{
+        "SubCtrl1", "TopicA", {"A"}, {}, defaultMsgSize, numMsgToReceiveFiltered, 1, expectedDataUnordered};
+    filteringSubscriber.contentFilters.push_back({0, {0x00}, {0x01}});
+
+    std::vector<PubSubParticipant> pubsubs;
+    pubsubs.push_back({"Pub1", {{"PubCtrl1", "TopicA", {"A"}, {}, 0, defaultMsgSize, numMsgToPublish}}, {}});
+    pubsubs.push_back({"Sub1", {}, {filteringSubscriber}});
+    pubsubs.push_back({"Sub2", {}, {{"SubCtrl1", "TopicA", {"A"}, {}, defaultMsgSize, numMsgToPublish, 1}}});
+
+    RunSyncTest(pubsubs);
+}
+
 // Two publisher participants, one subscriber participant on same topic: Expect all to arrive but arbitrary reception order
 TEST_F(ITest_Internals_DataPubSub, test_2pub_1sub_sync)
 {
@@ -705,6 +729,29 @@ TEST_F(ITest_Internals_DataPubSub, test_1pub_1sub_async_history)
     RunAsyncTest(publishers, subscribers);
 }
 
+// Async with a history of several messages: The subscriber only receives the last ones
+TEST_F(ITest_Internals_DataPubSub, test_1pub_1sub_async_history_depth)
+{
+    const uint8_t history = 3;
+    const uint32_t numMsgToPublish = 5;
+    const uint32_t numMsgToReceive = history;
+
+    std::vector<PubSubParticipant> publishers;
+    publishers.push_back(
+        {"Pub1", {{"PubCtrl1", "TopicA", {"A"}, {}, history, defaultMsgSize, numMsgToPublish}}, {}});
+    std::vector<std::vector<uint8_t>> expectedDataUnordered;
+    for (uint32_t d = numMsgToPublish - history; d < numMsgToPublish; d++)
+    {
+        expectedDataUnordered.emplace_back(std::vector<uint8_t>(defaultMsgSize, static_cast<uint8_t>(d)));
+    }
+    std::vector<PubSubParticipant> subscribers;
+    subscribers.push_back(
+        {"Sub1",
+         {},
+         {{"SubCtrl1", "TopicA", {"A"}, {}, defaultMsgSize, numMsgToReceive, 1, expectedDataUnordered}}});
+
+    RunAsyncTest(publishers, subscribers);
+}
 
 // Async rejoin
 TEST_F(ITest_Internals_DataPubSub, test_1pub_1sub_async_rejoin)
@@ -125,6 +125,7 @@ protected:
         std::string topic;
         std::string mediaType;
         std::vector<SilKit::Services::MatchingLabel> labels;
+        std::vector<SilKit::Services::PubSub::DataContentFilter> contentFilters;
         size_t messageSizeInBytes;
         uint32_t numMsgToReceive;
         bool expectIncreasingData;
@@ -333,6 +334,10 @@ protected:
                 {
                     dataSpec.AddLabel(label);
                 }
+                for (const auto& contentFilter : ds.contentFilters)
+                {
+                    dataSpec.AddContentFilter(contentFilter);
+                }
 
                 // Create DataSubscriber with default handler
                 if (participant.delayedDefaultDataHandler)
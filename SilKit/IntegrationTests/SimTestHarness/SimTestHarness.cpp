@@ -157,6 +157,7 @@ SimTestHarness::SimTestHarness(const std::vector<std::string>& syncParticipantNa
 SimTestHarness::SimTestHarness(const SilKit::Tests::SimTestHarnessArgs& args)
     : _syncParticipantNames{args.syncParticipantNames}
     , _asyncParticipantNames{args.asyncParticipantNames}
+    , _internalSystemMonitorConfiguration{args.internalSystemMonitorConfiguration}
 {
     // start registry
     _registry = SilKit::Vendor::Vector::CreateSilKitRegistry(
@@ -202,7 +203,7 @@ bool SimTestHarness::Run(std::chrono::nanoseconds testRunTimeout, const std::vec
     if (!_syncParticipantNames.empty())
     {
         // Create a monitor, add it to the list of simParticipants, then start all participants
-        AddParticipant(internalSystemMonitorName, "");
+        AddParticipant(internalSystemMonitorName, _internalSystemMonitorConfiguration);
         auto monitor = _simParticipants[internalSystemMonitorName]->GetOrCreateSystemMonitor();
         monitor->AddSystemStateHandler([&](auto systemState) {
             if (systemState == SilKit::Services::Orchestration::SystemState::Shutdown)
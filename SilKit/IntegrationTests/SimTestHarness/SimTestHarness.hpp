@@ -97,6 +97,9 @@ struct SimTestHarnessArgs
     /// If true, the system controller is only created if CreateSystemController is called. If false, it will be created
     /// in the SimTestHarness constructor.
     bool deferSystemControllerCreation{false};
+    /// The participant configuration of the internal system monitor, which is a synchronized participant as well. It
+    /// must match the time synchronization settings of the other synchronized participants.
+    std::string internalSystemMonitorConfiguration{""};
 
     struct
     {
@@ -155,6 +158,7 @@ private:
     std::vector<std::string> _syncParticipantNames;
     std::vector<std::string> _asyncParticipantNames;
     std::string _registryUri;
+    std::string _internalSystemMonitorConfiguration;
     std::unique_ptr<SimSystemController> _simSystemController;
     std::map<std::string, std::unique_ptr<SimParticipant>> _simParticipants;
     std::unique_ptr<SilKit::Vendor::Vector::ISilKitRegistry> _registry;
@@ -135,3 +135,39 @@ function(add_silkit_test_to_executable SILKIT_TEST_EXECUTABLE_NAME)
         )
     endforeach ()
 endfunction()
+
+function(add_silkit_benchmark_executable SILKIT_BENCHMARK_EXECUTABLE_NAME)
+    if(NOT ${SILKIT_BUILD_TESTS})
+        return()
+    endif()
+
+    set(mva SOURCES LIBS SMOKE_TEST_ARGS)
+
+    cmake_parse_arguments(arg
+        ""
+        ""
+        "${mva}"
+        ${ARGN}
+    )
+
+    add_executable("${SILKIT_BENCHMARK_EXECUTABLE_NAME}" ${arg_SOURCES})
+
+    target_link_libraries("${SILKIT_BENCHMARK_EXECUTABLE_NAME}"
+        PRIVATE SilKitInterface
+        PRIVATE ${arg_LIBS}
+    )
+
+    set_property(TARGET "${SILKIT_BENCHMARK_EXECUTABLE_NAME}" PROPERTY FOLDER "Benchmarks")
+
+    set_target_properties("${SILKIT_BENCHMARK_EXECUTABLE_NAME}" PROPERTIES
+        RUNTIME_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/$<CONFIG>"
+        LIBRARY_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/$<CONFIG>"
+    )
+
+    # benchmarks run with their full parameter set on demand; CTest only checks a small configuration
+    add_test(
+        NAME "${SILKIT_BENCHMARK_EXECUTABLE_NAME}"
+        COMMAND "${SILKIT_BENCHMARK_EXECUTABLE_NAME}" ${arg_SMOKE_TEST_ARGS}
+        WORKING_DIRECTORY $<TARGET_FILE_DIR:${SILKIT_BENCHMARK_EXECUTABLE_NAME}>
+    )
+endfunction()
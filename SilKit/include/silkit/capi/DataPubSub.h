@@ -31,6 +31,24 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 SILKIT_BEGIN_DECLS
 
+/*! \brief A condition on the content of the data a DataSubscriber receives
+*
+* The data matches if its bytes starting at the offset equal the value, after both are masked with the mask.
+*/
+typedef struct SilKit_DataContentFilter
+{
+    size_t offset; //!< The position of the compared bytes in the data
+    SilKit_ByteVector value; //!< The expected bytes
+    SilKit_ByteVector mask; //!< The compared bits of each byte. If empty, all bits are compared.
+} SilKit_DataContentFilter;
+
+/*! \brief A list of content filters */
+typedef struct SilKit_DataContentFilterList
+{
+    size_t numContentFilters;
+    SilKit_DataContentFilter* contentFilters;
+} SilKit_DataContentFilterList;
+
 /*! \brief A pubsub/rpc node spec containing all matching relevant information */
 typedef struct SilKit_DataSpec
 {
@@ -38,6 +56,13 @@ typedef struct SilKit_DataSpec
     const char* topic;
     const char* mediaType;
     SilKit_LabelList labelList;
+    /*! Only used by DataSubscribers: The data must match all content filters.
+     *
+     * \version Check: SK_ID_GET_VERSION(SilKit_Struct_GetId(dataSpec)) >= 2
+     *
+     * Added in SIL Kit version 4.0.54.
+     */
+    SilKit_DataContentFilterList contentFilterList;
 } SilKit_DataSpec;
 
 //! \brief An incoming DataMessage of a DataPublisher containing raw data and timestamp
@@ -50,6 +75,25 @@ typedef struct
     SilKit_ByteVector data;
 } SilKit_DataMessageEvent;
 
+//! \brief Several DataMessages which a DataPublisher published at once with SilKit_DataPublisher_PublishBatch
+typedef struct
+{
+    SilKit_StructHeader structHeader;
+    //! Send timestamp of the batch
+    SilKit_NanosecondsTime timestamp;
+    //! The number of samples in the batch
+    size_t numSamples;
+    //! The payloads of the samples, in the order of publication
+    const SilKit_ByteVector* data;
+} SilKit_DataMessageBatchEvent;
+
+/*! \brief Which data is discarded if the receive queue of a DataSubscriber is full */
+typedef uint8_t SilKit_ReceiveQueueOverflowPolicy;
+#define SilKit_ReceiveQueueOverflowPolicy_DropOldest \
+    ((SilKit_ReceiveQueueOverflowPolicy)0) //!< The oldest data in the queue is discarded
+#define SilKit_ReceiveQueueOverflowPolicy_DropNewest \
+    ((SilKit_ReceiveQueueOverflowPolicy)1) //!< The received data is discarded
+
 /*! \brief Represents a handle to a data publisher instance */
 typedef struct SilKit_DataPublisher SilKit_DataPublisher;
 /*! \brief Represents a handle to a data subscriber instance */
@@ -63,13 +107,20 @@ typedef struct SilKit_DataSubscriber SilKit_DataSubscriber;
 typedef void(SilKitFPTR* SilKit_DataMessageHandler_t)(void* context, SilKit_DataSubscriber* subscriber,
                                                       const SilKit_DataMessageEvent* dataMessageEvent);
 
+/*! \brief Handler type for incoming batches of data on DataSubscribers.
+* \param context The context that the user provided on registration.
+* \param subscriber The affected subscriber.
+* \param dataMessageBatchEvent Contains the raw data of each sample and the send timestamp.
+*/
+typedef void(SilKitFPTR* SilKit_DataMessageBatchHandler_t)(void* context, SilKit_DataSubscriber* subscriber,
+                                                           const SilKit_DataMessageBatchEvent* dataMessageBatchEvent);
+
 /*! \brief Create a DataPublisher on the provided simulation participant with the provided properties.
 * \param outPublisher Pointer to which the resulting DataPublisher reference will be written.
 * \param participant The simulation participant for which the DataPublisher should be created.
 * \param controllerName The name of this controller (UTF-8).
 * \param dataSpec The specification of topic, media type and labels.
 * \param history A number indicating the number of historic values that should be replayed for a new DataSubscriber.
-* Restricted to {0|1}.
 */
 SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Create(SilKit_DataPublisher** outPublisher,
                                                                    SilKit_Participant* participant,
@@ -109,6 +160,51 @@ SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Publish(SilKit_DataP
 typedef SilKit_ReturnCode(SilKitFPTR* SilKit_DataPublisher_Publish_t)(SilKit_DataPublisher* self,
                                                                       const SilKit_ByteVector* data);
 
+/*! \brief Publish several samples at once through the provided DataPublisher
+*
+* The samples are transmitted as a single message to each receiving participant, which is much cheaper than calling
+* SilKit_DataPublisher_Publish repeatedly for many small samples. The subscribers receive the samples one by one, unless
+* they set a handler with SilKit_DataSubscriber_SetDataMessageBatchHandler.
+*
+* Batches cannot be published by a DataPublisher with a history or KeepLatest, the function then returns an error.
+*
+* \param self The DataPublisher that should publish the data.
+* \param data An array of numSamples samples that should be published.
+* \param numSamples The number of samples.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_PublishBatch(SilKit_DataPublisher* self,
+                                                                         const SilKit_ByteVector* data,
+                                                                         size_t numSamples);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_DataPublisher_PublishBatch_t)(SilKit_DataPublisher* self,
+                                                                           const SilKit_ByteVector* data,
+                                                                           size_t numSamples);
+
+/*! \brief Loan a writable buffer for the next publication of the provided DataPublisher
+*
+* The buffer is taken from a pool of the publisher. Fill it in place and publish it with SilKit_DataPublisher_Commit,
+* which avoids copying the data. Loaning another buffer before committing discards the previous one.
+*
+* \param self The DataPublisher that should publish the data.
+* \param size The size of the data that should be published.
+* \param outData Pointer to which the address of the loaned buffer of the given size will be written.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Loan(SilKit_DataPublisher* self, size_t size,
+                                                                 uint8_t** outData);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_DataPublisher_Loan_t)(SilKit_DataPublisher* self, size_t size,
+                                                                   uint8_t** outData);
+
+/*! \brief Publish the buffer of the last call of SilKit_DataPublisher_Loan
+*
+* The buffer must not be accessed afterwards.
+*
+* \param self The DataPublisher that should publish the data.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Commit(SilKit_DataPublisher* self);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_DataPublisher_Commit_t)(SilKit_DataPublisher* self);
+
 /*! \brief Sets / overwrites the default handler to be called on data reception.
 * \param self The DataSubscriber for which the handler should be set.
 * \param context A user provided context, that is reobtained on data reception in the dataHandler.
@@ -120,6 +216,70 @@ SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_SetDataMessageHandl
 typedef SilKit_ReturnCode(SilKitFPTR* SilKit_DataSubscriber_SetDataMessageHandler_t)(
     SilKit_DataSubscriber* self, void* context, SilKit_DataMessageHandler_t dataHandler);
 
+/*! \brief Sets a handler to be called on the reception of batches, instead of calling the data handler per sample.
+*
+* Data published individually is still delivered to the data handler. If the receive queue is enabled, the samples of
+* a batch are queued individually and this handler is not called.
+*
+* \param self The DataSubscriber for which the handler should be set.
+* \param context A user provided context, that is reobtained on reception in the batchHandler.
+* \param batchHandler A handler that is called on the reception of a batch. NULL delivers the samples of batches to the
+* data handler again.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_SetDataMessageBatchHandler(
+    SilKit_DataSubscriber* self, void* context, SilKit_DataMessageBatchHandler_t batchHandler);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_DataSubscriber_SetDataMessageBatchHandler_t)(
+    SilKit_DataSubscriber* self, void* context, SilKit_DataMessageBatchHandler_t batchHandler);
+
+/*! \brief Queue the received data instead of delivering it to the data message handler
+*
+* Afterwards, the data message handler is not called anymore. The queued data is taken with
+* SilKit_DataSubscriber_TryTake or SilKit_DataSubscriber_TakeAll.
+*
+* \param self The DataSubscriber for which the receive queue should be enabled.
+* \param capacity The maximum number of queued data messages, must not be zero.
+* \param overflowPolicy Which data is discarded if the queue is full.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_EnableReceiveQueue(
+    SilKit_DataSubscriber* self, size_t capacity, SilKit_ReceiveQueueOverflowPolicy overflowPolicy);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_DataSubscriber_EnableReceiveQueue_t)(
+    SilKit_DataSubscriber* self, size_t capacity, SilKit_ReceiveQueueOverflowPolicy overflowPolicy);
+
+/*! \brief Take the oldest data message from the receive queue
+*
+* The data of the taken message remains valid until the next call of SilKit_DataSubscriber_TryTake or
+* SilKit_DataSubscriber_TakeAll.
+*
+* \param self The DataSubscriber from whose receive queue the data message should be taken.
+* \param outDataMessageEvent Pointer to which the taken data message will be written.
+* \param outTaken Pointer to which SilKit_True is written if a data message was taken, or SilKit_False if the queue
+*  was empty.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_TryTake(SilKit_DataSubscriber* self,
+                                                                     SilKit_DataMessageEvent* outDataMessageEvent,
+                                                                     SilKit_Bool* outTaken);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_DataSubscriber_TryTake_t)(SilKit_DataSubscriber* self,
+                                                                       SilKit_DataMessageEvent* outDataMessageEvent,
+                                                                       SilKit_Bool* outTaken);
+
+/*! \brief Take all data messages from the receive queue and call the handler for each of them, oldest first
+*
+* The handler is called on the calling thread, before this function returns. The data of the taken messages remains
+* valid until the next call of SilKit_DataSubscriber_TryTake or SilKit_DataSubscriber_TakeAll.
+*
+* \param self The DataSubscriber from whose receive queue the data messages should be taken.
+* \param context A user provided context, that is reobtained in the dataHandler.
+* \param dataHandler A handler that is called for each taken data message.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_TakeAll(SilKit_DataSubscriber* self, void* context,
+                                                                     SilKit_DataMessageHandler_t dataHandler);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_DataSubscriber_TakeAll_t)(SilKit_DataSubscriber* self, void* context,
+                                                                       SilKit_DataMessageHandler_t dataHandler);
+
 SILKIT_END_DECLS
 
 #pragma pack(pop)
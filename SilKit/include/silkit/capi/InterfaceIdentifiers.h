@@ -226,14 +226,17 @@ typedef struct
 // Data data type IDs
 #define SilKit_DataMessageEvent_DATATYPE_ID 1
 #define SilKit_DataSpec_DATATYPE_ID 2
+#define SilKit_DataMessageBatchEvent_DATATYPE_ID 3
 
 // Data data type versions
 #define SilKit_DataMessageEvent_VERSION 1
-#define SilKit_DataSpec_VERSION 1
+#define SilKit_DataSpec_VERSION 2
+#define SilKit_DataMessageBatchEvent_VERSION 1
 
 // Data public API IDs
 #define SilKit_DataMessageEvent_STRUCT_VERSION SK_ID_MAKE(Data, SilKit_DataMessageEvent)
 #define SilKit_DataSpec_STRUCT_VERSION SK_ID_MAKE(Data, SilKit_DataSpec)
+#define SilKit_DataMessageBatchEvent_STRUCT_VERSION SK_ID_MAKE(Data, SilKit_DataMessageBatchEvent)
 
 // Rpc
 // Rpc data type IDs
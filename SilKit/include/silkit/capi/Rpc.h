@@ -204,6 +204,25 @@ typedef SilKit_ReturnCode(SilKitFPTR* SilKit_RpcClient_CallWithTimeout_t)(SilKit
                                                                           SilKit_NanosecondsTime timeout,
                                                                           void* userContext);
 
+/*! \brief Dispatch several calls at once to the corresponding RPC servers
+ *
+ *  The calls are transmitted as a single message to each receiving participant. The result handler is called once per
+ *  call and result, in the same way as for individual calls.
+ *
+ * \param self The RPC client that should trigger the remote procedure calls.
+ * \param argumentData An array of numCalls argument data, one per call.
+ * \param numCalls The number of calls.
+ * \param userContexts An array of numCalls user context pointers, which are passed to the result handler when a result
+ *  of the respective call is received. May be NULL, then the user context of every call is NULL.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_RpcClient_CallBatch(SilKit_RpcClient* self,
+                                                                  const SilKit_ByteVector* argumentData,
+                                                                  size_t numCalls, void* const* userContexts);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_RpcClient_CallBatch_t)(SilKit_RpcClient* self,
+                                                                    const SilKit_ByteVector* argumentData,
+                                                                    size_t numCalls, void* const* userContexts);
+
 /*! \brief Overwrite the call result handler of this client
  * \param self The RPC client that should trigger the remote procedure call.
  * \param context A user provided context pointer that is passed to the handler on call.
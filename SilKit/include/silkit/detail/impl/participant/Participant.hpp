@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -198,7 +199,9 @@ auto Participant::CreateDataPublisher(const std::string& canonicalName,
                                       const SilKit::Services::PubSub::PubSubSpec& dataSpec,
                                       size_t history) -> SilKit::Services::PubSub::IDataPublisher*
 {
-    return _dataPublishers.Create(_participant, canonicalName, dataSpec, static_cast<uint8_t>(history & 0xff));
+    // The C API limits the history to 255 messages
+    return _dataPublishers.Create(_participant, canonicalName, dataSpec,
+                                  static_cast<uint8_t>((std::min)(history, size_t{0xff})));
 }
 
 auto Participant::CreateDataSubscriber(
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "silkit/capi/DataPubSub.h"
 
@@ -44,6 +45,12 @@ public:
 
     inline void Publish(Util::Span<const uint8_t> data) override;
 
+    inline void PublishBatch(Util::Span<const Util::Span<const uint8_t>> data) override;
+
+    inline auto Loan(size_t size) -> Util::Span<uint8_t> override;
+
+    inline void Commit() override;
+
 private:
     SilKit_DataPublisher* _dataPublisher{nullptr};
 };
@@ -93,6 +100,33 @@ void DataPublisher::Publish(Util::Span<const uint8_t> data)
     ThrowOnError(returnCode);
 }
 
+void DataPublisher::PublishBatch(Util::Span<const Util::Span<const uint8_t>> data)
+{
+    std::vector<SilKit_ByteVector> cData;
+    cData.reserve(data.size());
+    for (const auto& sample : data)
+    {
+        cData.emplace_back(ToSilKitByteVector(sample));
+    }
+
+    const auto returnCode = SilKit_DataPublisher_PublishBatch(_dataPublisher, cData.data(), cData.size());
+    ThrowOnError(returnCode);
+}
+
+auto DataPublisher::Loan(size_t size) -> Util::Span<uint8_t>
+{
+    uint8_t* data{nullptr};
+    const auto returnCode = SilKit_DataPublisher_Loan(_dataPublisher, size, &data);
+    ThrowOnError(returnCode);
+    return {data, size};
+}
+
+void DataPublisher::Commit()
+{
+    const auto returnCode = SilKit_DataPublisher_Commit(_dataPublisher);
+    ThrowOnError(returnCode);
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace Impl
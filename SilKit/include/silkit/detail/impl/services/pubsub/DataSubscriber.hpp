@@ -35,6 +35,7 @@ namespace PubSub {
 class DataSubscriber : public SilKit::Services::PubSub::IDataSubscriber
 {
     using DataMessageHandler = SilKit::Services::PubSub::DataMessageHandler;
+    using DataMessageBatchHandler = SilKit::Services::PubSub::DataMessageBatchHandler;
 
 public:
     inline DataSubscriber(SilKit_Participant* participant, const std::string& canonicalName,
@@ -45,10 +46,25 @@ public:
 
     inline void SetDataMessageHandler(SilKit::Services::PubSub::DataMessageHandler handler) override;
 
+    inline void SetDataMessageBatchHandler(SilKit::Services::PubSub::DataMessageBatchHandler handler) override;
+
+    inline void EnableReceiveQueue(size_t capacity,
+                                   SilKit::Services::PubSub::ReceiveQueueOverflowPolicy overflowPolicy) override;
+
+    inline bool TryTake(SilKit::Services::PubSub::DataMessageEvent& dataMessageEvent) override;
+
+    inline auto TakeAll() -> std::vector<SilKit::Services::PubSub::DataMessageEvent> override;
+
 private:
     inline static void TheDataMessageHandler(void* context, SilKit_DataSubscriber* subscriber,
                                              const SilKit_DataMessageEvent* dataMessageEvent);
 
+    inline static void TheDataMessageBatchHandler(void* context, SilKit_DataSubscriber* subscriber,
+                                                  const SilKit_DataMessageBatchEvent* dataMessageBatchEvent);
+
+    inline static void TheTakeAllHandler(void* context, SilKit_DataSubscriber* subscriber,
+                                         const SilKit_DataMessageEvent* dataMessageEvent);
+
 private:
     template <typename HandlerFunction>
     struct HandlerData
@@ -61,6 +77,7 @@ private:
     SilKit_DataSubscriber* _dataSubscriber{nullptr};
 
     std::unique_ptr<HandlerData<DataMessageHandler>> _dataMessageHandler;
+    std::unique_ptr<HandlerData<DataMessageBatchHandler>> _dataMessageBatchHandler;
 };
 
 } // namespace PubSub
@@ -93,6 +110,7 @@ DataSubscriber::DataSubscriber(SilKit_Participant* participant, const std::strin
     _dataMessageHandler->handler = std::move(dataMessageHandler);
 
     auto labels = MakePubSubSpecView(dataSpec);
+    auto contentFilters = MakeContentFilterView(dataSpec);
 
     SilKit_DataSpec cDataSpec;
     SilKit_Struct_Init(SilKit_DataSpec, cDataSpec);
@@ -100,6 +118,8 @@ DataSubscriber::DataSubscriber(SilKit_Participant* participant, const std::strin
     cDataSpec.mediaType = dataSpec.MediaType().c_str();
     cDataSpec.labelList.numLabels = labels.size();
     cDataSpec.labelList.labels = labels.data();
+    cDataSpec.contentFilterList.numContentFilters = contentFilters.size();
+    cDataSpec.contentFilterList.contentFilters = contentFilters.data();
 
     const auto returnCode = SilKit_DataSubscriber_Create(&_dataSubscriber, participant, canonicalName.c_str(),
                                                          &cDataSpec, _dataMessageHandler.get(), &TheDataMessageHandler);
@@ -119,6 +139,63 @@ void DataSubscriber::SetDataMessageHandler(SilKit::Services::PubSub::DataMessage
     _dataMessageHandler = std::move(handlerData);
 }
 
+void DataSubscriber::SetDataMessageBatchHandler(SilKit::Services::PubSub::DataMessageBatchHandler handler)
+{
+    if (!handler)
+    {
+        const auto returnCode = SilKit_DataSubscriber_SetDataMessageBatchHandler(_dataSubscriber, nullptr, nullptr);
+        ThrowOnError(returnCode);
+
+        _dataMessageBatchHandler.reset();
+        return;
+    }
+
+    auto handlerData = std::make_unique<HandlerData<DataMessageBatchHandler>>();
+    handlerData->controller = this;
+    handlerData->handler = std::move(handler);
+
+    const auto returnCode = SilKit_DataSubscriber_SetDataMessageBatchHandler(_dataSubscriber, handlerData.get(),
+                                                                             &TheDataMessageBatchHandler);
+    ThrowOnError(returnCode);
+
+    _dataMessageBatchHandler = std::move(handlerData);
+}
+
+void DataSubscriber::EnableReceiveQueue(size_t capacity,
+                                        SilKit::Services::PubSub::ReceiveQueueOverflowPolicy overflowPolicy)
+{
+    const auto returnCode = SilKit_DataSubscriber_EnableReceiveQueue(
+        _dataSubscriber, capacity, static_cast<SilKit_ReceiveQueueOverflowPolicy>(overflowPolicy));
+    ThrowOnError(returnCode);
+}
+
+bool DataSubscriber::TryTake(SilKit::Services::PubSub::DataMessageEvent& dataMessageEvent)
+{
+    SilKit_DataMessageEvent cDataMessageEvent;
+    SilKit_Struct_Init(SilKit_DataMessageEvent, cDataMessageEvent);
+    SilKit_Bool taken{SilKit_False};
+
+    const auto returnCode = SilKit_DataSubscriber_TryTake(_dataSubscriber, &cDataMessageEvent, &taken);
+    ThrowOnError(returnCode);
+
+    if (taken == SilKit_True)
+    {
+        dataMessageEvent.timestamp = std::chrono::nanoseconds{cDataMessageEvent.timestamp};
+        dataMessageEvent.data = SilKit::Util::ToSpan(cDataMessageEvent.data);
+    }
+    return taken == SilKit_True;
+}
+
+auto DataSubscriber::TakeAll() -> std::vector<SilKit::Services::PubSub::DataMessageEvent>
+{
+    std::vector<SilKit::Services::PubSub::DataMessageEvent> dataMessageEvents;
+
+    const auto returnCode = SilKit_DataSubscriber_TakeAll(_dataSubscriber, &dataMessageEvents, &TheTakeAllHandler);
+    ThrowOnError(returnCode);
+
+    return dataMessageEvents;
+}
+
 void DataSubscriber::TheDataMessageHandler(void* context, SilKit_DataSubscriber* subscriber,
                                            const SilKit_DataMessageEvent* dataMessageEvent)
 {
@@ -132,6 +209,38 @@ void DataSubscriber::TheDataMessageHandler(void* context, SilKit_DataSubscriber*
     handlerData->handler(handlerData->controller, event);
 }
 
+void DataSubscriber::TheDataMessageBatchHandler(void* context, SilKit_DataSubscriber* subscriber,
+                                                const SilKit_DataMessageBatchEvent* dataMessageBatchEvent)
+{
+    SILKIT_UNUSED_ARG(subscriber);
+
+    std::vector<SilKit::Util::Span<const uint8_t>> data;
+    data.reserve(dataMessageBatchEvent->numSamples);
+    for (size_t i = 0; i < dataMessageBatchEvent->numSamples; ++i)
+    {
+        data.emplace_back(SilKit::Util::ToSpan(dataMessageBatchEvent->data[i]));
+    }
+
+    SilKit::Services::PubSub::DataMessageBatchEvent event{};
+    event.timestamp = std::chrono::nanoseconds{dataMessageBatchEvent->timestamp};
+    event.data = data;
+
+    const auto handlerData = static_cast<HandlerData<DataMessageBatchHandler>*>(context);
+    handlerData->handler(handlerData->controller, event);
+}
+
+void DataSubscriber::TheTakeAllHandler(void* context, SilKit_DataSubscriber* subscriber,
+                                       const SilKit_DataMessageEvent* dataMessageEvent)
+{
+    SILKIT_UNUSED_ARG(subscriber);
+
+    SilKit::Services::PubSub::DataMessageEvent event{};
+    event.timestamp = std::chrono::nanoseconds{dataMessageEvent->timestamp};
+    event.data = SilKit::Util::ToSpan(dataMessageEvent->data);
+
+    static_cast<std::vector<SilKit::Services::PubSub::DataMessageEvent>*>(context)->push_back(event);
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace Impl
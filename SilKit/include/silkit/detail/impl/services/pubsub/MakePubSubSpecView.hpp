@@ -36,6 +36,9 @@ namespace PubSub {
 
 inline auto MakePubSubSpecView(const SilKit::Services::PubSub::PubSubSpec& pubSubSpec) -> std::vector<SilKit_Label>;
 
+inline auto MakeContentFilterView(const SilKit::Services::PubSub::PubSubSpec& pubSubSpec)
+    -> std::vector<SilKit_DataContentFilter>;
+
 } // namespace PubSub
 } // namespace Services
 } // namespace Impl
@@ -69,6 +72,22 @@ auto MakePubSubSpecView(const SilKit::Services::PubSub::PubSubSpec& pubSubSpec)
     return labels;
 }
 
+auto MakeContentFilterView(const SilKit::Services::PubSub::PubSubSpec& pubSubSpec)
+    -> std::vector<SilKit_DataContentFilter>
+{
+    std::vector<SilKit_DataContentFilter> contentFilters;
+    std::transform(pubSubSpec.ContentFilters().begin(), pubSubSpec.ContentFilters().end(),
+                   std::back_inserter(contentFilters),
+                   [](const SilKit::Services::PubSub::DataContentFilter& contentFilter) -> SilKit_DataContentFilter {
+        return {
+            contentFilter.offset,
+            {contentFilter.value.data(), contentFilter.value.size()},
+            {contentFilter.mask.data(), contentFilter.mask.size()},
+        };
+    });
+    return contentFilters;
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace Impl
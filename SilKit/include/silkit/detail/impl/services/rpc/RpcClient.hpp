@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "silkit/capi/Rpc.h"
 
 #include "silkit/services/rpc/IRpcClient.hpp"
@@ -48,6 +50,9 @@ public:
     inline void CallWithTimeout(SilKit::Util::Span<const uint8_t> data, std::chrono::nanoseconds timeout,
                                 void* userContext) override;
 
+    inline void CallBatch(SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> data,
+                          SilKit::Util::Span<void* const> userContexts) override;
+
     inline void SetCallResultHandler(SilKit::Services::Rpc::RpcCallResultHandler handler) override;
 
 private:
@@ -128,6 +133,26 @@ void RpcClient::CallWithTimeout(SilKit::Util::Span<const uint8_t> data, std::chr
     ThrowOnError(returnCode);
 }
 
+void RpcClient::CallBatch(SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> data,
+                          SilKit::Util::Span<void* const> userContexts)
+{
+    if (!userContexts.empty() && userContexts.size() != data.size())
+    {
+        throw SilKit::SilKitError{"RpcClient::CallBatch: The number of user contexts must match the number of calls"};
+    }
+
+    std::vector<SilKit_ByteVector> cData;
+    cData.reserve(data.size());
+    for (const auto& callData : data)
+    {
+        cData.emplace_back(SilKit::Util::ToSilKitByteVector(callData));
+    }
+
+    const auto returnCode = SilKit_RpcClient_CallBatch(_rpcClient, cData.data(), cData.size(),
+                                                       userContexts.empty() ? nullptr : userContexts.data());
+    ThrowOnError(returnCode);
+}
+
 void RpcClient::SetCallResultHandler(SilKit::Services::Rpc::RpcCallResultHandler handler)
 {
     auto handlerData = std::make_unique<HandlerData<RpcCallResultHandler>>();
@@ -73,6 +73,8 @@ public:
                                      const std::string& networkName) -> Services::Lin::ILinController* = 0;
 
     //! \brief Create a data publisher at this SIL Kit participant.
+    //!
+    //! The last \p history published data messages are replayed to data subscribers which are discovered later.
     virtual auto CreateDataPublisher(const std::string& canonicalName,
                                      const SilKit::Services::PubSub::PubSubSpec& dataSpec,
                                      size_t history = 0) -> Services::PubSub::IDataPublisher* = 0;
@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 #include "silkit/util/Span.hpp"
@@ -44,6 +45,40 @@ public:
      * \param data A non-owning reference to an opaque block of raw data
      */
     virtual void Publish(Util::Span<const uint8_t> data) = 0;
+
+    /*! \brief Publish several values at once
+     *
+     * The values are transmitted as a single message to each receiving participant, which is much cheaper than
+     * calling \ref Publish repeatedly for many small values. All values of the batch have the same timestamp. The
+     * subscribers receive the values one by one, unless they set a \ref IDataSubscriber::SetDataMessageBatchHandler.
+     *
+     * Batches cannot be published by a publisher with a history or KeepLatest, because a batch would neither replace
+     * nor be replaced by the individually published data.
+     *
+     * \param data A non-owning reference to the data of each value
+     * \throw SilKit::ConfigurationError The publisher was created with a history or is configured with KeepLatest.
+     */
+    virtual void PublishBatch(Util::Span<const Util::Span<const uint8_t>> data) = 0;
+
+    /*! \brief Loan a writable buffer for the next publication
+     *
+     * The buffer is taken from a pool of the publisher, which avoids allocating and copying the data on each
+     * publication. Fill the buffer in place and publish it with \ref Commit. Loaning another buffer before committing
+     * discards the previous one.
+     *
+     * \param size The size of the data to be published
+     * \return A non-owning reference to the loaned buffer, valid until \ref Commit or the next call of Loan
+     */
+    virtual auto Loan(size_t size) -> Util::Span<uint8_t> = 0;
+
+    /*! \brief Publish the loaned buffer
+     *
+     * Publishes the buffer returned by the last call of \ref Loan without copying it. The buffer must not be accessed
+     * afterwards.
+     *
+     * \throw SilKit::StateError If no buffer is loaned.
+     */
+    virtual void Commit() = 0;
 };
 
 } // namespace PubSub
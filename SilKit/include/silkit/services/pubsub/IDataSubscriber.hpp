@@ -21,6 +21,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 #include "PubSubDatatypes.hpp"
 
 namespace SilKit {
@@ -38,6 +41,53 @@ public:
      * The default handler will not be invoked if a specific is available.
      */
     virtual void SetDataMessageHandler(DataMessageHandler callback) = 0;
+
+    /*! \brief Set a handler for the batches of data published with IDataPublisher::PublishBatch
+     *
+     * Afterwards, each received batch is delivered to this handler as a whole, instead of calling the data message
+     * handler once per value. Data published individually is still delivered to the data message handler. If the
+     * receive queue is enabled, the values of a batch are queued individually and this handler is not called. An empty
+     * handler delivers the values of batches to the data message handler again.
+     */
+    virtual void SetDataMessageBatchHandler(DataMessageBatchHandler callback) = 0;
+
+    /*! \brief Queue the received data instead of delivering it to the data message handler
+     *
+     * Afterwards, the data message handler is not called anymore. Instead, the received data is put into a bounded
+     * queue, from which it is taken with \ref TryTake or \ref TakeAll, e.g., in the simulation step handler. The data
+     * is not copied into the queue.
+     *
+     * If the data subscriber is configured with KeepLatest, the queue only holds the latest data of each publisher,
+     * and the capacity and overflow policy are ignored.
+     *
+     * \param capacity The maximum number of queued data messages
+     * \param overflowPolicy Which data is discarded if the queue is full
+     *
+     * \throw SilKit::StateError If the receive queue is already enabled.
+     * \throw SilKit::SilKitError If the capacity is zero.
+     */
+    virtual void EnableReceiveQueue(size_t capacity, ReceiveQueueOverflowPolicy overflowPolicy) = 0;
+
+    /*! \brief Take the oldest data message from the receive queue
+     *
+     * The data of the taken message remains valid until the next call of TryTake or \ref TakeAll. These must not be
+     * called concurrently.
+     *
+     * \param dataMessageEvent Receives the taken data message
+     * \return false if the queue is empty
+     *
+     * \throw SilKit::StateError If the receive queue is not enabled.
+     */
+    virtual bool TryTake(DataMessageEvent& dataMessageEvent) = 0;
+
+    /*! \brief Take all data messages from the receive queue, oldest first
+     *
+     * The data of the taken messages remains valid until the next call of \ref TryTake or TakeAll. These must not be
+     * called concurrently.
+     *
+     * \throw SilKit::StateError If the receive queue is not enabled.
+     */
+    virtual auto TakeAll() -> std::vector<DataMessageEvent> = 0;
 };
 
 } // namespace PubSub
@@ -29,6 +29,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/util/Span.hpp"
 
+#include "silkit/capi/DataPubSub.h"
+
 namespace SilKit {
 namespace Services {
 namespace PubSub {
@@ -42,10 +44,32 @@ struct DataMessageEvent
     Util::Span<const uint8_t> data;
 };
 
+//! \brief Several DataMessages which a DataPublisher published at once, see IDataPublisher::PublishBatch
+struct DataMessageBatchEvent
+{
+    //! Send timestamp of the batch
+    std::chrono::nanoseconds timestamp;
+    //! The payloads of the published samples, in the order of publication
+    Util::Span<const Util::Span<const uint8_t>> data;
+};
+
+//! \brief Which data is discarded if the receive queue of a DataSubscriber is full
+enum class ReceiveQueueOverflowPolicy : SilKit_ReceiveQueueOverflowPolicy
+{
+    //! The oldest data in the queue is discarded
+    DropOldest = SilKit_ReceiveQueueOverflowPolicy_DropOldest,
+    //! The received data is discarded
+    DropNewest = SilKit_ReceiveQueueOverflowPolicy_DropNewest,
+};
+
 //! \brief Callback type for new data reception callbacks
 using DataMessageHandler = std::function<void(SilKit::Services::PubSub::IDataSubscriber* subscriber,
                                               const DataMessageEvent& dataMessageEvent)>;
 
+//! \brief Callback type for the reception of batches of data
+using DataMessageBatchHandler = std::function<void(SilKit::Services::PubSub::IDataSubscriber* subscriber,
+                                                   const DataMessageBatchEvent& dataMessageBatchEvent)>;
+
 } // namespace PubSub
 } // namespace Services
 } // namespace SilKit
@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <algorithm>
 
@@ -31,6 +32,19 @@ namespace SilKit {
 namespace Services {
 namespace PubSub {
 
+/*! \brief A condition on the content of the data a DataSubscriber receives
+*
+* The data matches if its bytes starting at the offset equal the value, after both are masked with the mask.
+* For example, a filter with offset 0 and no mask matches all data that starts with the value (a key prefix).
+* The filters of a DataSubscriber are evaluated by the DataPublishers, and data that does not match is not sent.
+*/
+struct DataContentFilter
+{
+    size_t offset{0}; //!< The position of the compared bytes in the data.
+    std::vector<uint8_t> value; //!< The expected bytes.
+    std::vector<uint8_t> mask; //!< The compared bits of each byte. If empty, all bits are compared.
+};
+
 /*! \brief The specification of topic, media type and labels for DataPublishers and DataSubscribers
 */
 class PubSubSpec
@@ -39,6 +53,7 @@ private:
     std::string _topic{};
     std::string _mediaType{};
     std::vector<SilKit::Services::MatchingLabel> _labels{};
+    std::vector<DataContentFilter> _contentFilters{};
 
 public:
     PubSubSpec() = default;
@@ -56,6 +71,14 @@ public:
     //! Add a MatchingLabel via key, value and matching kind.
     inline void AddLabel(const std::string& key, const std::string& value, SilKit::Services::MatchingLabel::Kind kind);
 
+    /*! \brief Add a content filter. Only used by DataSubscribers.
+    *
+    * A DataSubscriber only receives data that matches all of its content filters.
+    *
+    * \throw SilKit::ConfigurationError If the mask is neither empty nor of the same size as the value.
+    */
+    inline void AddContentFilter(const DataContentFilter& contentFilter);
+
     //! Get the topic of the PubSubSpec.
     auto Topic() const -> const std::string&
     {
@@ -71,6 +94,11 @@ public:
     {
         return _labels;
     }
+    //! Get the content filters of the PubSubSpec.
+    auto ContentFilters() const -> const std::vector<DataContentFilter>&
+    {
+        return _contentFilters;
+    }
 };
 
 void PubSubSpec::AddLabel(const SilKit::Services::MatchingLabel& label)
@@ -98,6 +126,17 @@ void PubSubSpec::AddLabel(const std::string& key, const std::string& value, SilK
     AddLabel({key, value, kind});
 }
 
+void PubSubSpec::AddContentFilter(const DataContentFilter& contentFilter)
+{
+    if (!contentFilter.mask.empty() && contentFilter.mask.size() != contentFilter.value.size())
+    {
+        throw ConfigurationError(
+            "SilKit::Services::PubSub::DataContentFilter must have a mask of the same size as its value, or none.");
+    }
+
+    _contentFilters.push_back(contentFilter);
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace SilKit
@@ -64,6 +64,21 @@ public:
      */
     virtual void CallWithTimeout(Util::Span<const uint8_t> data, std::chrono::nanoseconds timeout,
                                  void* userContext = nullptr) = 0;
+
+    /*! \brief Initiate several remote procedure calls at once.
+     *
+     *  The calls are transmitted as a single message to each receiving participant, which is much cheaper than
+     *  calling Call repeatedly for many small calls. The results are still delivered to the call result handler
+     *  one by one, in the same way as for individual calls.
+     *
+     * \param data A non-owning reference to the argument data of each call
+     * \param userContexts The user contexts of the calls, which are reobtained when receiving the call results.
+     * Either empty, or exactly one user context per call.
+     *
+     * \throw SilKit::SilKitError If the number of user contexts does not match the number of calls.
+     */
+    virtual void CallBatch(Util::Span<const Util::Span<const uint8_t>> data,
+                           Util::Span<void* const> userContexts = {}) = 0;
 };
 
 } // namespace Rpc
@@ -29,6 +29,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "TypeConversion.hpp"
 
 #include <map>
+#include <vector>
 #include <mutex>
 #include <cstring>
 
@@ -67,6 +68,52 @@ try
 CAPI_CATCH_EXCEPTIONS
 
 
+SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_PublishBatch(SilKit_DataPublisher* self,
+                                                               const SilKit_ByteVector* data, size_t numSamples)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(self);
+    ASSERT_VALID_POINTER_PARAMETER(data);
+
+    std::vector<SilKit::Util::Span<const uint8_t>> cppData;
+    cppData.reserve(numSamples);
+    for (size_t i = 0; i < numSamples; ++i)
+    {
+        cppData.emplace_back(SilKit::Util::ToSpan(data[i]));
+    }
+
+    auto cppPublisher = reinterpret_cast<SilKit::Services::PubSub::IDataPublisher*>(self);
+    cppPublisher->PublishBatch(cppData);
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Loan(SilKit_DataPublisher* self, size_t size, uint8_t** outData)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(self);
+    ASSERT_VALID_OUT_PARAMETER(outData);
+
+    auto cppPublisher = reinterpret_cast<SilKit::Services::PubSub::IDataPublisher*>(self);
+    *outData = cppPublisher->Loan(size).data();
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Commit(SilKit_DataPublisher* self)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(self);
+
+    auto cppPublisher = reinterpret_cast<SilKit::Services::PubSub::IDataPublisher*>(self);
+    cppPublisher->Commit();
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
 SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_Create(SilKit_DataSubscriber** outSubscriber,
                                                           SilKit_Participant* participant, const char* controllerName,
                                                           SilKit_DataSpec* dataSpec, void* defaultDataHandlerContext,
@@ -135,3 +182,106 @@ try
     return SilKit_ReturnCode_SUCCESS;
 }
 CAPI_CATCH_EXCEPTIONS
+
+SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_SetDataMessageBatchHandler(
+    SilKit_DataSubscriber* self, void* context, SilKit_DataMessageBatchHandler_t batchHandler)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(self);
+
+    auto cppSubscriber = reinterpret_cast<SilKit::Services::PubSub::IDataSubscriber*>(self);
+    if (batchHandler == nullptr)
+    {
+        // The samples of batches are delivered to the data message handler again
+        cppSubscriber->SetDataMessageBatchHandler(nullptr);
+        return SilKit_ReturnCode_SUCCESS;
+    }
+
+    cppSubscriber->SetDataMessageBatchHandler(
+        [batchHandler, context](SilKit::Services::PubSub::IDataSubscriber* cppSubscriberHandler,
+                                const SilKit::Services::PubSub::DataMessageBatchEvent& cppDataMessageBatchEvent) {
+        auto* cSubscriber = reinterpret_cast<SilKit_DataSubscriber*>(cppSubscriberHandler);
+        std::vector<SilKit_ByteVector> cData;
+        cData.reserve(cppDataMessageBatchEvent.data.size());
+        for (const auto& sample : cppDataMessageBatchEvent.data)
+        {
+            cData.push_back(SilKit::Util::ToSilKitByteVector(sample));
+        }
+
+        SilKit_DataMessageBatchEvent cDataMessageBatchEvent;
+        SilKit_Struct_Init(SilKit_DataMessageBatchEvent, cDataMessageBatchEvent);
+        cDataMessageBatchEvent.timestamp = cppDataMessageBatchEvent.timestamp.count();
+        cDataMessageBatchEvent.numSamples = cData.size();
+        cDataMessageBatchEvent.data = cData.data();
+
+        batchHandler(context, cSubscriber, &cDataMessageBatchEvent);
+    });
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_EnableReceiveQueue(
+    SilKit_DataSubscriber* self, size_t capacity, SilKit_ReceiveQueueOverflowPolicy overflowPolicy)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(self);
+
+    auto cppSubscriber = reinterpret_cast<SilKit::Services::PubSub::IDataSubscriber*>(self);
+    cppSubscriber->EnableReceiveQueue(
+        capacity, static_cast<SilKit::Services::PubSub::ReceiveQueueOverflowPolicy>(overflowPolicy));
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_TryTake(SilKit_DataSubscriber* self,
+                                                           SilKit_DataMessageEvent* outDataMessageEvent,
+                                                           SilKit_Bool* outTaken)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(self);
+    ASSERT_VALID_OUT_PARAMETER(outDataMessageEvent);
+    ASSERT_VALID_OUT_PARAMETER(outTaken);
+
+    auto cppSubscriber = reinterpret_cast<SilKit::Services::PubSub::IDataSubscriber*>(self);
+    SilKit::Services::PubSub::DataMessageEvent cppDataMessageEvent;
+    *outTaken = cppSubscriber->TryTake(cppDataMessageEvent) ? SilKit_True : SilKit_False;
+    if (*outTaken == SilKit_True)
+    {
+        uint8_t* payloadPointer = nullptr;
+        if (cppDataMessageEvent.data.size() > 0)
+        {
+            payloadPointer = (uint8_t*)&(cppDataMessageEvent.data[0]);
+        }
+        SilKit_Struct_Init(SilKit_DataMessageEvent, *outDataMessageEvent);
+        outDataMessageEvent->timestamp = cppDataMessageEvent.timestamp.count();
+        outDataMessageEvent->data = {payloadPointer, cppDataMessageEvent.data.size()};
+    }
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_TakeAll(SilKit_DataSubscriber* self, void* context,
+                                                           SilKit_DataMessageHandler_t dataHandler)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(self);
+    ASSERT_VALID_HANDLER_PARAMETER(dataHandler);
+
+    auto cppSubscriber = reinterpret_cast<SilKit::Services::PubSub::IDataSubscriber*>(self);
+    for (const auto& cppDataMessageEvent : cppSubscriber->TakeAll())
+    {
+        uint8_t* payloadPointer = nullptr;
+        if (cppDataMessageEvent.data.size() > 0)
+        {
+            payloadPointer = (uint8_t*)&(cppDataMessageEvent.data[0]);
+        }
+        SilKit_DataMessageEvent cDataMessageEvent;
+        SilKit_Struct_Init(SilKit_DataMessageEvent, cDataMessageEvent);
+        cDataMessageEvent.timestamp = cppDataMessageEvent.timestamp.count();
+        cDataMessageEvent.data = {payloadPointer, cppDataMessageEvent.data.size()};
+
+        dataHandler(context, self, &cDataMessageEvent);
+    }
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
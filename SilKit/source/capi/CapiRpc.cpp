@@ -34,6 +34,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <map>
 #include <mutex>
 #include <cstring>
+#include <vector>
 
 
 namespace {
@@ -175,6 +176,33 @@ try
 CAPI_CATCH_EXCEPTIONS
 
 
+SilKit_ReturnCode SilKitCALL SilKit_RpcClient_CallBatch(SilKit_RpcClient* self, const SilKit_ByteVector* argumentData,
+                                                        size_t numCalls, void* const* userContexts)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(self);
+    ASSERT_VALID_POINTER_PARAMETER(argumentData);
+
+    std::vector<SilKit::Util::Span<const uint8_t>> cppArgumentData;
+    cppArgumentData.reserve(numCalls);
+    for (size_t i = 0; i < numCalls; ++i)
+    {
+        cppArgumentData.emplace_back(SilKit::Util::ToSpan(argumentData[i]));
+    }
+
+    SilKit::Util::Span<void* const> cppUserContexts;
+    if (userContexts != nullptr)
+    {
+        cppUserContexts = SilKit::Util::Span<void* const>{userContexts, numCalls};
+    }
+
+    auto cppClient = reinterpret_cast<SilKit::Services::Rpc::IRpcClient*>(self);
+    cppClient->CallBatch(cppArgumentData, cppUserContexts);
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
 SilKit_ReturnCode SilKitCALL SilKit_RpcClient_SetCallResultHandler(SilKit_RpcClient* self, void* context,
                                                                    SilKit_RpcCallResultHandler_t handler)
 try
@@ -55,12 +55,21 @@ class MockDataPublisher : public SilKit::Services::PubSub::IDataPublisher
 {
 public:
     MOCK_METHOD(void, Publish, (SilKit::Util::Span<const uint8_t> data), (override));
+    MOCK_METHOD(void, PublishBatch, (SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> data), (override));
+    MOCK_METHOD(SilKit::Util::Span<uint8_t>, Loan, (size_t size), (override));
+    MOCK_METHOD(void, Commit, (), (override));
 };
 
 class MockDataSubscriber : public SilKit::Services::PubSub::IDataSubscriber
 {
 public:
     MOCK_METHOD1(SetDataMessageHandler, void(DataMessageHandler callback));
+    MOCK_METHOD(void, SetDataMessageBatchHandler, (SilKit::Services::PubSub::DataMessageBatchHandler callback),
+                (override));
+    MOCK_METHOD(void, EnableReceiveQueue,
+                (size_t capacity, SilKit::Services::PubSub::ReceiveQueueOverflowPolicy overflowPolicy), (override));
+    MOCK_METHOD(bool, TryTake, (SilKit::Services::PubSub::DataMessageEvent & dataMessageEvent), (override));
+    MOCK_METHOD(std::vector<SilKit::Services::PubSub::DataMessageEvent>, TakeAll, (), (override));
 };
 
 class MockParticipant : public SilKit::Core::Tests::DummyParticipant
@@ -148,6 +157,11 @@ void SilKitCALL DefaultDataHandler(void* /*context*/, SilKit_DataSubscriber* /*s
 {
 }
 
+void SilKitCALL DefaultDataBatchHandler(void* /*context*/, SilKit_DataSubscriber* /*subscriber*/,
+                                        const SilKit_DataMessageBatchEvent* /*dataMessageBatchEvent*/)
+{
+}
+
 TEST_F(Test_CapiData, data_publisher_function_mapping)
 {
     SilKit_ReturnCode returnCode;
@@ -169,6 +183,23 @@ TEST_F(Test_CapiData, data_publisher_function_mapping)
     EXPECT_CALL(mockDataPublisher, Publish(testing::_)).Times(testing::Exactly(1));
     returnCode = SilKit_DataPublisher_Publish((SilKit_DataPublisher*)&mockDataPublisher, &data);
     EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+
+    SilKit_ByteVector batch[2] = {{0, 0}, {0, 0}};
+    EXPECT_CALL(mockDataPublisher, PublishBatch(testing::SizeIs(2))).Times(testing::Exactly(1));
+    returnCode = SilKit_DataPublisher_PublishBatch((SilKit_DataPublisher*)&mockDataPublisher, batch, 2);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+
+    uint8_t loanedBuffer[4] = {};
+    uint8_t* loanedData{nullptr};
+    EXPECT_CALL(mockDataPublisher, Loan(4))
+        .WillOnce(testing::Return(SilKit::Util::Span<uint8_t>{loanedBuffer, sizeof(loanedBuffer)}));
+    returnCode = SilKit_DataPublisher_Loan((SilKit_DataPublisher*)&mockDataPublisher, 4, &loanedData);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+    EXPECT_EQ(loanedData, loanedBuffer);
+
+    EXPECT_CALL(mockDataPublisher, Commit()).Times(testing::Exactly(1));
+    returnCode = SilKit_DataPublisher_Commit((SilKit_DataPublisher*)&mockDataPublisher);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
 }
 
 TEST_F(Test_CapiData, data_subscriber_function_mapping)
@@ -192,6 +223,146 @@ TEST_F(Test_CapiData, data_subscriber_function_mapping)
     returnCode = SilKit_DataSubscriber_SetDataMessageHandler((SilKit_DataSubscriber*)&mockDataSubscriber, nullptr,
                                                              &DefaultDataHandler);
     EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+
+    EXPECT_CALL(mockDataSubscriber, SetDataMessageBatchHandler(testing::_)).Times(testing::Exactly(1));
+    returnCode = SilKit_DataSubscriber_SetDataMessageBatchHandler((SilKit_DataSubscriber*)&mockDataSubscriber,
+                                                                  nullptr, &DefaultDataBatchHandler);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+
+    EXPECT_CALL(mockDataSubscriber,
+                EnableReceiveQueue(8, SilKit::Services::PubSub::ReceiveQueueOverflowPolicy::DropNewest))
+        .Times(testing::Exactly(1));
+    returnCode = SilKit_DataSubscriber_EnableReceiveQueue((SilKit_DataSubscriber*)&mockDataSubscriber, 8,
+                                                          SilKit_ReceiveQueueOverflowPolicy_DropNewest);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+
+    EXPECT_CALL(mockDataSubscriber, TryTake(testing::_)).WillOnce(testing::Return(false));
+    SilKit_DataMessageEvent dataMessageEvent;
+    SilKit_Bool taken{SilKit_True};
+    returnCode =
+        SilKit_DataSubscriber_TryTake((SilKit_DataSubscriber*)&mockDataSubscriber, &dataMessageEvent, &taken);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+    EXPECT_EQ(taken, SilKit_False);
+
+    EXPECT_CALL(mockDataSubscriber, TakeAll()).Times(testing::Exactly(1));
+    returnCode =
+        SilKit_DataSubscriber_TakeAll((SilKit_DataSubscriber*)&mockDataSubscriber, nullptr, &DefaultDataHandler);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+}
+
+TEST_F(Test_CapiData, data_subscriber_content_filters_are_passed_on)
+{
+    SilKit_DataSubscriber* subscriber;
+
+    uint8_t value[2] = {1, 2};
+    uint8_t mask[2] = {0xff, 0x0f};
+    SilKit_DataContentFilter contentFilters[2] = {{3, {value, 2}, {nullptr, 0}}, {0, {value, 2}, {mask, 2}}};
+
+    SilKit_DataSpec dataSpec;
+    SilKit_Struct_Init(SilKit_DataSpec, dataSpec);
+    dataSpec.topic = "TopicA";
+    dataSpec.mediaType = "text/json";
+    dataSpec.labelList.numLabels = 0;
+    dataSpec.labelList.labels = nullptr;
+    dataSpec.contentFilterList.numContentFilters = 2;
+    dataSpec.contentFilterList.contentFilters = contentFilters;
+
+    SilKit::Services::PubSub::PubSubSpec cppDataSpec;
+    EXPECT_CALL(mockParticipant, CreateDataSubscriber("subscriber", testing::_, testing::_))
+        .WillOnce(testing::DoAll(testing::SaveArg<1>(&cppDataSpec), testing::Return(nullptr)));
+    auto returnCode = SilKit_DataSubscriber_Create(&subscriber, (SilKit_Participant*)&mockParticipant, "subscriber",
+                                                   &dataSpec, nullptr, &DefaultDataHandler);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+
+    const auto& cppContentFilters = cppDataSpec.ContentFilters();
+    ASSERT_EQ(cppContentFilters.size(), 2u);
+    EXPECT_EQ(cppContentFilters[0].offset, 3u);
+    EXPECT_EQ(cppContentFilters[0].value, (std::vector<uint8_t>{1, 2}));
+    EXPECT_TRUE(cppContentFilters[0].mask.empty());
+    EXPECT_EQ(cppContentFilters[1].offset, 0u);
+    EXPECT_EQ(cppContentFilters[1].mask, (std::vector<uint8_t>{0xff, 0x0f}));
+}
+
+TEST_F(Test_CapiData, data_subscriber_take)
+{
+    SilKit_ReturnCode returnCode;
+
+    std::vector<uint8_t> payload{1, 2, 3};
+    SilKit::Services::PubSub::DataMessageEvent cppDataMessageEvent{std::chrono::nanoseconds{42}, payload};
+
+    EXPECT_CALL(mockDataSubscriber, TryTake(testing::_))
+        .WillOnce(testing::DoAll(testing::SetArgReferee<0>(cppDataMessageEvent), testing::Return(true)));
+    SilKit_DataMessageEvent dataMessageEvent;
+    SilKit_Bool taken{SilKit_False};
+    returnCode =
+        SilKit_DataSubscriber_TryTake((SilKit_DataSubscriber*)&mockDataSubscriber, &dataMessageEvent, &taken);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+    EXPECT_EQ(taken, SilKit_True);
+    EXPECT_EQ(dataMessageEvent.timestamp, 42u);
+    // The payload is not copied
+    EXPECT_EQ(dataMessageEvent.data.data, payload.data());
+    EXPECT_EQ(dataMessageEvent.data.size, payload.size());
+
+    EXPECT_CALL(mockDataSubscriber, TakeAll())
+        .WillOnce(testing::Return(
+            std::vector<SilKit::Services::PubSub::DataMessageEvent>{cppDataMessageEvent, cppDataMessageEvent}));
+    std::vector<SilKit_DataMessageEvent> takenEvents;
+    returnCode = SilKit_DataSubscriber_TakeAll(
+        (SilKit_DataSubscriber*)&mockDataSubscriber, &takenEvents,
+        [](void* context, SilKit_DataSubscriber*, const SilKit_DataMessageEvent* dataMessageEvent) {
+        static_cast<std::vector<SilKit_DataMessageEvent>*>(context)->push_back(*dataMessageEvent);
+    });
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+    ASSERT_EQ(takenEvents.size(), 2u);
+    EXPECT_EQ(takenEvents[1].data.data, payload.data());
+}
+
+TEST_F(Test_CapiData, data_subscriber_batch_handler)
+{
+    std::vector<uint8_t> payload1{1, 2, 3};
+    std::vector<uint8_t> payload2{4};
+    std::vector<SilKit::Util::Span<const uint8_t>> samples{payload1, payload2};
+
+    SilKit::Services::PubSub::DataMessageBatchHandler cppBatchHandler;
+    EXPECT_CALL(mockDataSubscriber, SetDataMessageBatchHandler(testing::_))
+        .WillOnce(testing::SaveArg<0>(&cppBatchHandler));
+
+    struct Received
+    {
+        SilKit_NanosecondsTime timestamp{};
+        std::vector<SilKit_ByteVector> data;
+    } received;
+    auto returnCode = SilKit_DataSubscriber_SetDataMessageBatchHandler(
+        (SilKit_DataSubscriber*)&mockDataSubscriber, &received,
+        [](void* context, SilKit_DataSubscriber*, const SilKit_DataMessageBatchEvent* dataMessageBatchEvent) {
+        auto* received = static_cast<Received*>(context);
+        received->timestamp = dataMessageBatchEvent->timestamp;
+        received->data.assign(dataMessageBatchEvent->data,
+                              dataMessageBatchEvent->data + dataMessageBatchEvent->numSamples);
+    });
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+
+    ASSERT_TRUE(cppBatchHandler);
+    cppBatchHandler(&mockDataSubscriber, {std::chrono::nanoseconds{42}, samples});
+    EXPECT_EQ(received.timestamp, 42u);
+    ASSERT_EQ(received.data.size(), 2u);
+    // The payloads are not copied
+    EXPECT_EQ(received.data[0].data, payload1.data());
+    EXPECT_EQ(received.data[0].size, payload1.size());
+    EXPECT_EQ(received.data[1].data, payload2.data());
+    EXPECT_EQ(received.data[1].size, payload2.size());
+}
+
+TEST_F(Test_CapiData, data_subscriber_batch_handler_can_be_cleared)
+{
+    SilKit::Services::PubSub::DataMessageBatchHandler cppBatchHandler = [](auto&&...) {};
+    EXPECT_CALL(mockDataSubscriber, SetDataMessageBatchHandler(testing::_))
+        .WillOnce(testing::SaveArg<0>(&cppBatchHandler));
+
+    auto returnCode = SilKit_DataSubscriber_SetDataMessageBatchHandler((SilKit_DataSubscriber*)&mockDataSubscriber,
+                                                                       nullptr, nullptr);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+    EXPECT_FALSE(cppBatchHandler);
 }
 
 TEST_F(Test_CapiData, data_publisher_bad_parameters)
@@ -224,6 +395,22 @@ TEST_F(Test_CapiData, data_publisher_bad_parameters)
 
     returnCode = SilKit_DataPublisher_Publish((SilKit_DataPublisher*)&mockDataPublisher, nullptr);
     EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataPublisher_PublishBatch(nullptr, &data, 1);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataPublisher_PublishBatch((SilKit_DataPublisher*)&mockDataPublisher, nullptr, 1);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    uint8_t* loanedData{nullptr};
+    returnCode = SilKit_DataPublisher_Loan(nullptr, 4, &loanedData);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataPublisher_Loan((SilKit_DataPublisher*)&mockDataPublisher, 4, nullptr);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataPublisher_Commit(nullptr);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
 }
 
 TEST_F(Test_CapiData, data_subscriber_bad_parameters)
@@ -259,6 +446,31 @@ TEST_F(Test_CapiData, data_subscriber_bad_parameters)
     returnCode = SilKit_DataSubscriber_SetDataMessageHandler((SilKit_DataSubscriber*)&mockDataSubscriber,
                                                              dummyContextPtr, nullptr);
     EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataSubscriber_SetDataMessageBatchHandler(nullptr, dummyContextPtr, &DefaultDataBatchHandler);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataSubscriber_EnableReceiveQueue(nullptr, 8, SilKit_ReceiveQueueOverflowPolicy_DropOldest);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    SilKit_DataMessageEvent dataMessageEvent;
+    SilKit_Bool taken;
+    returnCode = SilKit_DataSubscriber_TryTake(nullptr, &dataMessageEvent, &taken);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataSubscriber_TryTake((SilKit_DataSubscriber*)&mockDataSubscriber, nullptr, &taken);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode =
+        SilKit_DataSubscriber_TryTake((SilKit_DataSubscriber*)&mockDataSubscriber, &dataMessageEvent, nullptr);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_DataSubscriber_TakeAll(nullptr, dummyContextPtr, &DefaultDataHandler);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode =
+        SilKit_DataSubscriber_TakeAll((SilKit_DataSubscriber*)&mockDataSubscriber, dummyContextPtr, nullptr);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
 }
 
 TEST_F(Test_CapiData, data_publisher_publish)
@@ -73,6 +73,7 @@ constexpr uint64_t allSilkidIds[] = {
     SilKit_LinGoToSleepEvent_STRUCT_VERSION,
     SilKit_LinWakeupEvent_STRUCT_VERSION,
     SilKit_DataMessageEvent_STRUCT_VERSION,
+    SilKit_DataMessageBatchEvent_STRUCT_VERSION,
     SilKit_DataSpec_STRUCT_VERSION,
     SilKit_RpcSpec_STRUCT_VERSION,
     SilKit_RpcCallEvent_STRUCT_VERSION,
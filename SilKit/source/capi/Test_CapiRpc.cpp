@@ -58,6 +58,10 @@ public:
     MOCK_METHOD(void, CallWithTimeout,
                 (SilKit::Util::Span<const uint8_t> data, std::chrono::nanoseconds timeout, void* userContext),
                 (override));
+    MOCK_METHOD(void, CallBatch,
+                (SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> data,
+                 SilKit::Util::Span<void* const> userContexts),
+                (override));
 
     MOCK_METHOD1(SetCallResultHandler, void(RpcCallResultHandler handler));
 };
@@ -157,6 +161,29 @@ TEST_F(Test_CapiRpc, rpc_client_function_mapping)
         .Times(testing::Exactly(1));
     returnCode = SilKit_RpcClient_CallWithTimeout((SilKit_RpcClient*)&mockRpcClient, &data, 123456, userContext);
     EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+
+    SilKit_ByteVector batchData[2] = {data, data};
+    void* const batchUserContexts[2] = {userContext, nullptr};
+
+    EXPECT_CALL(mockRpcClient, CallBatch(testing::_, testing::_))
+        .WillOnce([&batchUserContexts](SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> data,
+                                       SilKit::Util::Span<void* const> userContexts) {
+        EXPECT_EQ(data.size(), 2u);
+        ASSERT_EQ(userContexts.size(), 2u);
+        EXPECT_EQ(userContexts[0], batchUserContexts[0]);
+        EXPECT_EQ(userContexts[1], batchUserContexts[1]);
+    });
+    returnCode = SilKit_RpcClient_CallBatch((SilKit_RpcClient*)&mockRpcClient, batchData, 2, batchUserContexts);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
+
+    EXPECT_CALL(mockRpcClient, CallBatch(testing::_, testing::_))
+        .WillOnce([](SilKit::Util::Span<const SilKit::Util::Span<const uint8_t>> data,
+                     SilKit::Util::Span<void* const> userContexts) {
+        EXPECT_EQ(data.size(), 2u);
+        EXPECT_TRUE(userContexts.empty());
+    });
+    returnCode = SilKit_RpcClient_CallBatch((SilKit_RpcClient*)&mockRpcClient, batchData, 2, nullptr);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_SUCCESS);
 }
 
 TEST_F(Test_CapiRpc, rpc_server_function_mapping)
@@ -234,6 +261,12 @@ TEST_F(Test_CapiRpc, rpc_client_bad_parameters)
 
     returnCode = SilKit_RpcClient_CallWithTimeout((SilKit_RpcClient*)&mockRpcClient, nullptr, 987654321, userContext);
     EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_RpcClient_CallBatch(nullptr, &data, 1, nullptr);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
+
+    returnCode = SilKit_RpcClient_CallBatch((SilKit_RpcClient*)&mockRpcClient, nullptr, 1, nullptr);
+    EXPECT_EQ(returnCode, SilKit_ReturnCode_BADPARAMETER);
 }
 
 TEST_F(Test_CapiRpc, rpc_server_bad_parameters)
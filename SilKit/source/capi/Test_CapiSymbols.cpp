@@ -51,7 +51,14 @@ TEST(Test_CapiSymbols, DISABLED_link_all_public_symbols)
     (void)SilKit_DataPublisher_Create(nullptr, nullptr, "", nullptr, 0);
     (void)SilKit_DataSubscriber_Create(nullptr, nullptr, "", nullptr, nullptr, nullptr);
     (void)SilKit_DataPublisher_Publish(nullptr, nullptr);
+    (void)SilKit_DataPublisher_Loan(nullptr, 0, nullptr);
+    (void)SilKit_DataPublisher_Commit(nullptr);
+    (void)SilKit_DataPublisher_PublishBatch(nullptr, nullptr, 0);
     (void)SilKit_DataSubscriber_SetDataMessageHandler(nullptr, nullptr, nullptr);
+    (void)SilKit_DataSubscriber_SetDataMessageBatchHandler(nullptr, nullptr, nullptr);
+    (void)SilKit_DataSubscriber_EnableReceiveQueue(nullptr, 0, 0);
+    (void)SilKit_DataSubscriber_TryTake(nullptr, nullptr, nullptr);
+    (void)SilKit_DataSubscriber_TakeAll(nullptr, nullptr, nullptr);
     (void)SilKit_EthernetController_Create(nullptr, nullptr, "", "");
     (void)SilKit_EthernetController_Activate(nullptr);
     (void)SilKit_EthernetController_Deactivate(nullptr);
@@ -135,6 +142,7 @@ TEST(Test_CapiSymbols, DISABLED_link_all_public_symbols)
     (void)SilKit_RpcServer_SetCallHandler(nullptr, nullptr, nullptr);
     (void)SilKit_RpcClient_Create(nullptr, nullptr, "", nullptr, nullptr, nullptr);
     (void)SilKit_RpcClient_Call(nullptr, nullptr, nullptr);
+    (void)SilKit_RpcClient_CallBatch(nullptr, nullptr, 0, nullptr);
     (void)SilKit_RpcClient_SetCallResultHandler(nullptr, nullptr, nullptr);
     (void)SilKit_ReturnCodeToString(nullptr, SilKit_ReturnCode_BADPARAMETER);
     (void)SilKit_Participant_GetLogger(nullptr, nullptr);
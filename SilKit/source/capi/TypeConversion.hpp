@@ -39,6 +39,19 @@ inline void assign(SilKit::Services::PubSub::PubSubSpec& cppPubSubSpec, SilKit_D
         cppPubSubSpec.AddLabel(pubSubSpec->labelList.labels[i].key, pubSubSpec->labelList.labels[i].value,
                                (SilKit::Services::MatchingLabel::Kind)pubSubSpec->labelList.labels[i].kind);
     }
+    if (SK_ID_GET_VERSION(SilKit_Struct_GetId(*pubSubSpec)) >= 2)
+    {
+        for (size_t i = 0; i < pubSubSpec->contentFilterList.numContentFilters; i++)
+        {
+            const auto& contentFilter = pubSubSpec->contentFilterList.contentFilters[i];
+            SilKit::Services::PubSub::DataContentFilter cppContentFilter;
+            cppContentFilter.offset = contentFilter.offset;
+            cppContentFilter.value.assign(contentFilter.value.data,
+                                          contentFilter.value.data + contentFilter.value.size);
+            cppContentFilter.mask.assign(contentFilter.mask.data, contentFilter.mask.data + contentFilter.mask.size);
+            cppPubSubSpec.AddContentFilter(cppContentFilter);
+        }
+    }
 }
 
 inline void assign(SilKit::Services::Rpc::RpcSpec& cppRpcSpec, SilKit_RpcSpec* rpcSpec)
@@ -153,6 +153,8 @@ struct DataPublisher
 
     //! \brief History length of a DataPublisher.
     SilKit::Util::Optional<size_t> history{0};
+    //! Replace data which is not yet sent by newer data of the same publisher
+    bool keepLatest{false};
 
     std::vector<std::string> useTraceSinks;
     Replay replay;
@@ -168,6 +170,8 @@ struct DataSubscriber
 
     std::string name;
     SilKit::Util::Optional<std::string> topic;
+    //! Replace queued data which is not yet taken by newer data of the same publisher
+    bool keepLatest{false};
 
     std::vector<std::string> useTraceSinks;
     Replay replay;
@@ -187,6 +191,8 @@ struct RpcServer
 
     std::string name;
     SilKit::Util::Optional<std::string> functionName;
+    //! Number of worker threads executing the call handler, zero executes it on the I/O thread
+    uint32_t executorThreads{0};
 
     std::vector<std::string> useTraceSinks;
     Replay replay;
@@ -195,6 +201,14 @@ struct RpcServer
 //! \brief Client configuration for the RPC communication service
 struct RpcClient
 {
+    //! \brief Selects the RpcServers a call is sent to
+    enum class DispatchMode
+    {
+        Broadcast, //!< Every matching RpcServer receives the call
+        RoundRobin, //!< One participant with matching RpcServers receives the call, in turns
+        LeastOutstandingCalls, //!< The participant with the fewest unanswered calls receives the call
+    };
+
     static constexpr auto GetNetworkType() -> NetworkType
     {
         return NetworkType::RPC;
@@ -202,6 +216,7 @@ struct RpcClient
 
     std::string name;
     SilKit::Util::Optional<std::string> functionName;
+    DispatchMode dispatchMode{DispatchMode::Broadcast};
 
     std::vector<std::string> useTraceSinks;
     Replay replay;
@@ -268,6 +283,13 @@ struct Extensions
 //  VAsio Middleware
 // ================================================================================
 
+//! \brief A participant of a statically configured peer mesh, and the endpoints it accepts connections on
+struct StaticPeer
+{
+    std::string name;
+    std::vector<std::string> acceptorUris;
+};
+
 struct Middleware
 {
     std::string registryUri{}; //!< Registry URI to connect to (configuration has priority)
@@ -285,6 +307,8 @@ struct Middleware
     bool experimentalRemoteParticipantConnection{true};
     //! Timeout for individual connection attempts (TCP, Local-Domain) and handshakes.
     double connectTimeoutSeconds{5.0};
+    //! Participants that are connected directly, without waiting for the registry to announce them.
+    std::vector<StaticPeer> staticPeers{};
 };
 
 
@@ -297,6 +321,28 @@ struct TimeSynchronization
 {
     double animationFactor{0.0};
     Aggregation enableMessageAggregation{Aggregation::Off};
+    //! Name of the participant that coordinates the time advance. If empty, all synchronized participants exchange
+    //! their next simulation steps with each other.
+    std::string timeAdvanceCoordinator{};
+    //! Time span after each simulation step, in which messages sent during the step do not affect other participants.
+    //! The other participants may run ahead of this participant by up to the lookahead.
+    std::chrono::nanoseconds lookahead{0};
+    //! Time span before each wall clock synchronization point which is busy-waited instead of slept. If not set, a
+    //! platform specific default is used.
+    SilKit::Util::Optional<std::chrono::nanoseconds> wallClockSpinTail{};
+    //! Record the critical participant, and the waiting and execution durations of each simulation step as metrics
+    bool recordCriticalPath{false};
+};
+
+// ================================================================================
+//  ServiceDiscovery
+// ================================================================================
+
+//! \brief Structure that contains experimental ServiceDiscovery settings
+struct ServiceDiscovery
+{
+    //! Only receive discovery events of remote publishers and RPC endpoints this participant has a counterpart for
+    bool enableInterestFiltering{false};
 };
 
 // ================================================================================
@@ -308,6 +354,7 @@ struct Experimental
 {
     TimeSynchronization timeSynchronization;
     Metrics metrics;
+    ServiceDiscovery serviceDiscovery;
 };
 
 // ================================================================================
@@ -364,9 +411,11 @@ bool operator==(const Tracing& lhs, const Tracing& rhs);
 bool operator==(const MetricsSink& lhs, const MetricsSink& rhs);
 bool operator==(const Metrics& lhs, const Metrics& rhs);
 bool operator==(const Extensions& lhs, const Extensions& rhs);
+bool operator==(const StaticPeer& lhs, const StaticPeer& rhs);
 bool operator==(const Middleware& lhs, const Middleware& rhs);
 bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfiguration& rhs);
 bool operator==(const TimeSynchronization& lhs, const TimeSynchronization& rhs);
+bool operator==(const ServiceDiscovery& lhs, const ServiceDiscovery& rhs);
 bool operator==(const Experimental& lhs, const Experimental& rhs);
 
 bool operator<(const MetricsSink& lhs, const MetricsSink& rhs);
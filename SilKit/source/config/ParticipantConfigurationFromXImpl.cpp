@@ -25,6 +25,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <fstream>
 #include <sstream>
 #include <iomanip>
+#include <limits>
 #include <set>
 #include <utility>
 #include <vector>
@@ -49,6 +50,7 @@ using ConfigInclude = std::pair<std::string, SilKit::Config::v1::ParticipantConf
 struct MiddlewareCache
 {
     std::vector<std::string> acceptorUris;
+    std::vector<StaticPeer> staticPeers;
     SilKit::Util::Optional<std::string> registryUri;
     SilKit::Util::Optional<double> connectTimeoutSeconds;
     SilKit::Util::Optional<int> connectAttempts;
@@ -75,6 +77,10 @@ struct TimeSynchronizationCache
 {
     SilKit::Util::Optional<double> animationFactor;
     SilKit::Util::Optional<Aggregation> enableMessageAggregation;
+    SilKit::Util::Optional<std::string> timeAdvanceCoordinator;
+    SilKit::Util::Optional<uint64_t> lookaheadNanoseconds;
+    SilKit::Util::Optional<uint64_t> wallClockSpinTailNanoseconds;
+    SilKit::Util::Optional<bool> recordCriticalPath;
 };
 
 struct MetricsCache
@@ -85,10 +91,16 @@ struct MetricsCache
     SilKit::Util::Optional<MetricsSink> remoteSink;
 };
 
+struct ServiceDiscoveryCache
+{
+    SilKit::Util::Optional<bool> enableInterestFiltering;
+};
+
 struct ExperimentalCache
 {
     TimeSynchronizationCache timeSynchronizationCache;
     MetricsCache metricsCache;
+    ServiceDiscoveryCache serviceDiscoveryCache;
 };
 
 struct ConfigIncludeData
@@ -302,6 +314,15 @@ void CacheMiddleware(const YAML::Node& root, MiddlewareCache& cache)
         optional_decode(cache.acceptorUris, root, "AcceptorUris");
     }
 
+    if (root["StaticPeers"])
+    {
+        if (cache.staticPeers.size() > 0)
+        {
+            throw SilKit::ConfigurationError{"StaticPeers already defined!"};
+        }
+        optional_decode(cache.staticPeers, root, "StaticPeers");
+    }
+
     PopulateCacheField(root, "Middleware", "ConnectAttempts", cache.connectAttempts);
     PopulateCacheField(root, "Middleware", "TcpNoDelay", cache.tcpNoDelay);
     PopulateCacheField(root, "Middleware", "TcpQuickAck", cache.tcpQuickAck);
@@ -377,6 +398,16 @@ void CacheTimeSynchronization(const YAML::Node& root, TimeSynchronizationCache&
 {
     PopulateCacheField(root, "TimeSynchronization", "AnimationFactor", cache.animationFactor);
     PopulateCacheField(root, "TimeSynchronization", "EnableMessageAggregation", cache.enableMessageAggregation);
+    PopulateCacheField(root, "TimeSynchronization", "TimeAdvanceCoordinator", cache.timeAdvanceCoordinator);
+    PopulateCacheField(root, "TimeSynchronization", "LookaheadNanoseconds", cache.lookaheadNanoseconds);
+    PopulateCacheField(root, "TimeSynchronization", "WallClockSpinTailNanoseconds",
+                       cache.wallClockSpinTailNanoseconds);
+    PopulateCacheField(root, "TimeSynchronization", "RecordCriticalPath", cache.recordCriticalPath);
+}
+
+void CacheServiceDiscovery(const YAML::Node& root, ServiceDiscoveryCache& cache)
+{
+    PopulateCacheField(root, "ServiceDiscovery", "EnableInterestFiltering", cache.enableInterestFiltering);
 }
 
 void CacheMetrics(const YAML::Node& root, MetricsCache& cache)
@@ -439,6 +470,11 @@ void CacheExperimental(const YAML::Node& root, ExperimentalCache& cache)
     {
         CacheMetrics(root["Metrics"], cache.metricsCache);
     }
+
+    if (root["ServiceDiscovery"])
+    {
+        CacheServiceDiscovery(root["ServiceDiscovery"], cache.serviceDiscoveryCache);
+    }
 }
 
 void PopulateCaches(const YAML::Node& config, ConfigIncludeData& configIncludeData)
@@ -532,6 +568,7 @@ void MergeMiddleware(const MiddlewareCache& cache, Middleware& middleware)
     MergeCacheField(cache.connectTimeoutSeconds, middleware.connectTimeoutSeconds);
 
     middleware.acceptorUris = cache.acceptorUris;
+    middleware.staticPeers = cache.staticPeers;
 }
 
 void MergeLogCache(const GlobalLogCache& cache, Logging& logging)
@@ -555,6 +592,29 @@ void MergeTimeSynchronizationCache(const TimeSynchronizationCache& cache, TimeSy
 {
     MergeCacheField(cache.animationFactor, timeSynchronization.animationFactor);
     MergeCacheField(cache.enableMessageAggregation, timeSynchronization.enableMessageAggregation);
+    MergeCacheField(cache.timeAdvanceCoordinator, timeSynchronization.timeAdvanceCoordinator);
+    if (cache.lookaheadNanoseconds.has_value())
+    {
+        if (cache.lookaheadNanoseconds.value()
+            > static_cast<uint64_t>(std::numeric_limits<std::chrono::nanoseconds::rep>::max()))
+        {
+            std::stringstream error_msg;
+            error_msg << "Config element LookaheadNanoseconds (" << cache.lookaheadNanoseconds.value()
+                      << ") for TimeSynchronization exceeds the maximal time point!";
+            throw SilKit::ConfigurationError(error_msg.str());
+        }
+        timeSynchronization.lookahead = std::chrono::nanoseconds{cache.lookaheadNanoseconds.value()};
+    }
+    if (cache.wallClockSpinTailNanoseconds.has_value())
+    {
+        timeSynchronization.wallClockSpinTail = std::chrono::nanoseconds{cache.wallClockSpinTailNanoseconds.value()};
+    }
+    MergeCacheField(cache.recordCriticalPath, timeSynchronization.recordCriticalPath);
+}
+
+void MergeServiceDiscoveryCache(const ServiceDiscoveryCache& cache, ServiceDiscovery& serviceDiscovery)
+{
+    MergeCacheField(cache.enableInterestFiltering, serviceDiscovery.enableInterestFiltering);
 }
 
 void MergeMetricsCache(const MetricsCache& cache, Metrics& metrics)
@@ -578,6 +638,7 @@ void MergeExperimentalCache(const ExperimentalCache& cache, Experimental& experi
 {
     MergeTimeSynchronizationCache(cache.timeSynchronizationCache, experimental.timeSynchronization);
     MergeMetricsCache(cache.metricsCache, experimental.metrics);
+    MergeServiceDiscoveryCache(cache.serviceDiscoveryCache, experimental.serviceDiscovery);
 }
 
 
@@ -731,22 +792,24 @@ bool operator==(const FlexrayController& lhs, const FlexrayController& rhs)
 
 bool operator==(const DataPublisher& lhs, const DataPublisher& rhs)
 {
-    return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay;
+    return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay && lhs.keepLatest == rhs.keepLatest;
 }
 
 bool operator==(const DataSubscriber& lhs, const DataSubscriber& rhs)
 {
-    return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay;
+    return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay && lhs.keepLatest == rhs.keepLatest;
 }
 
 bool operator==(const RpcServer& lhs, const RpcServer& rhs)
 {
-    return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay;
+    return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay
+           && lhs.executorThreads == rhs.executorThreads;
 }
 
 bool operator==(const RpcClient& lhs, const RpcClient& rhs)
 {
-    return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay;
+    return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay
+           && lhs.dispatchMode == rhs.dispatchMode;
 }
 
 bool operator==(const HealthCheck& lhs, const HealthCheck& rhs)
@@ -775,12 +838,18 @@ bool operator==(const Extensions& lhs, const Extensions& rhs)
 }
 
 
+bool operator==(const StaticPeer& lhs, const StaticPeer& rhs)
+{
+    return lhs.name == rhs.name && lhs.acceptorUris == rhs.acceptorUris;
+}
+
 bool operator==(const Middleware& lhs, const Middleware& rhs)
 {
     return lhs.registryUri == rhs.registryUri && lhs.connectAttempts == rhs.connectAttempts
            && lhs.enableDomainSockets == rhs.enableDomainSockets && lhs.tcpNoDelay == rhs.tcpNoDelay
            && lhs.tcpQuickAck == rhs.tcpQuickAck && lhs.tcpReceiveBufferSize == rhs.tcpReceiveBufferSize
-           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris;
+           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris
+           && lhs.staticPeers == rhs.staticPeers;
 }
 
 bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfiguration& rhs)
@@ -795,12 +864,20 @@ bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfigurat
 
 bool operator==(const TimeSynchronization& lhs, const TimeSynchronization& rhs)
 {
-    return lhs.animationFactor == rhs.animationFactor && lhs.enableMessageAggregation == rhs.enableMessageAggregation;
+    return lhs.animationFactor == rhs.animationFactor && lhs.enableMessageAggregation == rhs.enableMessageAggregation
+           && lhs.timeAdvanceCoordinator == rhs.timeAdvanceCoordinator && lhs.lookahead == rhs.lookahead
+           && lhs.wallClockSpinTail == rhs.wallClockSpinTail && lhs.recordCriticalPath == rhs.recordCriticalPath;
+}
+
+bool operator==(const ServiceDiscovery& lhs, const ServiceDiscovery& rhs)
+{
+    return lhs.enableInterestFiltering == rhs.enableInterestFiltering;
 }
 
 bool operator==(const Experimental& lhs, const Experimental& rhs)
 {
-    return lhs.timeSynchronization == rhs.timeSynchronization && lhs.metrics == rhs.metrics;
+    return lhs.timeSynchronization == rhs.timeSynchronization && lhs.metrics == rhs.metrics
+           && lhs.serviceDiscovery == rhs.serviceDiscovery;
 }
 
 bool operator<(const MetricsSink& lhs, const MetricsSink& rhs)
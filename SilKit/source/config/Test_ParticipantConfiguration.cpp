@@ -268,4 +268,16 @@ Metrics:
                  SilKit::ConfigurationError);
 }
 
+TEST_F(Test_ParticipantConfiguration, lookahead_beyond_the_maximal_time_point_fails)
+{
+    constexpr auto configurationString = R"(
+Experimental:
+  TimeSynchronization:
+    LookaheadNanoseconds: 9223372036854775808
+)";
+
+    ASSERT_THROW(SilKit::Config::ParticipantConfigurationFromStringImpl(configurationString),
+                 SilKit::ConfigurationError);
+}
+
 } // anonymous namespace
@@ -158,6 +158,7 @@ FlexrayControllers:
 DataPublishers:
 - Name: Publisher1
   Topic: Temperature
+  KeepLatest: true
   UseTraceSinks:
   - Sink1
 DataSubscribers:
@@ -237,6 +238,7 @@ TEST_F(Test_YamlParser, yaml_complete_configuration)
     EXPECT_TRUE(config.dataPublishers.at(0).name == "Publisher1");
     EXPECT_TRUE(config.dataPublishers.at(0).topic.has_value()
                 && config.dataPublishers.at(0).topic.value() == "Temperature");
+    EXPECT_TRUE(config.dataPublishers.at(0).keepLatest);
 
     EXPECT_TRUE(config.logging.sinks.size() == 1);
     EXPECT_TRUE(config.logging.sinks.at(0).type == Sink::Type::File);
@@ -719,6 +719,7 @@ Node Converter::encode(const DataPublisher& obj)
     node["Name"] = obj.name;
     optional_encode(obj.topic, node, "Topic");
     //optional_encode(obj.history, node, "History");
+    non_default_encode(obj.keepLatest, node, "KeepLatest", defaultObj.keepLatest);
     optional_encode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_encode(obj.replay, node, "Replay");
     return node;
@@ -729,6 +730,7 @@ bool Converter::decode(const Node& node, DataPublisher& obj)
     obj.name = parse_as<std::string>(node["Name"]);
     optional_decode(obj.topic, node, "Topic");
     //optional_decode(obj.history, node, "Replay");
+    optional_decode(obj.keepLatest, node, "KeepLatest");
     optional_decode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_decode(obj.replay, node, "Replay");
     return true;
@@ -741,6 +743,7 @@ Node Converter::encode(const DataSubscriber& obj)
     Node node;
     node["Name"] = obj.name;
     optional_encode(obj.topic, node, "Topic");
+    non_default_encode(obj.keepLatest, node, "KeepLatest", defaultObj.keepLatest);
     optional_encode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_encode(obj.replay, node, "Replay");
     return node;
@@ -750,6 +753,7 @@ bool Converter::decode(const Node& node, DataSubscriber& obj)
 {
     obj.name = parse_as<std::string>(node["Name"]);
     optional_decode(obj.topic, node, "Topic");
+    optional_decode(obj.keepLatest, node, "KeepLatest");
     optional_decode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_decode(obj.replay, node, "Replay");
     return true;
@@ -762,6 +766,7 @@ Node Converter::encode(const RpcServer& obj)
     Node node;
     node["Name"] = obj.name;
     optional_encode(obj.functionName, node, "FunctionName");
+    non_default_encode(obj.executorThreads, node, "ExecutorThreads", defaultObj.executorThreads);
     optional_encode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_encode(obj.replay, node, "Replay");
     return node;
@@ -771,11 +776,56 @@ bool Converter::decode(const Node& node, RpcServer& obj)
 {
     obj.name = parse_as<std::string>(node["Name"]);
     optional_decode_deprecated_alternative(obj.functionName, node, "FunctionName", {"Channel", "RpcChannel"});
+    optional_decode(obj.executorThreads, node, "ExecutorThreads");
     optional_decode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_decode(obj.replay, node, "Replay");
     return true;
 }
 
+template <>
+Node Converter::encode(const RpcClient::DispatchMode& obj)
+{
+    Node node;
+    switch (obj)
+    {
+    case RpcClient::DispatchMode::Broadcast:
+        node = "Broadcast";
+        break;
+    case RpcClient::DispatchMode::RoundRobin:
+        node = "RoundRobin";
+        break;
+    case RpcClient::DispatchMode::LeastOutstandingCalls:
+        node = "LeastOutstandingCalls";
+        break;
+    default:
+        throw ConfigurationError{"Unknown RpcClient DispatchMode"};
+    }
+    return node;
+}
+
+template <>
+bool Converter::decode(const Node& node, RpcClient::DispatchMode& obj)
+{
+    auto&& str = parse_as<std::string>(node);
+    if (str == "Broadcast")
+    {
+        obj = RpcClient::DispatchMode::Broadcast;
+    }
+    else if (str == "RoundRobin")
+    {
+        obj = RpcClient::DispatchMode::RoundRobin;
+    }
+    else if (str == "LeastOutstandingCalls")
+    {
+        obj = RpcClient::DispatchMode::LeastOutstandingCalls;
+    }
+    else
+    {
+        throw ConversionError{node, "Unknown RpcClient::DispatchMode: " + str + "."};
+    }
+    return true;
+}
+
 template <>
 Node Converter::encode(const RpcClient& obj)
 {
@@ -783,6 +833,7 @@ Node Converter::encode(const RpcClient& obj)
     Node node;
     node["Name"] = obj.name;
     optional_encode(obj.functionName, node, "Channel");
+    non_default_encode(obj.dispatchMode, node, "DispatchMode", defaultObj.dispatchMode);
     optional_encode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_encode(obj.replay, node, "Replay");
     return node;
@@ -792,6 +843,7 @@ bool Converter::decode(const Node& node, RpcClient& obj)
 {
     obj.name = parse_as<std::string>(node["Name"]);
     optional_decode_deprecated_alternative(obj.functionName, node, "FunctionName", {"Channel", "RpcChannel"});
+    optional_decode(obj.dispatchMode, node, "DispatchMode");
     optional_decode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_decode(obj.replay, node, "Replay");
     return true;
@@ -1068,6 +1120,22 @@ bool Converter::decode(const Node& node, Extensions& obj)
 }
 
 
+template <>
+Node Converter::encode(const StaticPeer& obj)
+{
+    Node node;
+    node["Name"] = obj.name;
+    node["AcceptorUris"] = obj.acceptorUris;
+    return node;
+}
+template <>
+bool Converter::decode(const Node& node, StaticPeer& obj)
+{
+    obj.name = parse_as<std::string>(node["Name"]);
+    obj.acceptorUris = parse_as<std::vector<std::string>>(node["AcceptorUris"]);
+    return true;
+}
+
 template <>
 Node Converter::encode(const Middleware& obj)
 {
@@ -1086,6 +1154,7 @@ Node Converter::encode(const Middleware& obj)
     non_default_encode(obj.experimentalRemoteParticipantConnection, node, "ExperimentalRemoteParticipantConnection",
                        defaultObj.experimentalRemoteParticipantConnection);
     non_default_encode(obj.connectTimeoutSeconds, node, "ConnectTimeoutSeconds", defaultObj.connectTimeoutSeconds);
+    non_default_encode(obj.staticPeers, node, "StaticPeers", defaultObj.staticPeers);
     return node;
 }
 template <>
@@ -1102,6 +1171,7 @@ bool Converter::decode(const Node& node, Middleware& obj)
     optional_decode(obj.registryAsFallbackProxy, node, "RegistryAsFallbackProxy");
     optional_decode(obj.experimentalRemoteParticipantConnection, node, "ExperimentalRemoteParticipantConnection");
     optional_decode(obj.connectTimeoutSeconds, node, "ConnectTimeoutSeconds");
+    optional_decode(obj.staticPeers, node, "StaticPeers");
     return true;
 }
 
@@ -1150,6 +1220,10 @@ Node Converter::encode(const TimeSynchronization& obj)
     non_default_encode(obj.animationFactor, node, "AnimationFactor", defaultObj.animationFactor);
     non_default_encode(obj.enableMessageAggregation, node, "EnableMessageAggregation",
                        defaultObj.enableMessageAggregation);
+    non_default_encode(obj.timeAdvanceCoordinator, node, "TimeAdvanceCoordinator", defaultObj.timeAdvanceCoordinator);
+    non_default_encode(obj.lookahead, node, "LookaheadNanoseconds", defaultObj.lookahead);
+    optional_encode(obj.wallClockSpinTail, node, "WallClockSpinTailNanoseconds");
+    non_default_encode(obj.recordCriticalPath, node, "RecordCriticalPath", defaultObj.recordCriticalPath);
     return node;
 }
 template <>
@@ -1157,6 +1231,26 @@ bool Converter::decode(const Node& node, TimeSynchronization& obj)
 {
     optional_decode(obj.animationFactor, node, "AnimationFactor");
     optional_decode(obj.enableMessageAggregation, node, "EnableMessageAggregation");
+    optional_decode(obj.timeAdvanceCoordinator, node, "TimeAdvanceCoordinator");
+    optional_decode(obj.lookahead, node, "LookaheadNanoseconds");
+    optional_decode(obj.wallClockSpinTail, node, "WallClockSpinTailNanoseconds");
+    optional_decode(obj.recordCriticalPath, node, "RecordCriticalPath");
+    return true;
+}
+
+template <>
+Node Converter::encode(const ServiceDiscovery& obj)
+{
+    Node node;
+    static const ServiceDiscovery defaultObj;
+    non_default_encode(obj.enableInterestFiltering, node, "EnableInterestFiltering",
+                       defaultObj.enableInterestFiltering);
+    return node;
+}
+template <>
+bool Converter::decode(const Node& node, ServiceDiscovery& obj)
+{
+    optional_decode(obj.enableInterestFiltering, node, "EnableInterestFiltering");
     return true;
 }
 
@@ -1168,6 +1262,7 @@ Node Converter::encode(const Experimental& obj)
     Node node;
     non_default_encode(obj.timeSynchronization, node, "TimeSynchronization", defaultObj.timeSynchronization);
     non_default_encode(obj.metrics, node, "Metrics", defaultObj.metrics);
+    non_default_encode(obj.serviceDiscovery, node, "ServiceDiscovery", defaultObj.serviceDiscovery);
     return node;
 }
 template <>
@@ -1175,6 +1270,7 @@ bool Converter::decode(const Node& node, Experimental& obj)
 {
     optional_decode(obj.timeSynchronization, node, "TimeSynchronization");
     optional_decode(obj.metrics, node, "Metrics");
+    optional_decode(obj.serviceDiscovery, node, "ServiceDiscovery");
     return true;
 }
 
@@ -68,6 +68,7 @@ DEFINE_SILKIT_CONVERT(DataPublisher);
 DEFINE_SILKIT_CONVERT(DataSubscriber);
 DEFINE_SILKIT_CONVERT(RpcServer);
 DEFINE_SILKIT_CONVERT(RpcClient);
+DEFINE_SILKIT_CONVERT(RpcClient::DispatchMode);
 
 DEFINE_SILKIT_CONVERT(HealthCheck);
 
@@ -81,12 +82,14 @@ DEFINE_SILKIT_CONVERT(MetricsSink);
 DEFINE_SILKIT_CONVERT(MetricsSink::Type);
 DEFINE_SILKIT_CONVERT(Metrics);
 
+DEFINE_SILKIT_CONVERT(StaticPeer);
 DEFINE_SILKIT_CONVERT(Middleware);
 
 DEFINE_SILKIT_CONVERT(Extensions);
 
 DEFINE_SILKIT_CONVERT(Experimental);
 DEFINE_SILKIT_CONVERT(TimeSynchronization);
+DEFINE_SILKIT_CONVERT(ServiceDiscovery);
 DEFINE_SILKIT_CONVERT(Aggregation);
 
 DEFINE_SILKIT_CONVERT(ParticipantConfiguration);
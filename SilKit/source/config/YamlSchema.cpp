@@ -157,6 +157,7 @@ auto MakeYamlSchema() -> YamlSchemaElem
          {
              {"Name"},
              {"Topic"},
+             {"KeepLatest"},
              {"UseTraceSinks"},
              replay,
          }},
@@ -164,6 +165,7 @@ auto MakeYamlSchema() -> YamlSchemaElem
          {
              {"Name"},
              {"Topic"},
+             {"KeepLatest"},
              {"UseTraceSinks"},
              replay,
          }},
@@ -171,6 +173,7 @@ auto MakeYamlSchema() -> YamlSchemaElem
          {
              {"Name"},
              {"FunctionName"},
+             {"DispatchMode"},
              {"UseTraceSinks"},
              replay,
          }},
@@ -178,6 +181,7 @@ auto MakeYamlSchema() -> YamlSchemaElem
          {
              {"Name"},
              {"FunctionName"},
+             {"ExecutorThreads"},
              {"UseTraceSinks"},
              replay,
          }},
@@ -202,15 +206,29 @@ auto MakeYamlSchema() -> YamlSchemaElem
              {"RegistryAsFallbackProxy"},
              {"ExperimentalRemoteParticipantConnection"},
              {"ConnectTimeoutSeconds"},
+             {"StaticPeers",
+              {
+                  {"Name"},
+                  {"AcceptorUris"},
+              }},
          }},
         {"Experimental",
          {
-             {"TimeSynchronization", {{"AnimationFactor"}, {"EnableMessageAggregation"}}},
+             {"TimeSynchronization",
+              {
+                  {"AnimationFactor"},
+                  {"EnableMessageAggregation"},
+                  {"TimeAdvanceCoordinator"},
+                  {"LookaheadNanoseconds"},
+                  {"WallClockSpinTailNanoseconds"},
+                  {"RecordCriticalPath"},
+              }},
              {"Metrics",
               {
                   metricsSinks,
                   {"CollectFromRemote"},
               }},
+             {"ServiceDiscovery", {{"EnableInterestFiltering"}}},
          }},
     };
     return yamlSchema;
@@ -149,12 +149,20 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
                          const Services::PubSub::WireDataMessageEvent& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
+                         const Services::PubSub::WireDataMessageBatch& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Rpc::FunctionCall& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::Rpc::FunctionCall&& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
                          const Services::Rpc::FunctionCallResponse& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::Rpc::FunctionCallResponse&& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Rpc::FunctionCallBatch& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, Services::Rpc::FunctionCallBatch&& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
+                         const Services::Rpc::FunctionCallResponseBatch& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
+                         Services::Rpc::FunctionCallResponseBatch&& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from,
                          const Services::Orchestration::NextSimTask& msg) = 0;
@@ -237,6 +245,8 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          const Services::PubSub::WireDataMessageEvent& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
+                         const Services::PubSub::WireDataMessageBatch& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          const Services::Rpc::FunctionCall& msg) = 0;
@@ -246,6 +256,14 @@ public:
                          const Services::Rpc::FunctionCallResponse& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          Services::Rpc::FunctionCallResponse&& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
+                         const Services::Rpc::FunctionCallBatch& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
+                         Services::Rpc::FunctionCallBatch&& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
+                         const Services::Rpc::FunctionCallResponseBatch& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
+                         Services::Rpc::FunctionCallResponseBatch&& msg) = 0;
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName,
                          const Services::Orchestration::NextSimTask& msg) = 0;
@@ -285,12 +303,17 @@ public:
     virtual auto GetRequestReplyService() -> RequestReply::IRequestReplyService* = 0;
     virtual auto GetParticipantRepliesProcedure() -> RequestReply::IParticipantReplies* = 0;
 
-    // Internal DataSubscriber that is only created on a matching data connection
+    // Internal DataSubscriber that is only created on a matching data connection. It is shared by all DataSubscribers of
+    // this participant on the same link, which are added to an existing one instead of creating another one.
     virtual auto CreateDataSubscriberInternal(
         const std::string& topic, const std::string& linkName, const std::string& mediaType,
         const std::vector<SilKit::Services::MatchingLabel>& publisherLabels,
         Services::PubSub::DataMessageHandler callback,
         Services::PubSub::IDataSubscriber* parent) -> Services::PubSub::DataSubscriberInternal* = 0;
+    // Removes a DataSubscriber from the internal DataSubscriber. Returns true if it was the last one, the internal
+    // DataSubscriber is then no longer shared with DataSubscribers matching the same link later on.
+    virtual bool RemoveDataSubscriberInternalParent(Services::PubSub::DataSubscriberInternal* internalSubscriber,
+                                                    Services::PubSub::IDataSubscriber* parent) = 0;
 
     // Internal Rpc server that is only created on a matching rpc connection
     virtual auto CreateRpcServerInternal(
@@ -54,6 +54,7 @@ const std::string supplKeyDataSubscriberMediaType = "PubSub::subMediaType";
 const std::string supplKeyDataSubscriberSubLabels = "PubSub::subLabels";
 const std::string controllerTypeDataSubscriberInternal = "DataSubscriberInternal";
 const std::string supplKeyDataSubscriberInternalParentServiceID = "PubSub::subIntParentServiceId";
+const std::string supplKeyDataSubscriberInternalContentFilters = "PubSub::subIntContentFilters";
 
 // RPC types
 const std::string controllerTypeRpcServer = "RpcServer";
@@ -89,6 +90,12 @@ const std::string controllerTypeOther = "Other";
 // Lifecycle & TimeSync
 const std::string lifecycleIsCoordinated = "LifecycleIsCoordinated";
 const std::string timeSyncActive = "TimeSyncActive";
+const std::string timeSyncLookahead = "TimeSyncLookahead";
+
+// ServiceDiscovery
+// Set to "1" if a participant only wants to receive the discovery events of remote DataPublishers, RpcClients and
+// RpcServerInternals that match one of its own DataSubscribers, RpcServers or RpcClients
+const std::string supplKeyServiceDiscoveryInterestFiltering = "Discovery::interestFiltering";
 
 } // namespace Discovery
 } // namespace Core
@@ -20,14 +20,18 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
+#include <algorithm>
 #include <string>
 #include <sstream>
 #include <map>
+#include <utility>
+#include <vector>
 
 #include "ServiceConfigKeys.hpp"
 #include "Configuration.hpp"
 #include "EndpointAddress.hpp"
 #include "Hash.hpp"
+#include "InternedString.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -121,34 +125,65 @@ private:
                            SilKit::Core::ServiceDescriptor& updatedMsg) -> SilKit::Core::MessageBuffer&;
 
 private:
-    std::string _participantName; //!< name of the participant
+    //! Supplemental data is stored as a flat vector of interned key/value pairs, sorted by the key string.
+    using SupplementalDataItem = std::pair<Util::InternedString, Util::InternedString>;
+    using SupplementalDataItems = std::vector<SupplementalDataItem>;
+
+    inline auto FindSupplementalDataItem(const std::string& key) const -> SupplementalDataItems::const_iterator;
+    inline auto FindSupplementalDataItem(const std::string& key) -> SupplementalDataItems::iterator;
+
+private:
+    Util::InternedString _participantName; //!< name of the participant
     ParticipantId _participantId{0};
     ServiceType _serviceType{ServiceType::Undefined};
-    std::string _networkName; //!< the service's link name
+    Util::InternedString _networkName; //!< the service's link name
     SilKit::Config::NetworkType _networkType{SilKit::Config::NetworkType::Invalid};
-    std::string _serviceName;
+    Util::InternedString _serviceName;
     EndpointId _serviceId{0};
-    SupplementalData _supplementalData;
+    SupplementalDataItems _supplementalData;
 };
 
 //////////////////////////////////////////////////////////////////////
 // Inline Implementations
 //////////////////////////////////////////////////////////////////////
 
+auto ServiceDescriptor::FindSupplementalDataItem(const std::string& key) const
+    -> SupplementalDataItems::const_iterator
+{
+    return std::lower_bound(_supplementalData.begin(), _supplementalData.end(), key,
+                            [](const SupplementalDataItem& item, const std::string& k) {
+        return item.first.Str() < k;
+    });
+}
+
+auto ServiceDescriptor::FindSupplementalDataItem(const std::string& key) -> SupplementalDataItems::iterator
+{
+    return std::lower_bound(_supplementalData.begin(), _supplementalData.end(), key,
+                            [](const SupplementalDataItem& item, const std::string& k) {
+        return item.first.Str() < k;
+    });
+}
+
 bool ServiceDescriptor::GetSupplementalDataItem(const std::string& key, std::string& value) const
 {
-    auto valueIter = _supplementalData.find(key);
-    if (valueIter == _supplementalData.end())
+    auto valueIter = FindSupplementalDataItem(key);
+    if (valueIter == _supplementalData.end() || valueIter->first.Str() != key)
     {
         return false;
     }
-    value = valueIter->second;
+    value = valueIter->second.Str();
     return true;
 }
 
 void ServiceDescriptor::SetSupplementalDataItem(std::string key, std::string val)
 {
-    _supplementalData[key] = std::move(val);
+    auto valueIter = FindSupplementalDataItem(key);
+    if (valueIter != _supplementalData.end() && valueIter->first.Str() == key)
+    {
+        valueIter->second = Util::InternedString{val};
+        return;
+    }
+    _supplementalData.emplace(valueIter, Util::InternedString{key}, Util::InternedString{val});
 }
 
 auto ServiceDescriptor::GetParticipantId() const -> ParticipantId
@@ -163,13 +198,13 @@ void ServiceDescriptor::SetParticipantId(ParticipantId id)
 
 auto ServiceDescriptor::GetParticipantName() const -> const std::string&
 {
-    return _participantName;
+    return _participantName.Str();
 }
 
 void ServiceDescriptor::SetParticipantNameAndComputeId(std::string val)
 {
     _participantId = SilKit::Util::Hash::Hash(val);
-    _participantName = std::move(val);
+    _participantName = Util::InternedString{val};
 }
 
 auto ServiceDescriptor::GetServiceType() const -> SilKit::Core::ServiceType
@@ -184,12 +219,12 @@ void ServiceDescriptor::SetServiceType(SilKit::Core::ServiceType val)
 
 auto ServiceDescriptor::GetNetworkName() const -> const std::string&
 {
-    return _networkName;
+    return _networkName.Str();
 }
 
 void ServiceDescriptor::SetNetworkName(std::string val)
 {
-    _networkName = std::move(val);
+    _networkName = Util::InternedString{val};
 }
 
 auto ServiceDescriptor::GetNetworkType() const -> SilKit::Config::NetworkType
@@ -204,12 +239,12 @@ void ServiceDescriptor::SetNetworkType(SilKit::Config::NetworkType val)
 
 auto ServiceDescriptor::GetServiceName() const -> const std::string&
 {
-    return _serviceName;
+    return _serviceName.Str();
 }
 
 void ServiceDescriptor::SetServiceName(std::string val)
 {
-    _serviceName = std::move(val);
+    _serviceName = Util::InternedString{val};
 }
 
 auto ServiceDescriptor::GetServiceId() const -> SilKit::Core::EndpointId
@@ -224,31 +259,43 @@ void ServiceDescriptor::SetServiceId(SilKit::Core::EndpointId val)
 
 auto ServiceDescriptor::GetSupplementalData() const -> SupplementalData
 {
-    return _supplementalData;
+    SupplementalData supplementalData;
+    for (const auto& item : _supplementalData)
+    {
+        supplementalData.emplace_hint(supplementalData.end(), item.first.Str(), item.second.Str());
+    }
+    return supplementalData;
 }
 
 void ServiceDescriptor::SetSupplementalData(SupplementalData val)
 {
-    _supplementalData = std::move(val);
+    // std::map is ordered by key, so the flat storage ends up sorted as well
+    SupplementalDataItems supplementalData;
+    supplementalData.reserve(val.size());
+    for (const auto& kv : val)
+    {
+        supplementalData.emplace_back(Util::InternedString{kv.first}, Util::InternedString{kv.second});
+    }
+    _supplementalData = std::move(supplementalData);
 }
 
 auto ServiceDescriptor::GetSimulationName() const -> const std::string&
 {
     static const std::string defaultSimulationName;
-    auto it{_supplementalData.find(SilKit::Core::Discovery::simulationName)};
-    if (it == _supplementalData.end())
+    auto it{FindSupplementalDataItem(SilKit::Core::Discovery::simulationName)};
+    if (it == _supplementalData.end() || it->first.Str() != SilKit::Core::Discovery::simulationName)
     {
         return defaultSimulationName;
     }
     else
     {
-        return it->second;
+        return it->second.Str();
     }
 }
 
 void ServiceDescriptor::SetSimulationName(const std::string& simulationName)
 {
-    _supplementalData[SilKit::Core::Discovery::simulationName] = simulationName;
+    SetSupplementalDataItem(SilKit::Core::Discovery::simulationName, simulationName);
 }
 
 //Ctors
@@ -264,8 +311,9 @@ ServiceDescriptor::ServiceDescriptor(std::string participantName, std::string ne
 // operators
 inline bool ServiceDescriptor::operator==(const ServiceDescriptor& rhs) const
 {
-    return GetParticipantId() == rhs.GetParticipantId() && GetNetworkName() == rhs.GetNetworkName()
-           && GetServiceType() == rhs.GetServiceType() && GetServiceId() == rhs.GetServiceId();
+    // interned strings compare by identity, so this does not touch any string data
+    return _participantId == rhs._participantId && _networkName == rhs._networkName
+           && _serviceType == rhs._serviceType && _serviceId == rhs._serviceId;
 }
 
 inline bool ServiceDescriptor::operator!=(const ServiceDescriptor& rhs) const
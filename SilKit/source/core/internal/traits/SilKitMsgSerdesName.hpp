@@ -52,8 +52,11 @@ DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::ParticipantStat
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::WorkflowConfiguration, "WORKFLOWCONFIGURATION");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::NextSimTask, "NEXTSIMTASK");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::PubSub::WireDataMessageEvent, "DATAMESSAGEEVENT");
+DefineSilKitMsgTrait_SerdesName(SilKit::Services::PubSub::WireDataMessageBatch, "DATAMESSAGEBATCH");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Rpc::FunctionCall, "FUNCTIONCALL");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Rpc::FunctionCallResponse, "FUNCTIONCALLRESPONSE");
+DefineSilKitMsgTrait_SerdesName(SilKit::Services::Rpc::FunctionCallBatch, "FUNCTIONCALLBATCH");
+DefineSilKitMsgTrait_SerdesName(SilKit::Services::Rpc::FunctionCallResponseBatch, "FUNCTIONCALLRESPONSEBATCH");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Can::WireCanFrameEvent, "CANFRAMEEVENT");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Can::CanFrameTransmitEvent, "CANFRAMETRANSMITEVENT");
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Can::CanControllerStatus, "CANCONTROLLERSTATUS");
@@ -135,8 +135,11 @@ DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, ParticipantStatus
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, WorkflowConfiguration);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, NextSimTask);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::PubSub, WireDataMessageEvent);
+DefineSilKitMsgTrait_TypeName(SilKit::Services::PubSub, WireDataMessageBatch);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Rpc, FunctionCall);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Rpc, FunctionCallResponse);
+DefineSilKitMsgTrait_TypeName(SilKit::Services::Rpc, FunctionCallBatch);
+DefineSilKitMsgTrait_TypeName(SilKit::Services::Rpc, FunctionCallResponseBatch);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Can, WireCanFrameEvent);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Can, CanFrameTransmitEvent);
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Can, CanControllerStatus);
@@ -172,6 +175,7 @@ DefineSilKitMsgTrait_TypeName(SilKit::Core::RequestReply, RequestReplyCallReturn
 DefineSilKitMsgTrait_HistSize(SilKit::Services::Orchestration, ParticipantStatus, 1);
 DefineSilKitMsgTrait_HistSize(SilKit::Core::Discovery, ParticipantDiscoveryEvent, 1);
 DefineSilKitMsgTrait_HistSize(SilKit::Services::PubSub, WireDataMessageEvent, 1);
+DefineSilKitMsgTrait_HistSize(SilKit::Services::PubSub, WireDataMessageBatch, 1);
 DefineSilKitMsgTrait_HistSize(SilKit::Services::Orchestration, WorkflowConfiguration, 1);
 DefineSilKitMsgTrait_HistSize(SilKit::Services::Lin, WireLinControllerConfig, 1);
 
@@ -51,8 +51,11 @@ DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::ParticipantStatus,
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::WorkflowConfiguration, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::NextSimTask, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::PubSub::WireDataMessageEvent, 1);
+DefineSilKitMsgTrait_Version(SilKit::Services::PubSub::WireDataMessageBatch, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Rpc::FunctionCall, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Rpc::FunctionCallResponse, 1);
+DefineSilKitMsgTrait_Version(SilKit::Services::Rpc::FunctionCallBatch, 1);
+DefineSilKitMsgTrait_Version(SilKit::Services::Rpc::FunctionCallResponseBatch, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Can::WireCanFrameEvent, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Can::CanFrameTransmitEvent, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Can::CanControllerStatus, 1);
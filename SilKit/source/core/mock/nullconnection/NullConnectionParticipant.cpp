@@ -53,6 +53,18 @@ struct NullConnection
     {
     }
 
+    template <class SilKitServiceT>
+    inline void SetKeepLatestForLink(bool /*keepLatest*/, SilKitServiceT* /*service*/)
+    {
+    }
+
+    template <typename SilKitMessageT, class SilKitServiceT>
+    inline void SetReceiverFilterForLink(
+        std::function<bool(const std::string&, const SilKitMessageT&)> /*receiverFilter*/,
+        SilKitServiceT* /*service*/)
+    {
+    }
+
     template <typename SilKitMessageT>
     void SendMsg(const Core::IServiceEndpoint* /*from*/, SilKitMessageT&& /*msg*/)
     {
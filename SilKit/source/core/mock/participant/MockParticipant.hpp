@@ -48,6 +48,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "IParticipantInternal.hpp"
 #include "IServiceDiscovery.hpp"
+#include "MatchingLabelCache.hpp"
 #include "IRequestReplyService.hpp"
 #include "IRequestReplyProcedure.hpp"
 #include "procs/IParticipantReplies.hpp"
@@ -142,6 +143,14 @@ public:
                 (override));
     MOCK_METHOD(std::vector<ServiceDescriptor>, GetServices, (), (const, override));
     MOCK_METHOD(void, OnParticpantRemoval, (const std::string& participantName), (override));
+
+    auto GetMatchingLabels(const std::string& serializedLabels)
+        -> const std::vector<SilKit::Services::MatchingLabel>& override
+    {
+        return labelCache.Get(serializedLabels);
+    }
+
+    Discovery::MatchingLabelCache labelCache;
 };
 
 class MockRequestReplyService : public RequestReply::IRequestReplyService
@@ -200,6 +209,12 @@ class DummyMetricsManager : public IMetricsManager
         void Add(const std::string&) override {}
     };
 
+    class DummyEventListMetric : public IEventListMetric
+    {
+    public:
+        void Add(const std::string&) override {}
+    };
+
 public:
     auto GetCounter(const std::string& name) -> ICounterMetric* override
     {
@@ -231,12 +246,23 @@ public:
         return &(it->second);
     }
 
+    auto GetEventList(const std::string& name) -> IEventListMetric* override
+    {
+        auto it = _eventLists.find(name);
+        if (it == _eventLists.end())
+        {
+            it = _eventLists.emplace().first;
+        }
+        return &(it->second);
+    }
+
     void SubmitUpdates() override {}
 
 private:
     std::unordered_map<std::string, DummyCounterMetric> _counters;
     std::unordered_map<std::string, DummyStatisticMetric> _statistics;
     std::unordered_map<std::string, DummyStringListMetric> _stringLists;
+    std::unordered_map<std::string, DummyEventListMetric> _eventLists;
 };
 
 class DummyParticipant : public IParticipantInternal
@@ -290,6 +316,11 @@ public:
     {
         return nullptr;
     }
+    bool RemoveDataSubscriberInternalParent(Services::PubSub::DataSubscriberInternal* /*internalSubscriber*/,
+                                            Services::PubSub::IDataSubscriber* /*parent*/) override
+    {
+        return false;
+    }
 
     auto CreateRpcClient(const std::string& /*controllerName*/, const SilKit::Services::Rpc::RpcSpec& /*dataSpec*/,
                          SilKit::Services::Rpc::RpcCallResultHandler /*handler*/)
@@ -402,11 +433,16 @@ public:
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Lin::LinWakeupPulse& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::PubSub::WireDataMessageEvent& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const Services::PubSub::WireDataMessageBatch& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Rpc::FunctionCall& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, Services::Rpc::FunctionCall&& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Rpc::FunctionCallResponse& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, Services::Rpc::FunctionCallResponse&& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const Services::Rpc::FunctionCallBatch& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, Services::Rpc::FunctionCallBatch&& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const Services::Rpc::FunctionCallResponseBatch& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, Services::Rpc::FunctionCallResponseBatch&& /*msg*/) override {}
 
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Orchestration::NextSimTask& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Orchestration::ParticipantStatus& /*msg*/) override
@@ -543,6 +579,10 @@ public:
                  const Services::PubSub::WireDataMessageEvent& /*msg*/) override
     {
     }
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
+                 const Services::PubSub::WireDataMessageBatch& /*msg*/) override
+    {
+    }
 
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
                  const Services::Rpc::FunctionCall& /*msg*/) override
@@ -560,6 +600,22 @@ public:
                  Services::Rpc::FunctionCallResponse&& /*msg*/) override
     {
     }
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
+                 const Services::Rpc::FunctionCallBatch& /*msg*/) override
+    {
+    }
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
+                 Services::Rpc::FunctionCallBatch&& /*msg*/) override
+    {
+    }
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
+                 const Services::Rpc::FunctionCallResponseBatch& /*msg*/) override
+    {
+    }
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
+                 Services::Rpc::FunctionCallResponseBatch&& /*msg*/) override
+    {
+    }
 
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/,
                  const Services::Orchestration::NextSimTask& /*msg*/) override
@@ -27,6 +27,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <vector>
 #include <unordered_map>
 #include <map>
+#include <mutex>
 #include <tuple>
 
 #include "silkit/services/all.hpp"
@@ -143,6 +144,8 @@ public:
         const std::vector<SilKit::Services::MatchingLabel>& publisherLabels,
         Services::PubSub::DataMessageHandler callback,
         Services::PubSub::IDataSubscriber* parent) -> Services::PubSub::DataSubscriberInternal* override;
+    bool RemoveDataSubscriberInternalParent(Services::PubSub::DataSubscriberInternal* internalSubscriber,
+                                            Services::PubSub::IDataSubscriber* parent) override;
 
     auto CreateRpcClient(const std::string& canonicalName, const SilKit::Services::Rpc::RpcSpec& dataSpec,
                          Services::Rpc::RpcCallResultHandler handler) -> Services::Rpc::IRpcClient* override;
@@ -223,10 +226,15 @@ public:
     void SendMsg(const SilKit::Core::IServiceEndpoint* from, const VSilKit::MetricsUpdate& msg) override;
 
     void SendMsg(const IServiceEndpoint* from, const Services::PubSub::WireDataMessageEvent& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const Services::PubSub::WireDataMessageBatch& msg) override;
     void SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCall& msg) override;
     void SendMsg(const IServiceEndpoint* from, Services::Rpc::FunctionCall&& msg) override;
     void SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCallResponse& msg) override;
     void SendMsg(const IServiceEndpoint* from, Services::Rpc::FunctionCallResponse&& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCallBatch& msg) override;
+    void SendMsg(const IServiceEndpoint* from, Services::Rpc::FunctionCallBatch&& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCallResponseBatch& msg) override;
+    void SendMsg(const IServiceEndpoint* from, Services::Rpc::FunctionCallResponseBatch&& msg) override;
 
     void SendMsg(const IServiceEndpoint*, const Discovery::ParticipantDiscoveryEvent& msg) override;
     void SendMsg(const IServiceEndpoint*, const Discovery::ServiceDiscoveryEvent& msg) override;
@@ -310,6 +318,8 @@ public:
 
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                  const Services::PubSub::WireDataMessageEvent& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                 const Services::PubSub::WireDataMessageBatch& msg) override;
 
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                  const Services::Rpc::FunctionCall& msg) override;
@@ -319,6 +329,14 @@ public:
                  const Services::Rpc::FunctionCallResponse& msg) override;
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                  Services::Rpc::FunctionCallResponse&& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                 const Services::Rpc::FunctionCallBatch& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                 Services::Rpc::FunctionCallBatch&& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                 const Services::Rpc::FunctionCallResponseBatch& msg) override;
+    void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                 Services::Rpc::FunctionCallResponseBatch&& msg) override;
 
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName,
                  const Discovery::ParticipantDiscoveryEvent& msg) override;
@@ -479,6 +497,10 @@ private:
         ControllerMap<IMsgForMetricsSender>>
         _controllers;
 
+    //! The internal subscribers per publisher link, each shared by all DataSubscribers of this participant matching it
+    std::unordered_map<std::string, Services::PubSub::DataSubscriberInternal*> _sharedDataSubscriberInternals;
+    std::mutex _sharedDataSubscriberInternalsMx;
+
     std::atomic<EndpointId> _localEndpointId{0};
 
     std::unique_ptr<Experimental::NetworkSimulation::NetworkSimulatorInternal> _networkSimulatorInternal;
@@ -107,7 +107,6 @@ Participant<SilKitConnectionT>::Participant(Config::ParticipantConfiguration par
                   _participantId,
                   &_timeProvider,
                   version}
-    , _metricsTimerThread{MakeTimerThread()}
 {
     // NB: do not create the _logger in the initializer list. If participantName is empty,
     //  this will cause a fairly unintuitive exception in spdlog.
@@ -116,6 +115,7 @@ Participant<SilKitConnectionT>::Participant(Config::ParticipantConfiguration par
     dynamic_cast<VSilKit::MetricsProcessor&>(*_metricsProcessor).SetLogger(*_logger);
     dynamic_cast<VSilKit::MetricsManager&>(*_metricsManager).SetLogger(*_logger);
     _connection.SetLogger(_logger.get());
+    _metricsTimerThread = MakeTimerThread();
 
     Logging::Info(_logger.get(), "Creating participant '{}' at '{}', SIL Kit version: {}", GetParticipantName(),
                   _participantConfig.middleware.registryUri, Version::StringImpl());
@@ -444,15 +444,46 @@ auto Participant<SilKitConnectionT>::CreateDataSubscriberInternal(
     Services::PubSub::DataMessageHandler defaultHandler,
     Services::PubSub::IDataSubscriber* parent) -> Services::PubSub::DataSubscriberInternal*
 {
+    auto parentDataSubscriber = dynamic_cast<Services::PubSub::DataSubscriber*>(parent);
+
+    // All DataSubscribers of this participant that match a publisher receive its data through a single internal
+    // subscriber on its link, if they use the same content filters. Only DataSubscribers replaying received data keep
+    // their own internal subscriber.
+    const bool isShared = parentDataSubscriber != nullptr
+                          && parentDataSubscriber->GetConfig().replay.useTraceSource.empty();
+
+    std::vector<Services::PubSub::DataContentFilter> contentFilters;
+    if (parentDataSubscriber)
+    {
+        contentFilters = parentDataSubscriber->GetContentFilters();
+    }
+    const auto contentFiltersStr = Services::PubSub::SerializeContentFilters(contentFilters);
+    const auto sharedKey = linkName + "/" + contentFiltersStr;
+
+    std::unique_lock<decltype(_sharedDataSubscriberInternalsMx)> lock{_sharedDataSubscriberInternalsMx};
+    if (isShared)
+    {
+        auto it = _sharedDataSubscriberInternals.find(sharedKey);
+        if (it != _sharedDataSubscriberInternals.end())
+        {
+            it->second->AddSubscriber(parent, std::move(defaultHandler));
+            return it->second;
+        }
+    }
+
     Core::SupplementalData supplementalData;
     supplementalData[SilKit::Core::Discovery::controllerType] =
         SilKit::Core::Discovery::controllerTypeDataSubscriberInternal;
-    auto parentDataSubscriber = dynamic_cast<Services::PubSub::DataSubscriber*>(parent);
     if (parentDataSubscriber)
     {
         supplementalData[SilKit::Core::Discovery::supplKeyDataSubscriberInternalParentServiceID] =
             std::to_string(parentDataSubscriber->GetServiceDescriptor().GetServiceId());
     }
+    if (!contentFilters.empty())
+    {
+        // Lets the publisher skip sending data to this participant which none of its internal subscribers accepts
+        supplementalData[SilKit::Core::Discovery::supplKeyDataSubscriberInternalContentFilters] = contentFiltersStr;
+    }
     SilKit::Config::DataSubscriber controllerConfig;
 
     // Use a unique name to avoid collisions of several subscribers on same topic on one participant
@@ -461,7 +492,7 @@ auto Participant<SilKitConnectionT>::CreateDataSubscriberInternal(
 
     auto controller = CreateController<PubSub::DataSubscriberInternal>(
         controllerConfig, network, std::move(supplementalData), true, true, &_timeProvider, topic, mediaType,
-        publisherLabels, defaultHandler, parent);
+        publisherLabels, defaultHandler, parent, std::move(contentFilters));
 
     //Restore original DataSubscriber config for replay
     auto&& parentConfig = parentDataSubscriber->GetConfig();
@@ -470,9 +501,36 @@ auto Participant<SilKitConnectionT>::CreateDataSubscriberInternal(
         _replayScheduler->ConfigureController(parentConfig.name, controller, parentConfig.replay,
                                               parentConfig.topic.value(), parentConfig.GetNetworkType());
     }
+
+    if (isShared)
+    {
+        _sharedDataSubscriberInternals.emplace(sharedKey, controller);
+    }
     return controller;
 }
 
+template <class SilKitConnectionT>
+bool Participant<SilKitConnectionT>::RemoveDataSubscriberInternalParent(
+    Services::PubSub::DataSubscriberInternal* internalSubscriber, Services::PubSub::IDataSubscriber* parent)
+{
+    // Holding the lock prevents that a DataSubscriber is added to the internal subscriber after its last one is removed
+    std::unique_lock<decltype(_sharedDataSubscriberInternalsMx)> lock{_sharedDataSubscriberInternalsMx};
+    if (!internalSubscriber->RemoveSubscriber(parent))
+    {
+        return false;
+    }
+
+    for (auto it = _sharedDataSubscriberInternals.begin(); it != _sharedDataSubscriberInternals.end(); ++it)
+    {
+        if (it->second == internalSubscriber)
+        {
+            _sharedDataSubscriberInternals.erase(it);
+            break;
+        }
+    }
+    return true;
+}
+
 static inline auto FormatLabelsForLogging(const std::vector<MatchingLabel>& labels) -> std::string
 {
     std::ostringstream os;
@@ -519,17 +577,13 @@ auto Participant<SilKitConnectionT>::CreateDataPublisher(const std::string& cano
                                                          const SilKit::Services::PubSub::PubSubSpec& dataSpec,
                                                          size_t history) -> Services::PubSub::IDataPublisher*
 {
-    if (history > 1)
-    {
-        throw SilKit::ConfigurationError("DataPublishers do not support history > 1.");
-    }
-
     std::string network = to_string(Util::Uuid::GenerateRandom());
 
     // Merge config and parameters, sort labels
     SilKit::Config::DataPublisher controllerConfig =
         GetConfigByControllerName(_participantConfig.dataPublishers, canonicalName);
     UpdateOptionalConfigValue(canonicalName, controllerConfig.topic, dataSpec.Topic());
+    controllerConfig.history = history;
     SilKit::Services::PubSub::PubSubSpec configuredDataNodeSpec{controllerConfig.topic.value(), dataSpec.MediaType()};
     auto labels = dataSpec.Labels();
     std::sort(labels.begin(), labels.end(),
@@ -552,6 +606,17 @@ auto Participant<SilKitConnectionT>::CreateDataPublisher(const std::string& cano
         network, controllerConfig);
 
     _connection.SetHistoryLengthForLink(history, controller);
+    _connection.SetKeepLatestForLink(controllerConfig.keepLatest, controller);
+    _connection.template SetReceiverFilterForLink<Services::PubSub::WireDataMessageEvent>(
+        [controller](const std::string& participantName, const Services::PubSub::WireDataMessageEvent& msg) {
+        return controller->IsWantedBy(participantName, msg);
+    }, controller);
+    _connection.template SetReceiverFilterForLink<Services::PubSub::WireDataMessageBatch>(
+        [controller](const std::string& participantName, const Services::PubSub::WireDataMessageBatch& msg) {
+        return controller->IsWantedBy(participantName, msg);
+    }, controller);
+
+    controller->RegisterServiceDiscovery();
 
     if (GetLogger()->GetLogLevel() <= Logging::Level::Trace)
     {
@@ -601,6 +666,10 @@ auto Participant<SilKitConnectionT>::CreateDataSubscriber(
     {
         configuredDataNodeSpec.AddLabel(label);
     }
+    for (const auto& contentFilter : dataSpec.ContentFilters())
+    {
+        configuredDataNodeSpec.AddContentFilter(contentFilter);
+    }
 
     Core::SupplementalData supplementalData;
     supplementalData[SilKit::Core::Discovery::controllerType] = SilKit::Core::Discovery::controllerTypeDataSubscriber;
@@ -694,7 +763,8 @@ auto Participant<SilKitConnectionT>::CreateRpcClient(
 
     auto controller =
         CreateController<Services::Rpc::RpcClient>(controllerConfig, network, std::move(supplementalData), true, true,
-                                                   &_timeProvider, configuredDataSpec, network, handler);
+                                                   &_timeProvider, configuredDataSpec, network, handler,
+                                                   controllerConfig.dispatchMode);
 
     // RpcClient discovers RpcServerInternal and is ready to dispatch calls
     controller->RegisterServiceDiscovery();
@@ -740,8 +810,10 @@ auto Participant<SilKitConnectionT>::CreateRpcServer(
         configuredDataSpec.AddLabel(label);
     }
 
-    auto controller = CreateController<Services::Rpc::RpcServer>(controllerConfig, network, supplementalData, true,
-                                                                 true, &_timeProvider, configuredDataSpec, handler);
+    auto controller =
+        CreateController<Services::Rpc::RpcServer>(controllerConfig, network, supplementalData, true, true,
+                                                    &_timeProvider, configuredDataSpec, handler,
+                                                    controllerConfig.executorThreads);
 
     // RpcServer discovers RpcClient and creates RpcServerInternal on a matching connection
     controller->RegisterServiceDiscovery();
@@ -781,7 +853,7 @@ auto Participant<SilKitConnectionT>::CreateTimeSyncService(Orchestration::Lifecy
     config.network = "default";
     timeSyncService = CreateController<Orchestration::TimeSyncService>(
         config, std::move(timeSyncSupplementalData), false, false, &_timeProvider, _participantConfig.healthCheck,
-        lifecycleService, _participantConfig.experimental.timeSynchronization.animationFactor);
+        lifecycleService, _participantConfig.experimental.timeSynchronization);
 
     return timeSyncService;
 }
@@ -912,6 +984,11 @@ auto Participant<SilKitConnectionT>::GetServiceDiscovery() -> Discovery::IServic
         Core::SupplementalData supplementalData;
         supplementalData[SilKit::Core::Discovery::controllerType] =
             SilKit::Core::Discovery::controllerTypeServiceDiscovery;
+        if (_participantConfig.experimental.serviceDiscovery.enableInterestFiltering)
+        {
+            // Remote participants only announce services this participant is interested in
+            supplementalData[SilKit::Core::Discovery::supplKeyServiceDiscoveryInterestFiltering] = "1";
+        }
 
         Config::InternalController config;
         config.name = Discovery::controllerTypeServiceDiscovery;
@@ -1215,6 +1292,13 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
     SendMsgImpl(from, msg);
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
+                                             const Services::PubSub::WireDataMessageBatch& msg)
+{
+    SendMsgImpl(from, msg);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCall& msg)
 {
@@ -1240,6 +1324,32 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, Servi
     SendMsgImpl(from, std::move(msg));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const Services::Rpc::FunctionCallBatch& msg)
+{
+    SendMsgImpl(from, msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, Services::Rpc::FunctionCallBatch&& msg)
+{
+    SendMsgImpl(from, std::move(msg));
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
+                                             const Services::Rpc::FunctionCallResponseBatch& msg)
+{
+    SendMsgImpl(from, msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
+                                             Services::Rpc::FunctionCallResponseBatch&& msg)
+{
+    SendMsgImpl(from, std::move(msg));
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from,
                                              const Services::Orchestration::NextSimTask& msg)
@@ -1511,6 +1621,13 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const
     SendMsgImpl(from, targetParticipantName, msg);
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                             const Services::PubSub::WireDataMessageBatch& msg)
+{
+    SendMsgImpl(from, targetParticipantName, msg);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                              const Services::Rpc::FunctionCall& msg)
@@ -1539,6 +1656,34 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const
     SendMsgImpl(from, targetParticipantName, std::move(msg));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                             const Services::Rpc::FunctionCallBatch& msg)
+{
+    SendMsgImpl(from, targetParticipantName, msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                             Services::Rpc::FunctionCallBatch&& msg)
+{
+    SendMsgImpl(from, targetParticipantName, std::move(msg));
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                             const Services::Rpc::FunctionCallResponseBatch& msg)
+{
+    SendMsgImpl(from, targetParticipantName, msg);
+}
+
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
+                                             Services::Rpc::FunctionCallResponseBatch&& msg)
+{
+    SendMsgImpl(from, targetParticipantName, std::move(msg));
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                              const Services::Orchestration::NextSimTask& msg)
@@ -1989,7 +2134,7 @@ auto Participant<SilKitConnectionT>::MakeTimerThread() -> std::unique_ptr<IMetri
     }
 
     return std::make_unique<VSilKit::MetricsTimerThread>(
-        [this] { ExecuteDeferred([this] { GetMetricsManager()->SubmitUpdates(); }); });
+        [this] { ExecuteDeferred([this] { GetMetricsManager()->SubmitUpdates(); }); }, _logger.get());
 }
 
 
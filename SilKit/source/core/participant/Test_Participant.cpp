@@ -132,4 +132,26 @@ TEST_F(Test_Participant, error_on_create_basic_controller_twice_different_networ
     EXPECT_THROW(participant->CreateCanController("CAN1", "CAN2"), SilKit::ConfigurationError);
 }
 
+TEST_F(Test_Participant, shared_data_subscriber_internal_is_released_with_its_last_subscriber)
+{
+    auto participant =
+        CreateNullConnectionParticipantImpl(SilKit::Config::MakeEmptyParticipantConfigurationImpl(), "TestParticipant");
+
+    const SilKit::Services::PubSub::PubSubSpec dataSpec{"Topic", {}};
+    auto* subscriberA = participant->CreateDataSubscriber("SubscriberA", dataSpec, nullptr);
+    auto* subscriberB = participant->CreateDataSubscriber("SubscriberB", dataSpec, nullptr);
+
+    auto* internalSubscriber =
+        participant->CreateDataSubscriberInternal("Topic", "pubUUID", {}, {}, nullptr, subscriberA);
+    EXPECT_EQ(participant->CreateDataSubscriberInternal("Topic", "pubUUID", {}, {}, nullptr, subscriberB),
+              internalSubscriber);
+
+    EXPECT_FALSE(participant->RemoveDataSubscriberInternalParent(internalSubscriber, subscriberA));
+    EXPECT_TRUE(participant->RemoveDataSubscriberInternalParent(internalSubscriber, subscriberB));
+
+    // The released internal subscriber must not be shared with the subscribers matching the link later on
+    EXPECT_NE(participant->CreateDataSubscriberInternal("Topic", "pubUUID", {}, {}, nullptr, subscriberA),
+              internalSubscriber);
+}
+
 } // anonymous namespace
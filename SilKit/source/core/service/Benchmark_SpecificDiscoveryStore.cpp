@@ -0,0 +1,266 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+// Scale benchmark for the SpecificDiscoveryStore.
+//
+// Drives ServiceChange and RegisterSpecificServiceDiscoveryHandler with a configurable number of services, spread
+// across topics, controller types and matching labels, and reports the results as JSON.
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "SpecificDiscoveryStore.hpp"
+#include "ServiceConfigKeys.hpp"
+#include "ExecutionEnvironment.hpp"
+#include "BenchmarkResults.hpp"
+#include "CommandlineParser.hpp"
+#include "YamlParser.hpp"
+
+namespace {
+
+using namespace SilKit::Core;
+using namespace SilKit::Core::Discovery;
+using SilKit::Services::MatchingLabel;
+using VSilKit::Benchmark::MeasurePhase;
+using VSilKit::Benchmark::ScenarioResult;
+
+using CliParser = SilKit::Util::CommandlineParser;
+
+struct ScenarioParameters
+{
+    std::uint64_t numServices{};
+    std::uint64_t numHandlers{};
+    std::uint64_t numTopics{};
+    std::uint64_t numLabelKeys{};
+    std::uint64_t numLabelValues{};
+};
+
+struct HandlerRegistration
+{
+    std::string controllerType;
+    std::string key;
+    std::vector<MatchingLabel> labels;
+};
+
+// The controller types handled by the store, with the supplemental data keys of their key and labels
+struct ControllerTypeKeys
+{
+    const std::string& controllerTypeName;
+    const std::string& keyName;
+    const std::string* labelsName;
+};
+
+const ControllerTypeKeys controllerTypeKeys[] = {
+    {controllerTypeDataPublisher, supplKeyDataPublisherTopic, &supplKeyDataPublisherPubLabels},
+    {controllerTypeRpcClient, supplKeyRpcClientFunctionName, &supplKeyRpcClientLabels},
+    {controllerTypeRpcServerInternal, supplKeyRpcServerInternalClientUUID, nullptr},
+};
+
+auto MakeLabels(std::mt19937& rng, const ScenarioParameters& parameters) -> std::vector<MatchingLabel>
+{
+    std::vector<MatchingLabel> labels;
+    if (parameters.numLabelKeys == 0)
+    {
+        return labels;
+    }
+
+    // Between zero and three labels, with distinct keys
+    const auto numLabels = std::min<std::uint64_t>(rng() % 4, parameters.numLabelKeys);
+    const auto firstKey = rng() % parameters.numLabelKeys;
+    for (std::uint64_t i = 0; i < numLabels; ++i)
+    {
+        MatchingLabel label;
+        label.key = "Key" + std::to_string((firstKey + i) % parameters.numLabelKeys);
+        label.value = "Value" + std::to_string(rng() % parameters.numLabelValues);
+        label.kind = (rng() % 2 == 0) ? MatchingLabel::Kind::Optional : MatchingLabel::Kind::Mandatory;
+        labels.push_back(std::move(label));
+    }
+    return labels;
+}
+
+auto MakeServices(std::mt19937& rng, const ScenarioParameters& parameters) -> std::vector<ServiceDescriptor>
+{
+    std::vector<ServiceDescriptor> services;
+    services.reserve(parameters.numServices);
+    for (std::uint64_t i = 0; i < parameters.numServices; ++i)
+    {
+        const auto& keys = controllerTypeKeys[i % 3];
+
+        ServiceDescriptor descriptor;
+        descriptor.SetParticipantNameAndComputeId("Participant" + std::to_string(i % 100));
+        descriptor.SetNetworkName("Network" + std::to_string(i % parameters.numTopics));
+        descriptor.SetServiceName("Service" + std::to_string(i));
+        descriptor.SetServiceId(i);
+        descriptor.SetSupplementalDataItem(controllerType, keys.controllerTypeName);
+        descriptor.SetSupplementalDataItem(keys.keyName, "Key" + std::to_string(rng() % parameters.numTopics));
+        if (keys.labelsName != nullptr)
+        {
+            descriptor.SetSupplementalDataItem(*keys.labelsName,
+                                               SilKit::Config::Serialize(MakeLabels(rng, parameters)));
+        }
+        services.push_back(std::move(descriptor));
+    }
+    return services;
+}
+
+auto MakeHandlerRegistrations(std::mt19937& rng, const ScenarioParameters& parameters)
+    -> std::vector<HandlerRegistration>
+{
+    std::vector<HandlerRegistration> registrations;
+    registrations.reserve(parameters.numHandlers);
+    for (std::uint64_t i = 0; i < parameters.numHandlers; ++i)
+    {
+        const auto& keys = controllerTypeKeys[i % 3];
+
+        HandlerRegistration registration;
+        registration.controllerType = keys.controllerTypeName;
+        registration.key = "Key" + std::to_string(rng() % parameters.numTopics);
+        if (keys.labelsName != nullptr)
+        {
+            registration.labels = MakeLabels(rng, parameters);
+        }
+        registrations.push_back(std::move(registration));
+    }
+    return registrations;
+}
+
+auto RunScenario(const ScenarioParameters& parameters) -> ScenarioResult
+{
+    ScenarioResult result;
+    result.parameters = {
+        {"services", parameters.numServices},
+        {"handlers", parameters.numHandlers},
+        {"topics", parameters.numTopics},
+        {"labelKeys", parameters.numLabelKeys},
+        {"labelValues", parameters.numLabelValues},
+    };
+
+    std::mt19937 rng{static_cast<std::mt19937::result_type>(parameters.numServices)};
+    const auto services = MakeServices(rng, parameters);
+    const auto earlyHandlers = MakeHandlerRegistrations(rng, parameters);
+    const auto lateHandlers = MakeHandlerRegistrations(rng, parameters);
+
+    std::uint64_t handlerInvocations{0};
+    const auto handler = [&handlerInvocations](ServiceDiscoveryEvent::Type, const ServiceDescriptor&) {
+        ++handlerInvocations;
+    };
+
+    auto measure = [&result, &handlerInvocations](std::string name, std::uint64_t numEvents, auto&& function) {
+        handlerInvocations = 0;
+        result.phases.push_back(MeasurePhase(std::move(name), numEvents, [&] {
+            function();
+            return handlerInvocations;
+        }));
+    };
+
+    auto registerHandlers = [&handler](SpecificDiscoveryStore& store, const std::vector<HandlerRegistration>& regs) {
+        for (const auto& registration : regs)
+        {
+            store.RegisterSpecificServiceDiscoveryHandler(handler, registration.controllerType, registration.key,
+                                                          registration.labels);
+        }
+    };
+
+    const std::uint64_t residentMemoryBaselineBytes{VSilKit::GetResidentMemoryBytes()};
+    std::uint64_t residentMemoryPopulatedBytes{};
+    {
+        SpecificDiscoveryStore store;
+
+        measure("RegisterHandlersOnEmptyStore", earlyHandlers.size(),
+                [&] { registerHandlers(store, earlyHandlers); });
+
+        measure("ServiceCreated", services.size(), [&] {
+            for (const auto& service : services)
+            {
+                store.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, service);
+            }
+        });
+
+        residentMemoryPopulatedBytes = VSilKit::GetResidentMemoryBytes();
+
+        measure("RegisterHandlersOnPopulatedStore", lateHandlers.size(),
+                [&] { registerHandlers(store, lateHandlers); });
+
+        measure("ServiceRemoved", services.size(), [&] {
+            for (const auto& service : services)
+            {
+                store.ServiceChange(ServiceDiscoveryEvent::Type::ServiceRemoved, service);
+            }
+        });
+    }
+
+    result.parameters.emplace_back("residentMemoryBaselineBytes", residentMemoryBaselineBytes);
+    result.parameters.emplace_back("residentMemoryPopulatedBytes", residentMemoryPopulatedBytes);
+    return result;
+}
+
+} // namespace
+
+
+int main(int argc, char** argv)
+{
+    CliParser commandlineParser;
+    VSilKit::Benchmark::AddCommonOptions(commandlineParser);
+    commandlineParser.Add<CliParser::Option>(
+        "services", "s", "1000,10000,100000", "[--services <n1,n2,...>]",
+        "-s, --services <n1,n2,...>: Comma separated list of service counts, one scenario each. Defaults to "
+        "'1000,10000,100000'.");
+    commandlineParser.Add<CliParser::Option>(
+        "handler-ratio", "r", "10", "[--handler-ratio <n>]",
+        "-r, --handler-ratio <n>: Register one handler per <n> services, before and after the services are created. "
+        "Defaults to 10.");
+    commandlineParser.Add<CliParser::Option>(
+        "topic-ratio", "t", "20", "[--topic-ratio <n>]",
+        "-t, --topic-ratio <n>: Use one topic (function name, client UUID) per <n> services. Defaults to 20.");
+    commandlineParser.Add<CliParser::Option>("label-keys", "k", "8", "[--label-keys <n>]",
+                                             "-k, --label-keys <n>: Number of distinct label keys. Defaults to 8.");
+    commandlineParser.Add<CliParser::Option>(
+        "label-values", "v", "4", "[--label-values <n>]",
+        "-v, --label-values <n>: Number of distinct values per label key. Defaults to 4.");
+
+    std::vector<std::uint64_t> serviceCounts;
+    ScenarioParameters baseParameters;
+    std::uint64_t handlerRatio{};
+    std::uint64_t topicRatio{};
+    try
+    {
+        commandlineParser.ParseArguments(argc, argv);
+        serviceCounts =
+            VSilKit::Benchmark::ParseCountList(commandlineParser.Get<CliParser::Option>("services").Value());
+        handlerRatio =
+            std::max<std::uint64_t>(1, std::stoull(commandlineParser.Get<CliParser::Option>("handler-ratio").Value()));
+        topicRatio =
+            std::max<std::uint64_t>(1, std::stoull(commandlineParser.Get<CliParser::Option>("topic-ratio").Value()));
+        baseParameters.numLabelKeys = std::stoull(commandlineParser.Get<CliParser::Option>("label-keys").Value());
+        baseParameters.numLabelValues =
+            std::max<std::uint64_t>(1, std::stoull(commandlineParser.Get<CliParser::Option>("label-values").Value()));
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        commandlineParser.PrintUsageInfo(std::cerr, argv[0]);
+        return -1;
+    }
+
+    if (commandlineParser.Get<CliParser::Flag>("help").Value())
+    {
+        commandlineParser.PrintUsageInfo(std::cout, argv[0]);
+        return 0;
+    }
+
+    std::vector<ScenarioResult> results;
+    for (const auto numServices : serviceCounts)
+    {
+        auto parameters = baseParameters;
+        parameters.numServices = numServices;
+        parameters.numHandlers = numServices / handlerRatio;
+        parameters.numTopics = std::max<std::uint64_t>(1, numServices / topicRatio);
+        results.push_back(RunScenario(parameters));
+    }
+
+    return VSilKit::Benchmark::WriteResults(commandlineParser, "SpecificDiscoveryStore", "handlerInvocations", results);
+}
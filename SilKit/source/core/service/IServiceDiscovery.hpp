@@ -48,6 +48,11 @@ public:
     virtual void RegisterSpecificServiceDiscoveryHandler(
         ServiceDiscoveryHandler handler, const std::string& controllerType, const std::string& topic,
         const std::vector<SilKit::Services::MatchingLabel>& labels) = 0;
+    //!< Get the matching labels of a service from their serialization in the supplemental data. The labels are
+    //!< parsed only once per distinct serialization. They are meant to be used within the service discovery handlers,
+    //!< and stay valid until the last service announcing them is removed.
+    virtual auto GetMatchingLabels(const std::string& serializedLabels)
+        -> const std::vector<SilKit::Services::MatchingLabel>& = 0;
     //!< Get the currently known created services on other participants
     virtual std::vector<ServiceDescriptor> GetServices() const = 0;
     //!< React on a participant shutdown
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "MatchingLabelCache.hpp"
+
+#include "YamlParser.hpp"
+
+namespace SilKit {
+namespace Core {
+namespace Discovery {
+
+auto MatchingLabelCache::Get(const std::string& serializedLabels) -> const std::vector<SilKit::Services::MatchingLabel>&
+{
+    return GetEntry(serializedLabels).labels;
+}
+
+auto MatchingLabelCache::Acquire(const std::string& serializedLabels)
+    -> const std::vector<SilKit::Services::MatchingLabel>&
+{
+    auto& entry = GetEntry(serializedLabels);
+    ++entry.numReferences;
+    return entry.labels;
+}
+
+void MatchingLabelCache::Release(const std::string& serializedLabels)
+{
+    auto it = _entries.find(serializedLabels);
+    if (it == _entries.end())
+    {
+        return;
+    }
+
+    if (it->second.numReferences > 1)
+    {
+        --it->second.numReferences;
+    }
+    else
+    {
+        _entries.erase(it);
+    }
+}
+
+auto MatchingLabelCache::Size() const -> size_t
+{
+    return _entries.size();
+}
+
+auto MatchingLabelCache::GetEntry(const std::string& serializedLabels) -> Entry&
+{
+    auto it = _entries.find(serializedLabels);
+    if (it == _entries.end())
+    {
+        Entry entry;
+        entry.labels = SilKit::Config::Deserialize<std::vector<SilKit::Services::MatchingLabel>>(serializedLabels);
+        it = _entries.emplace(serializedLabels, std::move(entry)).first;
+    }
+    return it->second;
+}
+
+} // namespace Discovery
+} // namespace Core
+} // namespace SilKit
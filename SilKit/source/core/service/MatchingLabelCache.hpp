@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "silkit/services/datatypes.hpp"
+
+namespace SilKit {
+namespace Core {
+namespace Discovery {
+
+//! \brief Holds the matching labels of discovered services, which are parsed only once per distinct serialization.
+//!
+//! Services announce their labels as a YAML string in the supplemental data of their service descriptor. Parsing this
+//! string is by far the most expensive part of matching a service, and many services share the same labels.
+//!
+//! The labels are referenced by the services which announce them, and evicted when the last of them is removed.
+//!
+//! Note: The cache is not thread safe, all interactions must be secured with a common mutex.
+class MatchingLabelCache
+{
+public:
+    //! Returns the labels, which stay valid until they are evicted. Labels which are not referenced by a service are
+    //! kept until they are acquired and released by one.
+    auto Get(const std::string& serializedLabels) -> const std::vector<SilKit::Services::MatchingLabel>&;
+    //! Returns the labels of a new service and keeps them until the service is released.
+    auto Acquire(const std::string& serializedLabels) -> const std::vector<SilKit::Services::MatchingLabel>&;
+    //! Releases the labels of a removed service. They are evicted when no other service references them.
+    void Release(const std::string& serializedLabels);
+
+    auto Size() const -> size_t;
+
+private:
+    struct Entry
+    {
+        std::vector<SilKit::Services::MatchingLabel> labels;
+        size_t numReferences{0};
+    };
+
+    auto GetEntry(const std::string& serializedLabels) -> Entry&;
+
+private:
+    std::unordered_map<std::string, Entry> _entries;
+};
+
+} // namespace Discovery
+} // namespace Core
+} // namespace SilKit
@@ -22,10 +22,90 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ServiceDiscovery.hpp"
 #include "silkit/services/logging/ILogger.hpp"
 
+#include <algorithm>
+
 namespace SilKit {
 namespace Core {
 namespace Discovery {
 
+namespace {
+
+//! The filter type under which remote participants discover a service, if its discovery may be filtered by interest
+bool GetDiscoveryFilterType(const ServiceDescriptor& serviceDescriptor, FilterType& filterType)
+{
+    std::string supplControllerTypeName;
+    if (!serviceDescriptor.GetSupplementalDataItem(Core::Discovery::controllerType, supplControllerTypeName))
+    {
+        return false;
+    }
+
+    std::string key;
+    if (supplControllerTypeName == controllerTypeDataPublisher)
+    {
+        serviceDescriptor.GetSupplementalDataItem(supplKeyDataPublisherTopic, key);
+    }
+    else if (supplControllerTypeName == controllerTypeRpcClient)
+    {
+        serviceDescriptor.GetSupplementalDataItem(supplKeyRpcClientFunctionName, key);
+    }
+    else if (supplControllerTypeName == controllerTypeRpcServerInternal)
+    {
+        serviceDescriptor.GetSupplementalDataItem(supplKeyRpcServerInternalClientUUID, key);
+    }
+    else
+    {
+        return false;
+    }
+
+    filterType = FilterType{supplControllerTypeName, key};
+    return true;
+}
+
+//! The filter type of the services a service is interested in, e.g., a DataSubscriber in the DataPublishers on its topic
+bool GetInterestFilterType(const ServiceDescriptor& serviceDescriptor, FilterType& filterType)
+{
+    std::string supplControllerTypeName;
+    if (!serviceDescriptor.GetSupplementalDataItem(Core::Discovery::controllerType, supplControllerTypeName))
+    {
+        return false;
+    }
+
+    std::string key;
+    if (supplControllerTypeName == controllerTypeDataSubscriber)
+    {
+        serviceDescriptor.GetSupplementalDataItem(supplKeyDataSubscriberTopic, key);
+        filterType = FilterType{controllerTypeDataPublisher, key};
+    }
+    else if (supplControllerTypeName == controllerTypeRpcServer)
+    {
+        serviceDescriptor.GetSupplementalDataItem(supplKeyRpcServerFunctionName, key);
+        filterType = FilterType{controllerTypeRpcClient, key};
+    }
+    else if (supplControllerTypeName == controllerTypeRpcClient)
+    {
+        serviceDescriptor.GetSupplementalDataItem(supplKeyRpcClientUUID, key);
+        filterType = FilterType{controllerTypeRpcServerInternal, key};
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool IsInterestFilteringServiceDiscovery(const ServiceDescriptor& serviceDescriptor)
+{
+    std::string supplControllerTypeName;
+    std::string interestFiltering;
+    return serviceDescriptor.GetSupplementalDataItem(Core::Discovery::controllerType, supplControllerTypeName)
+           && supplControllerTypeName == controllerTypeServiceDiscovery
+           && serviceDescriptor.GetSupplementalDataItem(supplKeyServiceDiscoveryInterestFiltering, interestFiltering)
+           && interestFiltering == "1";
+}
+
+} // namespace
+
 ServiceDiscovery::ServiceDiscovery(IParticipantInternal* participant, const std::string& participantName)
     : _participant{participant}
     , _participantName{participantName}
@@ -65,6 +145,13 @@ void ServiceDiscovery::OnParticpantAddition(const ParticipantDiscoveryEvent& msg
     auto&& fromParticipant = msg.participantName;
     auto&& announcementMap = _servicesByParticipant[fromParticipant];
 
+    // The services are not ordered, the interest filtering must be known before the interests are processed
+    if (fromParticipant != _participantName
+        && std::any_of(msg.services.begin(), msg.services.end(), IsInterestFilteringServiceDiscovery))
+    {
+        _interestFilteringParticipants.insert(fromParticipant);
+    }
+
     for (auto&& serviceDescriptor : msg.services)
     {
         // Check if already known
@@ -75,6 +162,10 @@ void ServiceDiscovery::OnParticpantAddition(const ParticipantDiscoveryEvent& msg
         }
         else
         {
+            if (fromParticipant != _participantName)
+            {
+                UpdateRemoteInterestOnServiceAddition(serviceDescriptor);
+            }
             _specificDiscoveryStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, serviceDescriptor);
             // Store by service name
             announcementMap[serviceName] = serviceDescriptor;
@@ -102,6 +193,13 @@ void ServiceDiscovery::OnParticpantRemoval(const std::string& participantName)
         }
         _servicesByParticipant.erase(announcedIt);
     }
+
+    _interestFilteringParticipants.erase(participantName);
+    for (auto it = _remoteInterests.begin(); it != _remoteInterests.end();)
+    {
+        it->second.erase(participantName);
+        it = it->second.empty() ? _remoteInterests.erase(it) : std::next(it);
+    }
 }
 
 void ServiceDiscovery::NotifyServiceCreated(const ServiceDescriptor& serviceDescriptor)
@@ -117,7 +215,77 @@ void ServiceDiscovery::NotifyServiceCreated(const ServiceDescriptor& serviceDesc
     ServiceDiscoveryEvent event;
     event.type = ServiceDiscoveryEvent::Type::ServiceCreated;
     event.serviceDescriptor = serviceDescriptor;
-    _participant->SendMsg(this, std::move(event));
+
+    if (!IsAnnouncementDeferred())
+    {
+        _participant->SendMsg(this, std::move(event));
+        return;
+    }
+
+    // The remote receivers of the link and the remote interests are updated on the I/O worker thread. The removal of
+    // a service is sent from there as well, so that it cannot overtake the creation.
+    _participant->ExecuteDeferred([this, event = std::move(event)]() mutable {
+        SendServiceCreation(std::move(event));
+        OnDeferredAnnouncementSent();
+    });
+}
+
+bool ServiceDiscovery::IsAnnouncementDeferred()
+{
+    std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
+    // Without interest filtering, the announcements are broadcast directly, unless previous ones are still pending
+    if (_interestFilteringParticipants.empty() && _numDeferredAnnouncements == 0)
+    {
+        return false;
+    }
+    ++_numDeferredAnnouncements;
+    return true;
+}
+
+void ServiceDiscovery::OnDeferredAnnouncementSent()
+{
+    std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
+    --_numDeferredAnnouncements;
+}
+
+void ServiceDiscovery::SendServiceCreation(ServiceDiscoveryEvent event)
+{
+    if (_shuttingDown)
+    {
+        return;
+    }
+
+    std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
+
+    FilterType filterType;
+    if (_interestFilteringParticipants.empty() || !GetDiscoveryFilterType(event.serviceDescriptor, filterType))
+    {
+        lock.unlock();
+        _participant->SendMsg(this, std::move(event));
+        return;
+    }
+
+    // Participants that did not (yet) announce interest filtering receive all events. In that case, a single broadcast
+    // is cheaper than sending individual messages.
+    const auto receivers = _participant->GetParticipantNamesOfRemoteReceivers(this, "SERVICEDISCOVERYEVENT");
+    const auto allReceiversFilter =
+        std::all_of(receivers.begin(), receivers.end(), [this](const std::string& participantName) {
+        return _interestFilteringParticipants.count(participantName) > 0;
+    });
+
+    if (!allReceiversFilter)
+    {
+        _participant->SendMsg(this, std::move(event));
+        return;
+    }
+
+    for (const auto& participantName : receivers)
+    {
+        if (IsInterestedIn(participantName, filterType))
+        {
+            _participant->SendMsg(this, participantName, event);
+        }
+    }
 }
 
 void ServiceDiscovery::NotifyServiceRemoved(const ServiceDescriptor& serviceDescriptor)
@@ -133,7 +301,21 @@ void ServiceDiscovery::NotifyServiceRemoved(const ServiceDescriptor& serviceDesc
     ServiceDiscoveryEvent event;
     event.type = ServiceDiscoveryEvent::Type::ServiceRemoved;
     event.serviceDescriptor = serviceDescriptor;
-    _participant->SendMsg(this, std::move(event));
+
+    if (!IsAnnouncementDeferred())
+    {
+        _participant->SendMsg(this, std::move(event));
+        return;
+    }
+
+    // Sent from the I/O worker thread, in order with the creation of the service
+    _participant->ExecuteDeferred([this, event = std::move(event)]() mutable {
+        if (!_shuttingDown)
+        {
+            _participant->SendMsg(this, std::move(event));
+        }
+        OnDeferredAnnouncementSent();
+    });
 }
 
 void ServiceDiscovery::ReceiveMsg(const IServiceEndpoint* /*from*/, const ServiceDiscoveryEvent& msg)
@@ -168,6 +350,8 @@ void ServiceDiscovery::OnServiceAddition(const ServiceDescriptor& serviceDescrip
     // If we receive the event from ourselves, we skip announcing ourselves
     if (fromParticipant != _participantName)
     {
+        UpdateRemoteInterestOnServiceAddition(serviceDescriptor);
+
         std::string supplControllerTypeName;
         serviceDescriptor.GetSupplementalDataItem(Core::Discovery::controllerType, supplControllerTypeName);
 
@@ -188,16 +372,99 @@ void ServiceDiscovery::OnServiceAddition(const ServiceDescriptor& serviceDescrip
 
 void ServiceDiscovery::AnnounceLocalParticipantTo(const std::string& otherParticipant)
 {
+    const auto isInterestFiltering = _interestFilteringParticipants.count(otherParticipant) > 0;
+
     ParticipantDiscoveryEvent localServices;
     localServices.participantName = _participantName;
     localServices.services.reserve(_servicesByParticipant[_participantName].size());
     for (const auto& thisParticipantServiceMap : _servicesByParticipant[_participantName])
     {
+        FilterType filterType;
+        if (isInterestFiltering && GetDiscoveryFilterType(thisParticipantServiceMap.second, filterType)
+            && !IsInterestedIn(otherParticipant, filterType))
+        {
+            continue;
+        }
         localServices.services.push_back(thisParticipantServiceMap.second);
     }
     _participant->SendMsg(this, otherParticipant, std::move(localServices));
 }
 
+void ServiceDiscovery::AnnounceLocalServicesTo(const std::string& otherParticipant, const FilterType& filterType)
+{
+    ParticipantDiscoveryEvent localServices;
+    localServices.participantName = _participantName;
+    for (const auto& thisParticipantServiceMap : _servicesByParticipant[_participantName])
+    {
+        FilterType serviceFilterType;
+        if (GetDiscoveryFilterType(thisParticipantServiceMap.second, serviceFilterType)
+            && serviceFilterType == filterType)
+        {
+            localServices.services.push_back(thisParticipantServiceMap.second);
+        }
+    }
+
+    if (!localServices.services.empty())
+    {
+        _participant->SendMsg(this, otherParticipant, std::move(localServices));
+    }
+}
+
+void ServiceDiscovery::UpdateRemoteInterestOnServiceAddition(const ServiceDescriptor& serviceDescriptor)
+{
+    // UpdateRemoteInterestOnServiceAddition must be used with a lock on _discoveryMx
+    const auto& fromParticipant = serviceDescriptor.GetParticipantName();
+    if (IsInterestFilteringServiceDiscovery(serviceDescriptor))
+    {
+        _interestFilteringParticipants.insert(fromParticipant);
+    }
+
+    FilterType filterType;
+    if (!GetInterestFilterType(serviceDescriptor, filterType))
+    {
+        return;
+    }
+
+    auto& numInterestedServices = _remoteInterests[filterType][fromParticipant];
+    if (numInterestedServices++ == 0 && _interestFilteringParticipants.count(fromParticipant) > 0)
+    {
+        // Services that were held back so far, because the remote participant was not interested
+        AnnounceLocalServicesTo(fromParticipant, filterType);
+    }
+}
+
+void ServiceDiscovery::UpdateRemoteInterestOnServiceRemoval(const ServiceDescriptor& serviceDescriptor)
+{
+    // UpdateRemoteInterestOnServiceRemoval must be used with a lock on _discoveryMx
+    FilterType filterType;
+    if (!GetInterestFilterType(serviceDescriptor, filterType))
+    {
+        return;
+    }
+
+    auto interestIt = _remoteInterests.find(filterType);
+    if (interestIt == _remoteInterests.end())
+    {
+        return;
+    }
+
+    auto participantIt = interestIt->second.find(serviceDescriptor.GetParticipantName());
+    if (participantIt != interestIt->second.end() && --participantIt->second == 0)
+    {
+        interestIt->second.erase(participantIt);
+        if (interestIt->second.empty())
+        {
+            _remoteInterests.erase(interestIt);
+        }
+    }
+}
+
+bool ServiceDiscovery::IsInterestedIn(const std::string& participantName, const FilterType& filterType) const
+{
+    auto interestIt = _remoteInterests.find(filterType);
+    return interestIt != _remoteInterests.end() && interestIt->second.count(participantName) > 0;
+}
+
 void ServiceDiscovery::OnServiceRemoval(const ServiceDescriptor& serviceDescriptor)
 {
     std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
@@ -210,6 +477,11 @@ void ServiceDiscovery::OnServiceRemoval(const ServiceDescriptor& serviceDescript
         return;
     }
 
+    if (fromParticipant != _participantName)
+    {
+        UpdateRemoteInterestOnServiceRemoval(serviceDescriptor);
+    }
+
     _specificDiscoveryStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceRemoved, serviceDescriptor);
     CallHandlers(ServiceDiscoveryEvent::Type::ServiceRemoved, serviceDescriptor);
 }
@@ -272,6 +544,13 @@ void ServiceDiscovery::RegisterSpecificServiceDiscoveryHandler(
     _specificDiscoveryStore.RegisterSpecificServiceDiscoveryHandler(handler, controllerType_, topic, labels);
 }
 
+auto ServiceDiscovery::GetMatchingLabels(const std::string& serializedLabels)
+    -> const std::vector<SilKit::Services::MatchingLabel>&
+{
+    std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
+    return _specificDiscoveryStore.GetMatchingLabels(serializedLabels);
+}
+
 } // namespace Discovery
 } // namespace Core
 } // namespace SilKit
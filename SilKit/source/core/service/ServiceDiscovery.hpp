@@ -62,6 +62,10 @@ public: //IServiceDiscovery
                                                  const std::string& topic,
                                                  const std::vector<SilKit::Services::MatchingLabel>& labels) override;
 
+    //!< Get the matching labels of a service, parsed only once per distinct serialization
+    auto GetMatchingLabels(const std::string& serializedLabels)
+        -> const std::vector<SilKit::Services::MatchingLabel>& override;
+
     //!< Get all currently known services, including from ourselves
     std::vector<ServiceDescriptor> GetServices() const override;
 
@@ -88,6 +92,23 @@ private: // Methods
     //!< When a serciveDiscovery of another participant is discovered, we announce all services from ourselves
     void AnnounceLocalParticipantTo(const std::string& otherParticipant);
 
+    //!< Track which remote participants filter by interest and what they are interested in
+    void UpdateRemoteInterestOnServiceAddition(const ServiceDescriptor& serviceDescriptor);
+    void UpdateRemoteInterestOnServiceRemoval(const ServiceDescriptor& serviceDescriptor);
+
+    //!< Check if a remote participant wants to receive the discovery events of services with the given filter type
+    bool IsInterestedIn(const std::string& participantName, const FilterType& filterType) const;
+
+    //!< Send a local service creation only to the remote participants that are interested in it, if they filter
+    void SendServiceCreation(ServiceDiscoveryEvent event);
+
+    //!< Whether an announcement is sent from the I/O worker thread, which is required while remote participants filter
+    bool IsAnnouncementDeferred();
+    void OnDeferredAnnouncementSent();
+
+    //!< Send all local services with the given filter type to a remote participant that just became interested
+    void AnnounceLocalServicesTo(const std::string& otherParticipant, const FilterType& filterType);
+
     //!< Inform about service changes
     void CallHandlers(ServiceDiscoveryEvent::Type eventType, const ServiceDescriptor& serviceDescriptor) const;
 
@@ -100,6 +121,12 @@ private:
     using ServiceMap = std::unordered_map<std::string /*serviceDescriptor*/, ServiceDescriptor>;
     std::unordered_map<std::string /* participant name */, ServiceMap> _servicesByParticipant;
     SpecificDiscoveryStore _specificDiscoveryStore;
+    //!< remote participants that only want to receive the discovery events they are interested in
+    std::unordered_set<std::string> _interestFilteringParticipants;
+    //!< number of services per remote participant that are interested in a filter type
+    std::unordered_map<FilterType, std::unordered_map<std::string, size_t>, FilterTypeHash> _remoteInterests;
+    //!< deferred announcements which are not sent yet, later announcements must be deferred as well to keep the order
+    size_t _numDeferredAnnouncements{0};
     mutable std::recursive_mutex _discoveryMx;
     std::atomic<bool> _shuttingDown{false};
 };
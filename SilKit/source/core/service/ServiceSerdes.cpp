@@ -23,24 +23,72 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "InternalSerdes.hpp"
 #include "ServiceDescriptor.hpp"
 
+#include <algorithm>
+
 namespace SilKit {
 namespace Core {
 
 // ServiceDescriptor encoding is here, because it pulls in O_SilKit_Config
+// The interned members are encoded as plain strings and the supplemental data items like a
+// std::map<std::string, std::string>, so the wire format is unaffected by the in-memory representation.
 inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer,
                                                const SilKit::Core::ServiceDescriptor& msg)
 {
-    buffer << msg._participantName << msg._serviceType << msg._networkName << msg._networkType << msg._serviceName
-           << msg._serviceId << msg._supplementalData << msg._participantId;
+    buffer << msg._participantName.Str() << msg._serviceType << msg._networkName.Str() << msg._networkType
+           << msg._serviceName.Str() << msg._serviceId;
+
+    buffer << static_cast<uint32_t>(msg._supplementalData.size());
+    for (const auto& item : msg._supplementalData)
+    {
+        buffer << item.first.Str() << item.second.Str();
+    }
+
+    buffer << msg._participantId;
     return buffer;
 }
 
 inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer,
                                                SilKit::Core::ServiceDescriptor& updatedMsg)
 {
-    buffer >> updatedMsg._participantName >> updatedMsg._serviceType >> updatedMsg._networkName
-        >> updatedMsg._networkType >> updatedMsg._serviceName >> updatedMsg._serviceId >> updatedMsg._supplementalData
-        >> updatedMsg._participantId;
+    std::string participantName;
+    std::string networkName;
+    std::string serviceName;
+    buffer >> participantName >> updatedMsg._serviceType >> networkName >> updatedMsg._networkType >> serviceName
+        >> updatedMsg._serviceId;
+
+    uint32_t numElements{0};
+    buffer >> numElements;
+
+    ServiceDescriptor::SupplementalDataItems supplementalData;
+    supplementalData.reserve(numElements);
+    for (auto i = 0u; i < numElements; i++)
+    {
+        std::string key;
+        std::string value;
+        buffer >> key >> value;
+        supplementalData.emplace_back(Util::InternedString{key}, Util::InternedString{value});
+    }
+
+    const auto lessByKey = [](const ServiceDescriptor::SupplementalDataItem& lhs,
+                              const ServiceDescriptor::SupplementalDataItem& rhs) {
+        return lhs.first.Str() < rhs.first.Str();
+    };
+    const auto equalKey = [](const ServiceDescriptor::SupplementalDataItem& lhs,
+                             const ServiceDescriptor::SupplementalDataItem& rhs) {
+        return lhs.first == rhs.first;
+    };
+    std::sort(supplementalData.begin(), supplementalData.end(), lessByKey);
+    if (std::adjacent_find(supplementalData.begin(), supplementalData.end(), equalKey) != supplementalData.end())
+    {
+        throw SilKitError("MessageBuffer unable to deserialize ServiceDescriptor supplemental data");
+    }
+
+    buffer >> updatedMsg._participantId;
+
+    updatedMsg._participantName = Util::InternedString{participantName};
+    updatedMsg._networkName = Util::InternedString{networkName};
+    updatedMsg._serviceName = Util::InternedString{serviceName};
+    updatedMsg._supplementalData = std::move(supplementalData);
     return buffer;
 }
 namespace Discovery {
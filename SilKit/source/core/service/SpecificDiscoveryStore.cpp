@@ -20,7 +20,6 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "SpecificDiscoveryStore.hpp"
-#include "YamlParser.hpp"
 namespace {
 inline auto MakeFilter(const std::string& type,
                        const std::string& topicOrFunction) -> SilKit::Core::Discovery::FilterType
@@ -41,12 +40,20 @@ void SpecificDiscoveryStore::ServiceChange(ServiceDiscoveryEvent::Type changeTyp
     {
         if (_allowedControllers.count(supplControllerTypeName))
         {
+            static const std::vector<SilKit::Services::MatchingLabel> noLabels;
+
             std::string key;
             std::string mediaType;
-            std::vector<SilKit::Services::MatchingLabel> labels;
+            std::string labelsStr;
+            bool hasLabels{false};
 
             // extract relevant information depending on controllerType
-            if (supplControllerTypeName == controllerTypeRpcServerInternal)
+            if (supplControllerTypeName == controllerTypeDataSubscriberInternal)
+            {
+                // the link of the DataSubscriberInternal is named after the UUID of its publisher
+                key = serviceDescriptor.GetNetworkName();
+            }
+            else if (supplControllerTypeName == controllerTypeRpcServerInternal)
             {
                 serviceDescriptor.GetSupplementalDataItem(supplKeyRpcServerInternalClientUUID, key);
                 serviceDescriptor.GetSupplementalDataItem(supplKeyRpcServerMediaType, mediaType);
@@ -56,34 +63,36 @@ void SpecificDiscoveryStore::ServiceChange(ServiceDiscoveryEvent::Type changeTyp
                 serviceDescriptor.GetSupplementalDataItem(supplKeyRpcClientFunctionName, key);
                 serviceDescriptor.GetSupplementalDataItem(supplKeyRpcClientMediaType, mediaType);
 
-                // Add labels
-                std::string labelsStr;
-                if (serviceDescriptor.GetSupplementalDataItem(supplKeyRpcClientLabels, labelsStr))
-                {
-                    labels = SilKit::Config::Deserialize<decltype(labels)>(labelsStr);
-                }
+                hasLabels = serviceDescriptor.GetSupplementalDataItem(supplKeyRpcClientLabels, labelsStr);
             }
             else if (supplControllerTypeName == controllerTypeDataPublisher)
             {
                 serviceDescriptor.GetSupplementalDataItem(supplKeyDataPublisherTopic, key);
                 serviceDescriptor.GetSupplementalDataItem(supplKeyDataPublisherMediaType, mediaType);
 
-                // Add labels
-                std::string labelsStr;
-                if (serviceDescriptor.GetSupplementalDataItem(supplKeyDataPublisherPubLabels, labelsStr))
-                {
-                    labels = SilKit::Config::Deserialize<decltype(labels)>(labelsStr);
-                }
+                hasLabels = serviceDescriptor.GetSupplementalDataItem(supplKeyDataPublisherPubLabels, labelsStr);
             }
 
-            CallHandlersOnServiceChange(changeType, supplControllerTypeName, key, labels, serviceDescriptor);
+            // The labels are cached while the service exists, the handlers look them up while they are called
+            const std::vector<SilKit::Services::MatchingLabel>* labels = &noLabels;
+            if (hasLabels)
+            {
+                labels = (changeType == ServiceDiscoveryEvent::Type::ServiceCreated) ? &_labelCache.Acquire(labelsStr)
+                                                                                      : &_labelCache.Get(labelsStr);
+            }
+
+            CallHandlersOnServiceChange(changeType, supplControllerTypeName, key, *labels, serviceDescriptor);
             if (changeType == ServiceDiscoveryEvent::Type::ServiceCreated)
             {
-                InsertLookupNode(supplControllerTypeName, key, labels, serviceDescriptor);
+                InsertLookupNode(supplControllerTypeName, key, *labels, serviceDescriptor);
             }
             else if (changeType == ServiceDiscoveryEvent::Type::ServiceRemoved)
             {
                 RemoveLookupNode(supplControllerTypeName, key, serviceDescriptor);
+                if (hasLabels)
+                {
+                    _labelCache.Release(labelsStr);
+                }
             }
         }
     }
@@ -378,6 +387,12 @@ void SpecificDiscoveryStore::InsertLookupHandler(const std::string& controllerTy
                             [handlerPtr](auto& cluster) { cluster.handlers.push_back(handlerPtr); });
 }
 
+auto SpecificDiscoveryStore::GetMatchingLabels(const std::string& serializedLabels)
+    -> const std::vector<SilKit::Services::MatchingLabel>&
+{
+    return _labelCache.Get(serializedLabels);
+}
+
 void SpecificDiscoveryStore::RegisterSpecificServiceDiscoveryHandler(
     ServiceDiscoveryHandler handler, const std::string& controllerType_, const std::string& key,
     const std::vector<SilKit::Services::MatchingLabel>& labels)
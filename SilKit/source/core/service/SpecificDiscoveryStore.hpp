@@ -29,6 +29,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <map>
 
 #include "IServiceDiscovery.hpp"
+#include "MatchingLabelCache.hpp"
 #include "Hash.hpp"
 
 namespace SilKit {
@@ -96,6 +97,14 @@ public:
                                                  const std::string& key,
                                                  const std::vector<SilKit::Services::MatchingLabel>& labels);
 
+    /*! \brief Get the matching labels of a service from their serialization in the supplemental data
+    *
+    *   Note: The labels are parsed only once per distinct serialization. The returned labels stay valid until the last
+    *   service announcing them is removed. Implementation is not thread safe, all public API interactions must be
+    *   secured with a common mutex
+    */
+    auto GetMatchingLabels(const std::string& serializedLabels) -> const std::vector<SilKit::Services::MatchingLabel>&;
+
 private: //methods
     //!< Trigger relevant handler calls when a service has changed
     void CallHandlersOnServiceChange(ServiceDiscoveryEvent::Type eventType, const std::string& controllerType,
@@ -146,9 +155,13 @@ private: //methods
 private: //member
     //!< SpecificDiscoveryStore is only available to a a sub set of controllers
     const std::unordered_set<std::string> _allowedControllers = {
-        controllerTypeDataPublisher, controllerTypeRpcServerInternal, controllerTypeRpcClient};
+        controllerTypeDataPublisher, controllerTypeDataSubscriberInternal, controllerTypeRpcServerInternal,
+        controllerTypeRpcClient};
 
 protected:
+    //!< Parsed labels of the known services
+    MatchingLabelCache _labelCache;
+
     //! NB: container is not thread safe, all public API interactions must be secured with a common mutex
     std::unordered_map<FilterType, DiscoveryKeyNode, FilterTypeHash> _lookup;
 };
@@ -52,6 +52,34 @@ class MockParticipant : public DummyParticipant
 public:
     MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const ParticipantDiscoveryEvent&), (override));
     MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const ServiceDiscoveryEvent&), (override));
+    MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const std::string&, const ParticipantDiscoveryEvent&),
+                (override));
+    MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const std::string&, const ServiceDiscoveryEvent&),
+                (override));
+    MOCK_METHOD(std::vector<std::string>, GetParticipantNamesOfRemoteReceivers,
+                (const IServiceEndpoint*, const std::string&), (override));
+};
+
+// Executes the deferred callbacks only when requested, like the I/O worker thread would do later
+class DeferringParticipant : public MockParticipant
+{
+public:
+    void ExecuteDeferred(std::function<void()> callback) override
+    {
+        deferred.push_back(std::move(callback));
+    }
+
+    void RunDeferred()
+    {
+        auto callbacks = std::move(deferred);
+        deferred.clear();
+        for (auto& callback : callbacks)
+        {
+            callback();
+        }
+    }
+
+    std::vector<std::function<void()>> deferred;
 };
 
 class Callbacks
@@ -69,6 +97,30 @@ protected:
     // ----------------------------------------
     // Helper Methods
 
+    static auto MakeServiceDescriptor(const std::string& participantName, const std::string& serviceName,
+                                      const std::string& controllerTypeName, const std::string& key = {},
+                                      const std::string& value = {}) -> ServiceDescriptor
+    {
+        ServiceDescriptor descr;
+        descr.SetParticipantNameAndComputeId(participantName);
+        descr.SetNetworkName("Link1");
+        descr.SetServiceName(serviceName);
+        descr.SetSupplementalDataItem(Discovery::controllerType, controllerTypeName);
+        if (!key.empty())
+        {
+            descr.SetSupplementalDataItem(key, value);
+        }
+        return descr;
+    }
+
+    static auto MakeCreatedEvent(const ServiceDescriptor& descr) -> ServiceDiscoveryEvent
+    {
+        ServiceDiscoveryEvent event;
+        event.type = ServiceDiscoveryEvent::Type::ServiceCreated;
+        event.serviceDescriptor = descr;
+        return event;
+    }
+
 protected:
     // ----------------------------------------
     // Members
@@ -214,4 +266,139 @@ TEST_F(Test_ServiceDiscovery, service_removal)
     EXPECT_CALL(callbacks, ServiceDiscoveryHandler(_, _)).Times(0);
     disco.ReceiveMsg(&otherParticipant, event);
 }
+
+TEST_F(Test_ServiceDiscovery, interest_filtering_sends_services_only_to_interested_participants)
+{
+    MockServiceEndpoint otherParticipant{"ParticipantB", "N1", "C1", 2};
+    ServiceDiscovery disco{&participant, "ParticipantA"};
+
+    ON_CALL(participant, GetParticipantNamesOfRemoteReceivers(&disco, "SERVICEDISCOVERYEVENT"))
+        .WillByDefault(Return(std::vector<std::string>{"ParticipantB"}));
+
+    // ParticipantB joins and announces interest filtering: it receives the (empty) set of local services
+    auto remoteDiscovery = MakeServiceDescriptor("ParticipantB", "ServiceDiscovery", controllerTypeServiceDiscovery,
+                                                 supplKeyServiceDiscoveryInterestFiltering, "1");
+    EXPECT_CALL(participant, SendMsg(&disco, "ParticipantB", A<const ParticipantDiscoveryEvent&>()))
+        .WillOnce([](auto, auto, const ParticipantDiscoveryEvent& msg) { EXPECT_TRUE(msg.services.empty()); });
+    disco.ReceiveMsg(&otherParticipant, MakeCreatedEvent(remoteDiscovery));
+    Mock::VerifyAndClearExpectations(&participant);
+
+    // ParticipantB is not interested in the topic of the publisher
+    auto publisher =
+        MakeServiceDescriptor("ParticipantA", "Pub1", controllerTypeDataPublisher, supplKeyDataPublisherTopic, "T1");
+    EXPECT_CALL(participant, SendMsg(&disco, A<const ServiceDiscoveryEvent&>())).Times(0);
+    EXPECT_CALL(participant, SendMsg(&disco, _, A<const ServiceDiscoveryEvent&>())).Times(0);
+    disco.NotifyServiceCreated(publisher);
+    Mock::VerifyAndClearExpectations(&participant);
+
+    // A subscriber on the topic makes ParticipantB interested, the held back publisher is announced now
+    auto subscriber =
+        MakeServiceDescriptor("ParticipantB", "Sub1", controllerTypeDataSubscriber, supplKeyDataSubscriberTopic, "T1");
+    EXPECT_CALL(participant, SendMsg(&disco, "ParticipantB", A<const ParticipantDiscoveryEvent&>()))
+        .WillOnce([&publisher](auto, auto, const ParticipantDiscoveryEvent& msg) {
+        ASSERT_EQ(msg.services.size(), 1u);
+        EXPECT_EQ(msg.services[0], publisher);
+    });
+    disco.ReceiveMsg(&otherParticipant, MakeCreatedEvent(subscriber));
+    Mock::VerifyAndClearExpectations(&participant);
+
+    // Further publishers on the topic are sent to ParticipantB only
+    auto publisher2 =
+        MakeServiceDescriptor("ParticipantA", "Pub2", controllerTypeDataPublisher, supplKeyDataPublisherTopic, "T1");
+    EXPECT_CALL(participant, SendMsg(&disco, A<const ServiceDiscoveryEvent&>())).Times(0);
+    EXPECT_CALL(participant, SendMsg(&disco, "ParticipantB", MakeCreatedEvent(publisher2))).Times(1);
+    disco.NotifyServiceCreated(publisher2);
+    Mock::VerifyAndClearExpectations(&participant);
+
+    // Without a subscriber on the topic, ParticipantB is no longer interested
+    ServiceDiscoveryEvent subscriberRemoved;
+    subscriberRemoved.type = ServiceDiscoveryEvent::Type::ServiceRemoved;
+    subscriberRemoved.serviceDescriptor = subscriber;
+    disco.ReceiveMsg(&otherParticipant, subscriberRemoved);
+
+    auto publisher3 =
+        MakeServiceDescriptor("ParticipantA", "Pub3", controllerTypeDataPublisher, supplKeyDataPublisherTopic, "T1");
+    EXPECT_CALL(participant, SendMsg(&disco, A<const ServiceDiscoveryEvent&>())).Times(0);
+    EXPECT_CALL(participant, SendMsg(&disco, _, A<const ServiceDiscoveryEvent&>())).Times(0);
+    disco.NotifyServiceCreated(publisher3);
+}
+
+TEST_F(Test_ServiceDiscovery, interest_filtering_broadcasts_if_a_receiver_does_not_filter)
+{
+    MockServiceEndpoint otherParticipant{"ParticipantB", "N1", "C1", 2};
+    ServiceDiscovery disco{&participant, "ParticipantA"};
+
+    // ParticipantC does not support interest filtering, e.g., because it runs an older version
+    ON_CALL(participant, GetParticipantNamesOfRemoteReceivers(&disco, "SERVICEDISCOVERYEVENT"))
+        .WillByDefault(Return(std::vector<std::string>{"ParticipantB", "ParticipantC"}));
+
+    auto remoteDiscovery = MakeServiceDescriptor("ParticipantB", "ServiceDiscovery", controllerTypeServiceDiscovery,
+                                                 supplKeyServiceDiscoveryInterestFiltering, "1");
+    EXPECT_CALL(participant, SendMsg(&disco, "ParticipantB", A<const ParticipantDiscoveryEvent&>())).Times(1);
+    disco.ReceiveMsg(&otherParticipant, MakeCreatedEvent(remoteDiscovery));
+
+    auto publisher =
+        MakeServiceDescriptor("ParticipantA", "Pub1", controllerTypeDataPublisher, supplKeyDataPublisherTopic, "T1");
+    EXPECT_CALL(participant, SendMsg(&disco, MakeCreatedEvent(publisher))).Times(1);
+    EXPECT_CALL(participant, SendMsg(&disco, _, A<const ServiceDiscoveryEvent&>())).Times(0);
+    disco.NotifyServiceCreated(publisher);
+}
+
+TEST_F(Test_ServiceDiscovery, service_removal_is_sent_after_the_creation)
+{
+    DeferringParticipant deferringParticipant;
+    MockServiceEndpoint otherParticipant{"ParticipantB", "N1", "C1", 2};
+    ServiceDiscovery disco{&deferringParticipant, "ParticipantA"};
+
+    ON_CALL(deferringParticipant, GetParticipantNamesOfRemoteReceivers(&disco, "SERVICEDISCOVERYEVENT"))
+        .WillByDefault(Return(std::vector<std::string>{"ParticipantB"}));
+
+    // ParticipantB filters by interest and subscribes to the topic of the publisher
+    auto remoteDiscovery = MakeServiceDescriptor("ParticipantB", "ServiceDiscovery", controllerTypeServiceDiscovery,
+                                                 supplKeyServiceDiscoveryInterestFiltering, "1");
+    auto subscriber =
+        MakeServiceDescriptor("ParticipantB", "Sub1", controllerTypeDataSubscriber, supplKeyDataSubscriberTopic, "T1");
+    EXPECT_CALL(deferringParticipant, SendMsg(&disco, "ParticipantB", A<const ParticipantDiscoveryEvent&>()))
+        .Times(AnyNumber());
+    disco.ReceiveMsg(&otherParticipant, MakeCreatedEvent(remoteDiscovery));
+    disco.ReceiveMsg(&otherParticipant, MakeCreatedEvent(subscriber));
+    Mock::VerifyAndClearExpectations(&deferringParticipant);
+
+    // The publisher is removed before its creation was sent
+    auto publisher =
+        MakeServiceDescriptor("ParticipantA", "Pub1", controllerTypeDataPublisher, supplKeyDataPublisherTopic, "T1");
+    ServiceDiscoveryEvent publisherRemoved;
+    publisherRemoved.type = ServiceDiscoveryEvent::Type::ServiceRemoved;
+    publisherRemoved.serviceDescriptor = publisher;
+    {
+        InSequence sequence;
+        EXPECT_CALL(deferringParticipant, SendMsg(&disco, "ParticipantB", MakeCreatedEvent(publisher))).Times(1);
+        EXPECT_CALL(deferringParticipant, SendMsg(&disco, publisherRemoved)).Times(1);
+    }
+
+    disco.NotifyServiceCreated(publisher);
+    disco.NotifyServiceRemoved(publisher);
+    deferringParticipant.RunDeferred();
+}
+
+TEST_F(Test_ServiceDiscovery, announcements_are_sent_directly_without_interest_filtering)
+{
+    DeferringParticipant deferringParticipant;
+    ServiceDiscovery disco{&deferringParticipant, "ParticipantA"};
+
+    auto publisher =
+        MakeServiceDescriptor("ParticipantA", "Pub1", controllerTypeDataPublisher, supplKeyDataPublisherTopic, "T1");
+    ServiceDiscoveryEvent publisherRemoved;
+    publisherRemoved.type = ServiceDiscoveryEvent::Type::ServiceRemoved;
+    publisherRemoved.serviceDescriptor = publisher;
+    {
+        InSequence sequence;
+        EXPECT_CALL(deferringParticipant, SendMsg(&disco, MakeCreatedEvent(publisher))).Times(1);
+        EXPECT_CALL(deferringParticipant, SendMsg(&disco, publisherRemoved)).Times(1);
+    }
+
+    disco.NotifyServiceCreated(publisher);
+    disco.NotifyServiceRemoved(publisher);
+    EXPECT_TRUE(deferringParticipant.deferred.empty());
+}
 } // namespace
@@ -55,6 +55,11 @@ public:
     {
         return _lookup;
     };
+
+    auto GetNumberOfCachedLabels() const -> size_t
+    {
+        return _labelCache.Size();
+    }
 };
 
 class Callbacks
@@ -83,7 +88,6 @@ TEST_F(Test_SpecificDiscoveryStore, no_reaction_on_irrelevant_services)
 {
     std::string controllerTypes[] = {controllerTypeServiceDiscovery,
                                      controllerTypeCan,
-                                     controllerTypeDataSubscriberInternal,
                                      controllerTypeEthernet,
                                      controllerTypeFlexray,
                                      controllerTypeLifecycleService,
@@ -255,6 +259,33 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_entries_rpc_server_internal)
     ASSERT_EQ(entry.allCluster.nodes.size(), 0);
 }
 
+TEST_F(Test_SpecificDiscoveryStore, lookup_entries_data_subscriber_internal)
+{
+    std::string uuid = "5f3c1a8e-0d7b-4f26-9a41-c2e8b7d6a013";
+    ServiceDescriptor baseDescriptor{};
+    baseDescriptor.SetParticipantNameAndComputeId("ParticipantA");
+    baseDescriptor.SetNetworkName(uuid);
+    baseDescriptor.SetServiceName("ServiceDiscovery");
+    baseDescriptor.SetSupplementalDataItem(Core::Discovery::controllerType, controllerTypeDataSubscriberInternal);
+
+    ServiceDescriptor noLabelTestDescriptor{baseDescriptor};
+    noLabelTestDescriptor.SetServiceId(1);
+
+    TestWrapperSpecificDiscoveryStore testStore;
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, noLabelTestDescriptor);
+
+    // The internal subscribers are looked up by the link of their publisher
+    auto& lookup = testStore.GetLookup();
+    ASSERT_EQ(lookup.size(), 1);
+    auto& entry = lookup[std::make_tuple(controllerTypeDataSubscriberInternal, uuid)];
+    ASSERT_EQ(entry.allCluster.nodes[0], noLabelTestDescriptor);
+
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceRemoved, noLabelTestDescriptor);
+    //refresh lookup and entry
+    entry = lookup[std::make_tuple(controllerTypeDataSubscriberInternal, uuid)];
+    ASSERT_EQ(entry.allCluster.nodes.size(), 0);
+}
+
 TEST_F(Test_SpecificDiscoveryStore, lookup_handler_then_service_discovery)
 {
     TestWrapperSpecificDiscoveryStore testStore;
@@ -404,4 +435,56 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_service_discovery_then_handler_issues
     }, controllerTypeDataPublisher, "Topic1", optionalSubscriberLabels2);
 }
 
+TEST_F(Test_SpecificDiscoveryStore, matching_labels_are_parsed_once_per_serialization)
+{
+    TestWrapperSpecificDiscoveryStore testStore;
+
+    const std::vector<SilKit::Services::MatchingLabel> labels{
+        {"kA", "vA", SilKit::Services::MatchingLabel::Kind::Mandatory},
+        {"kB", "vB", SilKit::Services::MatchingLabel::Kind::Optional}};
+    const auto labelsStr = SilKit::Config::Serialize(labels);
+
+    const auto& parsedLabels = testStore.GetMatchingLabels(labelsStr);
+    ASSERT_EQ(parsedLabels.size(), 2u);
+    EXPECT_EQ(parsedLabels[0].key, "kA");
+    EXPECT_EQ(parsedLabels[0].value, "vA");
+    EXPECT_EQ(parsedLabels[0].kind, SilKit::Services::MatchingLabel::Kind::Mandatory);
+    EXPECT_EQ(parsedLabels[1].key, "kB");
+    EXPECT_EQ(parsedLabels[1].value, "vB");
+    EXPECT_EQ(parsedLabels[1].kind, SilKit::Services::MatchingLabel::Kind::Optional);
+
+    // The same serialization yields the same cached labels, which stay valid when other labels are added
+    EXPECT_TRUE(testStore.GetMatchingLabels("[]").empty());
+    EXPECT_EQ(&testStore.GetMatchingLabels(labelsStr), &parsedLabels);
+    EXPECT_EQ(parsedLabels.size(), 2u);
+}
+
+TEST_F(Test_SpecificDiscoveryStore, matching_labels_are_evicted_with_the_last_service_announcing_them)
+{
+    ServiceDescriptor baseDescriptor{};
+    baseDescriptor.SetParticipantNameAndComputeId("ParticipantA");
+    baseDescriptor.SetNetworkName("Link1");
+    baseDescriptor.SetServiceName("ServiceDiscovery");
+    baseDescriptor.SetSupplementalDataItem(Core::Discovery::controllerType, controllerTypeDataPublisher);
+    baseDescriptor.SetSupplementalDataItem(supplKeyDataPublisherTopic, "Topic1");
+    baseDescriptor.SetSupplementalDataItem(supplKeyDataPublisherMediaType, "text/json");
+    baseDescriptor.SetSupplementalDataItem(supplKeyDataPublisherPubLabels, "- key: kA\n  value: vA\n  kind: 2");
+
+    ServiceDescriptor firstDescriptor{baseDescriptor};
+    firstDescriptor.SetServiceId(1);
+    ServiceDescriptor secondDescriptor{baseDescriptor};
+    secondDescriptor.SetServiceId(2);
+
+    TestWrapperSpecificDiscoveryStore testStore;
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, firstDescriptor);
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, secondDescriptor);
+    EXPECT_EQ(testStore.GetNumberOfCachedLabels(), 1u);
+
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceRemoved, firstDescriptor);
+    EXPECT_EQ(testStore.GetNumberOfCachedLabels(), 1u);
+
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceRemoved, secondDescriptor);
+    EXPECT_EQ(testStore.GetNumberOfCachedLabels(), 0u);
+}
+
 } // namespace
@@ -42,6 +42,11 @@ inline constexpr auto aggregationKind<SilKit::Services::PubSub::WireDataMessageE
 {
     return MessageAggregationKind::UserDataMessage;
 }
+template <>
+inline constexpr auto aggregationKind<SilKit::Services::PubSub::WireDataMessageBatch>() -> MessageAggregationKind
+{
+    return MessageAggregationKind::UserDataMessage;
+}
 // RPC
 template <>
 inline constexpr auto aggregationKind<SilKit::Services::Rpc::FunctionCall>() -> MessageAggregationKind
@@ -53,6 +58,16 @@ inline constexpr auto aggregationKind<SilKit::Services::Rpc::FunctionCallRespons
 {
     return MessageAggregationKind::UserDataMessage;
 }
+template <>
+inline constexpr auto aggregationKind<SilKit::Services::Rpc::FunctionCallBatch>() -> MessageAggregationKind
+{
+    return MessageAggregationKind::UserDataMessage;
+}
+template <>
+inline constexpr auto aggregationKind<SilKit::Services::Rpc::FunctionCallResponseBatch>() -> MessageAggregationKind
+{
+    return MessageAggregationKind::UserDataMessage;
+}
 // CAN
 template <>
 inline constexpr auto aggregationKind<SilKit::Services::Can::WireCanFrameEvent>() -> MessageAggregationKind
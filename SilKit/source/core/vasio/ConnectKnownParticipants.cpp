@@ -76,12 +76,38 @@ void ConnectKnownParticipants::SetKnownParticipants(const std::vector<VAsioPeerI
 }
 
 
+void ConnectKnownParticipants::SetStaticPeers(const std::vector<VAsioPeerInfo>& peerInfos)
+{
+    SILKIT_TRACE_METHOD_(_logger, "({})", peerInfos.size());
+
+    SILKIT_ASSERT(_connectStage == ConnectStage::INVALID);
+
+    std::vector<Peer*> staticPeers;
+
+    {
+        std::lock_guard<decltype(_mutex)> lock{_mutex};
+
+        for (const auto& peerInfo : peerInfos)
+        {
+            auto peer{std::make_unique<Peer>(*this, peerInfo, true)};
+            staticPeers.push_back(peer.get());
+            _peers.emplace(peerInfo.participantName, std::move(peer));
+        }
+    }
+
+    // the stage is only evaluated once StartConnecting is called
+    for (auto* peer : staticPeers)
+    {
+        peer->StartConnecting();
+    }
+}
+
+
 void ConnectKnownParticipants::StartConnecting()
 {
     SILKIT_TRACE_METHOD_(_logger, "()");
 
     SILKIT_ASSERT(_connectStage == ConnectStage::INVALID);
-    _connectStage = ConnectStage::CONNECTING;
 
     // wait for the known participants to be set
     auto knownParticipants{_knownParticipants.get_future()};
@@ -89,18 +115,24 @@ void ConnectKnownParticipants::StartConnecting()
     {
         std::lock_guard<decltype(_mutex)> lock{_mutex};
 
-        // create all peer state trackers
+        // create all peer state trackers, static peers are already present
         for (const auto& peerInfo : knownParticipants.get())
         {
             _peers.emplace(peerInfo.participantName, std::make_unique<Peer>(*this, peerInfo));
         }
     }
 
+    // static peers might progress concurrently, all peers must be known before the stage is evaluated
+    _connectStage = ConnectStage::CONNECTING;
+
     // initiate all direct connection attempts
     for (const auto& pair : _peers)
     {
         const auto& peer{pair.second};
-        peer->StartConnecting();
+        if (peer->GetStage() == PeerStage::INVALID)
+        {
+            peer->StartConnecting();
+        }
     }
 
     UpdateStage();
@@ -245,9 +277,10 @@ void ConnectKnownParticipants::UpdateStage()
 // ConnectionManager::Peer : IConnectPeerListener
 
 
-ConnectKnownParticipants::Peer::Peer(ConnectKnownParticipants& manager, VAsioPeerInfo info)
+ConnectKnownParticipants::Peer::Peer(ConnectKnownParticipants& manager, VAsioPeerInfo info, bool isStatic)
     : _manager{&manager}
     , _info{std::move(info)}
+    , _isStatic{isStatic}
 {
 }
 
@@ -268,6 +301,7 @@ void ConnectKnownParticipants::Peer::StartConnecting()
     SILKIT_TRACE_METHOD_(_manager->_logger, "()");
 
     _peerStage = PeerStage::DIRECT;
+    ++_numConnectAttempts;
 
     _directConnectPeer = _manager->_connectionMethods->MakeConnectPeer(_info);
     _directConnectPeer->SetListener(*this);
@@ -363,6 +397,11 @@ void ConnectKnownParticipants::Peer::Shutdown()
     {
         _remoteConnectRequestTimer->Shutdown();
     }
+
+    if (_staticRetryTimer != nullptr)
+    {
+        _staticRetryTimer->Shutdown();
+    }
 }
 
 auto ConnectKnownParticipants::Peer::Describe() const -> std::string
@@ -381,7 +420,7 @@ auto ConnectKnownParticipants::Peer::Describe() const -> std::string
         fmt::format_to(it, "has failed{}", _failureReason);
         break;
     case PeerStage::DIRECT:
-        fmt::format_to(it, "is connecting directly");
+        fmt::format_to(it, _isStatic ? "is connecting directly (static peer)" : "is connecting directly");
         break;
     case PeerStage::REMOTE_CONNECT_REQUESTED:
         fmt::format_to(it, "has requested remote connection");
@@ -425,6 +464,25 @@ void ConnectKnownParticipants::Peer::OnConnectPeerFailure(IConnectPeer&, VAsioPe
     // destroy the peer connection object
     _directConnectPeer.reset();
 
+    // static peers are part of a fixed topology and are connected directly, the peer might not be started yet
+    if (_isStatic)
+    {
+        if (_numConnectAttempts >= _manager->_settings.staticPeerConnectAttempts)
+        {
+            HasFailed(fmt::format("because the static peer was not reachable after {} direct connection attempts",
+                                  _numConnectAttempts));
+            return;
+        }
+
+        if (_staticRetryTimer == nullptr)
+        {
+            _staticRetryTimer = _manager->_ioContext->MakeTimer();
+            _staticRetryTimer->SetListener(*this);
+        }
+        _staticRetryTimer->AsyncWaitFor(_manager->_settings.staticPeerRetryInterval);
+        return;
+    }
+
     // attempt to request remote connection
     _peerStage = PeerStage::REMOTE_CONNECT_REQUESTED;
     if (_manager->_connectionMethods->TryRemoteConnectRequest(_info))
@@ -449,10 +507,20 @@ void ConnectKnownParticipants::Peer::OnConnectPeerFailure(IConnectPeer&, VAsioPe
 }
 
 
-void ConnectKnownParticipants::Peer::OnTimerExpired(VSilKit::ITimer&)
+void ConnectKnownParticipants::Peer::OnTimerExpired(VSilKit::ITimer& timer)
 {
     SILKIT_TRACE_METHOD_(_manager->_logger, "(...)");
 
+    if (&timer == _staticRetryTimer.get())
+    {
+        if (_peerStage == PeerStage::DIRECT)
+        {
+            Log::Debug(_manager->_logger, "Retrying to connect to static peer {}", _info.participantName);
+            StartConnecting();
+        }
+        return;
+    }
+
     if (_peerStage != PeerStage::REMOTE_CONNECT_REQUESTED)
     {
         Log::Debug(_manager->_logger, "Ignoring expired remote connection request timer for {} in stage {}",
@@ -56,6 +56,10 @@ struct ConnectKnownParticipantsSettings
 {
     std::chrono::milliseconds directConnectTimeout{5000};
     std::chrono::milliseconds remoteConnectRequestTimeout{5000};
+    //! Delay between direct connection attempts to static peers that are not reachable (yet)
+    std::chrono::milliseconds staticPeerRetryInterval{100};
+    //! Number of direct connection attempts to a static peer, before connecting to it has failed
+    size_t staticPeerConnectAttempts{50};
 };
 
 
@@ -104,13 +108,16 @@ private:
     private:
         ConnectKnownParticipants* _manager;
         VAsioPeerInfo _info;
+        bool _isStatic;
+        size_t _numConnectAttempts{0};
         std::atomic<PeerStage> _peerStage{PeerStage::INVALID};
         std::unique_ptr<IConnectPeer> _directConnectPeer;
         std::unique_ptr<ITimer> _remoteConnectRequestTimer;
+        std::unique_ptr<ITimer> _staticRetryTimer;
         std::string _failureReason;
 
     public:
-        Peer(ConnectKnownParticipants& manager, VAsioPeerInfo info);
+        Peer(ConnectKnownParticipants& manager, VAsioPeerInfo info, bool isStatic = false);
 
         auto GetInfo() const -> const VAsioPeerInfo&;
         auto GetStage() const -> PeerStage;
@@ -155,6 +162,8 @@ public:
     void SetLogger(SilKit::Services::Logging::ILogger& logger);
 
     void SetKnownParticipants(const std::vector<VAsioPeerInfo>& peerInfos);
+    //! Immediately start connecting to statically configured peers, retrying until they are reachable
+    void SetStaticPeers(const std::vector<VAsioPeerInfo>& peerInfos);
     void StartConnecting();
     void HandlePeerEvent(const std::string& participantName, PeerEvent event);
     void Shutdown();
@@ -31,6 +31,28 @@ SerializedMessage::SerializedMessage(std::vector<uint8_t>&& blob)
     ReadNetworkHeaders();
 }
 
+// Constructor from an already serialized sim message (sending to another receiver)
+SerializedMessage::SerializedMessage(std::vector<uint8_t> blob, EndpointId remoteIndex,
+                                     MessageAggregationKind msgAggregationKind)
+    : _aggregationKind{msgAggregationKind}
+{
+    // The remote index directly follows the message size and kind
+    const auto remoteIndexPos = sizeof(_messageSize) + sizeof(_messageKind);
+    if (blob.size() < remoteIndexPos + sizeof(remoteIndex))
+    {
+        throw SilKitError{"SerializedMessage: message buffer is too small for a sim message"};
+    }
+    std::memcpy(blob.data() + remoteIndexPos, &remoteIndex, sizeof(remoteIndex));
+
+    _buffer = MessageBuffer{std::move(blob)};
+    ReadNetworkHeaders();
+    if (!IsMwOrSim(_messageKind))
+    {
+        throw SilKitError{"SerializedMessage: remote index replaced in wrong message kind: "
+                          + std::to_string((int)_messageKind)};
+    }
+}
+
 auto SerializedMessage::ReleaseStorage() -> std::vector<uint8_t>
 {
     auto buffer = _buffer.ReleaseStorage();
@@ -58,6 +80,11 @@ auto SerializedMessage::GetAggregationKind() const -> MessageAggregationKind
     return _aggregationKind;
 }
 
+auto SerializedMessage::GetKeepLatest() const -> bool
+{
+    return _keepLatest;
+}
+
 auto SerializedMessage::GetRemoteIndex() const -> EndpointId
 {
     if (!IsMwOrSim(_messageKind))
@@ -168,5 +195,10 @@ void SerializedMessage::SetAggregationKind(MessageAggregationKind msgAggregation
     _aggregationKind = msgAggregationKind;
 }
 
+void SerializedMessage::SetKeepLatest(bool keepLatest)
+{
+    _keepLatest = keepLatest;
+}
+
 } // namespace Core
 } // namespace SilKit
@@ -83,6 +83,10 @@ public: // Sending a SerializedMessage: from T to binary blob
     explicit SerializedMessage(const MessageT& message, EndpointAddress endpointAddress, EndpointId remoteIndex);
     template <typename MessageT>
     explicit SerializedMessage(ProtocolVersion version, const MessageT& message);
+    // Sim message which was already serialized for another receiver, only the remote index is replaced. The
+    // aggregation kind is not part of the blob and must be passed again, e.g., aggregationKind<MessageT>().
+    explicit SerializedMessage(std::vector<uint8_t> blob, EndpointId remoteIndex,
+                               MessageAggregationKind msgAggregationKind);
 
     auto ReleaseStorage() -> std::vector<uint8_t>;
 
@@ -97,6 +101,7 @@ public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
     auto GetMessageKind() const -> VAsioMsgKind;
     auto GetRegistryKind() const -> RegistryMessageKind;
     auto GetAggregationKind() const -> MessageAggregationKind;
+    auto GetKeepLatest() const -> bool;
     auto GetRemoteIndex() const -> EndpointId;
     auto GetEndpointAddress() const -> EndpointAddress;
     void SetProtocolVersion(ProtocolVersion version);
@@ -104,6 +109,8 @@ public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
     auto GetRegistryMessageHeader() const -> RegistryMsgHeader;
 
     void SetAggregationKind(MessageAggregationKind msgAggregationKind);
+    //! If set, the message may be replaced by a newer message from the same endpoint before it is sent.
+    void SetKeepLatest(bool keepLatest);
 
 private:
     void WriteNetworkHeaders();
@@ -113,6 +120,8 @@ private:
     VAsioMsgKind _messageKind{VAsioMsgKind::Invalid};
     RegistryMessageKind _registryKind{RegistryMessageKind::Invalid};
     MessageAggregationKind _aggregationKind{MessageAggregationKind::Other};
+    // Not transmitted, only used by the sending peer
+    bool _keepLatest{false};
     // For simMsg
     EndpointAddress _endpointAddress{};
     EndpointId _remoteIndex{0};
@@ -71,6 +71,10 @@ public:
     void DistributeLocalSilKitMessage(const IServiceEndpoint* from, const MsgT& msg);
 
     void SetHistoryLength(size_t history);
+    //! Queued messages which are not yet sent are replaced by newer messages of the same sender
+    void SetKeepLatest(bool keepLatest);
+    //! Messages are only sent to the remote participants accepted by the filter
+    void SetReceiverFilter(std::function<bool(const std::string&, const MsgT&)> receiverFilter);
 
     void DispatchSilKitMessageToTarget(const IServiceEndpoint* from, const std::string& targetParticipantName,
                                        const MsgT& msg);
@@ -243,5 +247,17 @@ void SilKitLink<MsgT>::SetHistoryLength(size_t history)
     _vasioTransmitter.SetHistoryLength(history);
 }
 
+template <class MsgT>
+void SilKitLink<MsgT>::SetKeepLatest(bool keepLatest)
+{
+    _vasioTransmitter.SetKeepLatest(keepLatest);
+}
+
+template <class MsgT>
+void SilKitLink<MsgT>::SetReceiverFilter(std::function<bool(const std::string&, const MsgT&)> receiverFilter)
+{
+    _vasioTransmitter.SetReceiverFilter(std::move(receiverFilter));
+}
+
 } // namespace Core
 } // namespace SilKit
@@ -436,4 +436,173 @@ TEST_F(Test_ConnectKnownParticipants, remote_connect_fallback_to_proxy_after_fai
 }
 
 
+TEST_F(Test_ConnectKnownParticipants, static_peers_connect_before_known_participants_are_set)
+{
+    auto MakeSucceedingConnectPeer{
+        [this](const VAsioPeerInfo& peerInfo) { return MakeConnectPeerThatSucceeds(peerInfo); }};
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///one");
+    peerInfo.capabilities = "";
+
+    // Arrange
+
+    Sequence s1;
+
+    StrictMock<MockConnectionMethods> connectionMethods;
+    {
+        EXPECT_CALL(connectionMethods, MakeConnectPeer(WithParticipantName(peerInfo.participantName)))
+            .InSequence(s1)
+            .WillOnce(MakeSucceedingConnectPeer);
+
+        EXPECT_CALL(connectionMethods, MakeVAsioPeer(WithRemoteEndpoint(peerInfo.acceptorUris.front())))
+            .InSequence(s1)
+            .WillOnce([](std::unique_ptr<IRawByteStream>) {
+            auto vAsioPeer{std::make_unique<NiceMock<MockVAsioPeer>>()};
+            return vAsioPeer;
+        });
+
+        EXPECT_CALL(connectionMethods, HandleConnectedPeer).InSequence(s1);
+        EXPECT_CALL(connectionMethods, AddPeer).InSequence(s1);
+    }
+
+    StrictMock<MockConnectKnownParticipantsListener> listener;
+
+    ConnectKnownParticipants connectKnownParticipants{ioContext, connectionMethods, listener, settings};
+    connectKnownParticipants.SetLogger(logger);
+
+    // Act: the static peer is connected without the known participants, the listener is not notified yet
+
+    connectKnownParticipants.SetStaticPeers({peerInfo});
+    ioContext.Run();
+
+    // Act: the static peer is not part of the known participants, but it is still waited for
+
+    EXPECT_CALL(listener, OnConnectKnownParticipantsWaitingForAllReplies).Times(1).InSequence(s1);
+
+    connectKnownParticipants.SetKnownParticipants({});
+    connectKnownParticipants.StartConnecting();
+    ioContext.Run();
+
+    EXPECT_CALL(listener, OnConnectKnownParticipantsAllRepliesReceived).Times(1).InSequence(s1);
+
+    connectKnownParticipants.HandlePeerEvent(peerInfo.participantName, PeerEvent::PARTICIPANT_ANNOUNCEMENT_REPLY);
+    ioContext.Run();
+}
+
+
+TEST_F(Test_ConnectKnownParticipants, static_peer_retries_direct_connect_without_fallbacks)
+{
+    auto MakeFailingConnectPeer{[this](const VAsioPeerInfo& peerInfo) { return MakeConnectPeerThatFails(peerInfo); }};
+    auto MakeSucceedingConnectPeer{
+        [this](const VAsioPeerInfo& peerInfo) { return MakeConnectPeerThatSucceeds(peerInfo); }};
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///one");
+    peerInfo.capabilities = "";
+
+    // Arrange
+
+    Sequence s1;
+
+    // neither remote-connect, nor proxy-connection are attempted (StrictMock)
+    StrictMock<MockConnectionMethods> connectionMethods;
+    MockConnectKnownParticipantsListener listener;
+
+    EXPECT_CALL(connectionMethods, MakeConnectPeer(WithParticipantName(peerInfo.participantName)))
+        .InSequence(s1)
+        .WillOnce(MakeFailingConnectPeer);
+
+    EXPECT_CALL(ioContext, MakeTimer).InSequence(s1).WillOnce([this] {
+        const auto interval{static_cast<std::chrono::nanoseconds>(settings.staticPeerRetryInterval)};
+        auto timer{std::make_unique<MockTimerThatExpiresImmediately>(ioContext)};
+        EXPECT_CALL(*timer, DoSetListener);
+        EXPECT_CALL(*timer, DoAsyncWaitFor(interval));
+        return timer;
+    });
+
+    EXPECT_CALL(connectionMethods, MakeConnectPeer(WithParticipantName(peerInfo.participantName)))
+        .InSequence(s1)
+        .WillOnce(MakeSucceedingConnectPeer);
+
+    EXPECT_CALL(connectionMethods, MakeVAsioPeer(WithRemoteEndpoint(peerInfo.acceptorUris.front())))
+        .InSequence(s1)
+        .WillOnce([](std::unique_ptr<IRawByteStream>) {
+        auto vAsioPeer{std::make_unique<NiceMock<MockVAsioPeer>>()};
+        return vAsioPeer;
+    });
+
+    EXPECT_CALL(connectionMethods, HandleConnectedPeer).InSequence(s1);
+    EXPECT_CALL(connectionMethods, AddPeer).InSequence(s1);
+
+    EXPECT_CALL(listener, OnConnectKnownParticipantsWaitingForAllReplies).Times(1).InSequence(s1);
+    EXPECT_CALL(listener, OnConnectKnownParticipantsFailure).Times(0);
+
+    // Act
+
+    ConnectKnownParticipants connectKnownParticipants{ioContext, connectionMethods, listener, settings};
+    connectKnownParticipants.SetLogger(logger);
+
+    connectKnownParticipants.SetStaticPeers({peerInfo});
+    connectKnownParticipants.SetKnownParticipants({});
+    connectKnownParticipants.StartConnecting();
+
+    ioContext.Run();
+}
+
+
+TEST_F(Test_ConnectKnownParticipants, static_peer_fails_after_the_configured_connect_attempts)
+{
+    auto MakeFailingConnectPeer{[this](const VAsioPeerInfo& peerInfo) { return MakeConnectPeerThatFails(peerInfo); }};
+
+    VAsioPeerInfo peerInfo;
+    peerInfo.participantName = "A";
+    peerInfo.participantId = SilKit::Util::Hash::Hash(peerInfo.participantName);
+    peerInfo.acceptorUris.emplace_back("local:///one");
+    peerInfo.capabilities = "";
+
+    settings.staticPeerConnectAttempts = 3;
+
+    // Arrange
+
+    // neither remote-connect, nor proxy-connection are attempted (StrictMock)
+    StrictMock<MockConnectionMethods> connectionMethods;
+    MockConnectKnownParticipantsListener listener;
+
+    EXPECT_CALL(connectionMethods, MakeConnectPeer(WithParticipantName(peerInfo.participantName)))
+        .Times(3)
+        .WillRepeatedly(MakeFailingConnectPeer);
+
+    EXPECT_CALL(ioContext, MakeTimer).WillOnce([this] {
+        const auto interval{static_cast<std::chrono::nanoseconds>(settings.staticPeerRetryInterval)};
+        auto timer{std::make_unique<MockTimerThatExpiresImmediately>(ioContext)};
+        EXPECT_CALL(*timer, DoSetListener);
+        EXPECT_CALL(*timer, DoAsyncWaitFor(interval)).Times(2);
+        return timer;
+    });
+
+    EXPECT_CALL(listener, OnConnectKnownParticipantsWaitingForAllReplies).Times(0);
+    EXPECT_CALL(listener, OnConnectKnownParticipantsFailure).Times(1);
+
+    // Act
+
+    ConnectKnownParticipants connectKnownParticipants{ioContext, connectionMethods, listener, settings};
+    connectKnownParticipants.SetLogger(logger);
+
+    connectKnownParticipants.SetStaticPeers({peerInfo});
+    connectKnownParticipants.SetKnownParticipants({});
+    connectKnownParticipants.StartConnecting();
+
+    ioContext.Run();
+
+    EXPECT_EQ(connectKnownParticipants.Describe(),
+              "A (local:///one) has failed because the static peer was not reachable after 3 direct connection "
+              "attempts");
+}
+
+
 } // namespace
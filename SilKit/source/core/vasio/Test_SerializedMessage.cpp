@@ -99,3 +99,19 @@ TEST(Test_SerializedMessage, packed_handshake_message)
     ASSERT_EQ(ptr->simulationNameSize, announcement.simulationName.size());
     ASSERT_EQ(to_string(ptr->simulationName, ptr->simulationNameSize), announcement.simulationName);
 }
+
+TEST(Test_SerializedMessage, serialized_sim_message_for_another_receiver)
+{
+    using namespace std::chrono_literals;
+
+    const SilKit::Services::PubSub::WireDataMessageEvent dataMessageEvent{1ns, {1u, 2u, 3u}};
+    const EndpointAddress endpointAddress{1234, 5};
+    auto blob = SerializedMessage{dataMessageEvent, endpointAddress, 7}.ReleaseStorage();
+
+    SerializedMessage msg{blob, 42, aggregationKind<SilKit::Services::PubSub::WireDataMessageEvent>()};
+    EXPECT_EQ(msg.GetMessageKind(), messageKind<SilKit::Services::PubSub::WireDataMessageEvent>());
+    EXPECT_EQ(msg.GetAggregationKind(), MessageAggregationKind::UserDataMessage);
+    EXPECT_EQ(msg.GetRemoteIndex(), 42u);
+    EXPECT_EQ(msg.GetEndpointAddress(), endpointAddress);
+    EXPECT_EQ(msg.ReleaseStorage(), SerializedMessage(dataMessageEvent, endpointAddress, 42).ReleaseStorage());
+}
@@ -57,7 +57,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "ILoggerInternal.hpp"
 
+#include <atomic>
 #include <chrono>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -258,6 +260,50 @@ TEST_F(Test_VAsioConnection, current_version_connect)
     _connection.OnSocketData(&_from, std::move(message));
 }
 
+//////////////////////////////////////////////////////////////////////
+// Remote receivers
+//////////////////////////////////////////////////////////////////////
+
+// The publishers query the remote receivers from the user's thread, e.g., to choose between a batch and single
+// messages, while the subscriptions arrive on the I/O thread
+TEST_F(Test_VAsioConnection, remote_receivers_are_queried_while_subscriptions_arrive)
+{
+    using MessageTrait = SilKit::Core::SilKitMsgTraits<Tests::Version1::TestMessage>;
+    const EndpointId numSubscribers = 50;
+
+    testing::NiceMock<MockSilKitMessageReceiver> publisher;
+    publisher._serviceDescriptor.SetNetworkName("unittest");
+
+    EXPECT_CALL(_from, SendSilKitMsg(_)).Times(static_cast<int>(numSubscribers));
+
+    std::atomic<bool> subscriptionsArrived{false};
+    std::thread queryThread{[this, &publisher, &subscriptionsArrived] {
+        while (!subscriptionsArrived)
+        {
+            _connection.GetNumberOfRemoteReceivers(&publisher, MessageTrait::SerdesName());
+            _connection.GetParticipantNamesOfRemoteReceivers(&publisher, MessageTrait::SerdesName());
+        }
+    }};
+
+    for (EndpointId receiverIdx = 0; receiverIdx < numSubscribers; ++receiverIdx)
+    {
+        VAsioMsgSubscriber subscriber;
+        subscriber.msgTypeName = MessageTrait::SerdesName();
+        subscriber.networkName = "unittest";
+        subscriber.version = MessageTrait::Version();
+        subscriber.receiverIdx = receiverIdx;
+
+        _connection.OnSocketData(&_from, SerializedMessage(subscriber));
+    }
+
+    subscriptionsArrived = true;
+    queryThread.join();
+
+    EXPECT_EQ(_connection.GetNumberOfRemoteReceivers(&publisher, MessageTrait::SerdesName()), numSubscribers);
+    EXPECT_EQ(_connection.GetParticipantNamesOfRemoteReceivers(&publisher, MessageTrait::SerdesName()),
+              std::vector<std::string>(numSubscribers, _from.GetInfo().participantName));
+}
+
 //////////////////////////////////////////////////////////////////////
 // Versioned subscriptions: test backward compatibility
 //////////////////////////////////////////////////////////////////////
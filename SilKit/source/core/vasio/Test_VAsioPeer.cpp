@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "VAsioPeer.hpp"
+
+#include "MockLogger.hpp"
+
+#include "MockIoContext.hpp"
+#include "MockRawByteStream.hpp"
+#include "MockTimer.hpp"
+
+#include "SerializedMessage.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+namespace {
+
+
+using namespace SilKit::Core;
+using namespace SilKit::Services::PubSub;
+
+using namespace std::chrono_literals;
+
+
+using ::testing::NiceMock;
+
+using SilKit::Services::Logging::MockLogger;
+using VSilKit::MockIoContextWithExecutionQueue;
+using VSilKit::MockRawByteStream;
+using VSilKit::MockTimer;
+
+
+struct MockVAsioPeerListener : IVAsioPeerListener
+{
+    MOCK_METHOD(void, OnSocketData, (IVAsioPeer*, SerializedMessage&&), (override));
+    MOCK_METHOD(void, OnPeerShutdown, (IVAsioPeer*), (override));
+};
+
+
+struct Test_VAsioPeer : ::testing::Test
+{
+    MockIoContextWithExecutionQueue ioContext;
+    NiceMock<MockLogger> logger;
+    MockVAsioPeerListener listener;
+
+    MockRawByteStream* stream{nullptr};
+    IRawByteStreamListener* streamListener{nullptr};
+    std::vector<std::vector<uint8_t>> writtenBlobs;
+
+    auto MakePeer() -> std::unique_ptr<VAsioPeer>
+    {
+        auto rawByteStream{std::make_unique<NiceMock<MockRawByteStream>>()};
+        stream = rawByteStream.get();
+        ON_CALL(*stream, SetListener).WillByDefault([this](IRawByteStreamListener& listener) {
+            streamListener = &listener;
+        });
+        // every write transfers the whole buffer at once
+        ON_CALL(*stream, AsyncWriteSome).WillByDefault([this](ConstBufferSequence bufferSequence) {
+            const auto buffer = bufferSequence[0];
+            const auto* data = static_cast<const uint8_t*>(buffer.GetData());
+            writtenBlobs.emplace_back(data, data + buffer.GetSize());
+            ioContext.Post([this, size = buffer.GetSize()] { streamListener->OnAsyncWriteSomeDone(*stream, size); });
+        });
+
+        EXPECT_CALL(ioContext, MakeTimer).WillOnce([] { return std::make_unique<NiceMock<MockTimer>>(); });
+
+        return std::make_unique<VAsioPeer>(&listener, &ioContext, std::move(rawByteStream), &logger);
+    }
+
+    static auto MakeDataMessage(EndpointId endpoint, uint8_t value, bool keepLatest) -> SerializedMessage
+    {
+        WireDataMessageEvent dataMessageEvent{0ns, {value}};
+        SerializedMessage message{dataMessageEvent, EndpointAddress{1, endpoint}, 2};
+        message.SetKeepLatest(keepLatest);
+        return message;
+    }
+
+    static auto ToBlob(SerializedMessage message) -> std::vector<uint8_t>
+    {
+        return message.ReleaseStorage();
+    }
+};
+
+
+TEST_F(Test_VAsioPeer, queued_messages_are_sent_in_order)
+{
+    auto peer = MakePeer();
+
+    peer->SendSilKitMsg(MakeDataMessage(10, 1, false));
+    peer->SendSilKitMsg(MakeDataMessage(10, 2, false));
+    peer->SendSilKitMsg(MakeDataMessage(10, 3, false));
+    ioContext.Run();
+
+    ASSERT_EQ(writtenBlobs.size(), 3u);
+    EXPECT_EQ(writtenBlobs[0], ToBlob(MakeDataMessage(10, 1, false)));
+    EXPECT_EQ(writtenBlobs[1], ToBlob(MakeDataMessage(10, 2, false)));
+    EXPECT_EQ(writtenBlobs[2], ToBlob(MakeDataMessage(10, 3, false)));
+}
+
+TEST_F(Test_VAsioPeer, keep_latest_messages_replace_queued_messages_of_the_same_endpoint)
+{
+    auto peer = MakePeer();
+
+    peer->SendSilKitMsg(MakeDataMessage(10, 1, true));
+    peer->SendSilKitMsg(MakeDataMessage(11, 1, true));
+    peer->SendSilKitMsg(MakeDataMessage(12, 1, false));
+    peer->SendSilKitMsg(MakeDataMessage(10, 2, true));
+    peer->SendSilKitMsg(MakeDataMessage(10, 3, true));
+    ioContext.Run();
+
+    // The outdated messages of endpoint 10 are dropped, the latest one is sent after the messages queued before it
+    ASSERT_EQ(writtenBlobs.size(), 3u);
+    EXPECT_EQ(writtenBlobs[0], ToBlob(MakeDataMessage(11, 1, true)));
+    EXPECT_EQ(writtenBlobs[1], ToBlob(MakeDataMessage(12, 1, false)));
+    EXPECT_EQ(writtenBlobs[2], ToBlob(MakeDataMessage(10, 3, true)));
+}
+
+TEST_F(Test_VAsioPeer, keep_latest_messages_being_written_are_not_replaced)
+{
+    auto peer = MakePeer();
+
+    peer->SendSilKitMsg(MakeDataMessage(10, 1, true));
+    // Only start writing the first message, without completing the write
+    ASSERT_FALSE(ioContext.handlerQueue.empty());
+    auto startWrite{std::move(ioContext.handlerQueue.front())};
+    ioContext.handlerQueue.pop_front();
+    startWrite();
+    ASSERT_EQ(writtenBlobs.size(), 1u);
+
+    peer->SendSilKitMsg(MakeDataMessage(10, 2, true));
+    ioContext.Run();
+
+    ASSERT_EQ(writtenBlobs.size(), 2u);
+    EXPECT_EQ(writtenBlobs[0], ToBlob(MakeDataMessage(10, 1, true)));
+    EXPECT_EQ(writtenBlobs[1], ToBlob(MakeDataMessage(10, 2, true)));
+}
+
+TEST_F(Test_VAsioPeer, keep_latest_messages_replace_aggregated_messages_of_the_same_endpoint)
+{
+    auto peer = MakePeer();
+    peer->EnableAggregation();
+
+    SilKit::Services::Orchestration::NextSimTask nextSimTask;
+    nextSimTask.timePoint = 1ms;
+
+    peer->SendSilKitMsg(MakeDataMessage(10, 1, true));
+    peer->SendSilKitMsg(MakeDataMessage(11, 1, true));
+    peer->SendSilKitMsg(MakeDataMessage(10, 2, true));
+    peer->SendSilKitMsg(MakeDataMessage(12, 1, false));
+    peer->SendSilKitMsg(MakeDataMessage(10, 3, true));
+    peer->SendSilKitMsg(SerializedMessage{nextSimTask});
+    ioContext.Run();
+
+    // The outdated messages of endpoint 10 are removed from the aggregate, the latest one is appended to it
+    auto expected = ToBlob(MakeDataMessage(11, 1, true));
+    for (const auto& blob : {ToBlob(MakeDataMessage(12, 1, false)), ToBlob(MakeDataMessage(10, 3, true)),
+                             ToBlob(SerializedMessage{nextSimTask})})
+    {
+        expected.insert(expected.end(), blob.begin(), blob.end());
+    }
+    ASSERT_EQ(writtenBlobs.size(), 1u);
+    EXPECT_EQ(writtenBlobs[0], expected);
+}
+
+TEST_F(Test_VAsioPeer, history_messages_are_aggregated_in_order)
+{
+    auto peer = MakePeer();
+    peer->EnableAggregation();
+
+    // A message of a history is serialized once and sent to each new receiver with its own remote index
+    auto makeHistoryMessage = [] {
+        return SerializedMessage{ToBlob(MakeDataMessage(11, 1, false)), 3, aggregationKind<WireDataMessageEvent>()};
+    };
+    SilKit::Services::Orchestration::NextSimTask nextSimTask;
+    nextSimTask.timePoint = 1ms;
+
+    peer->SendSilKitMsg(MakeDataMessage(10, 1, false));
+    peer->SendSilKitMsg(makeHistoryMessage());
+    peer->SendSilKitMsg(SerializedMessage{nextSimTask});
+    ioContext.Run();
+
+    // All messages are sent in one aggregate, i.e., the message of the history does not overtake the aggregated one
+    auto expected = ToBlob(MakeDataMessage(10, 1, false));
+    for (const auto& blob : {ToBlob(makeHistoryMessage()), ToBlob(SerializedMessage{nextSimTask})})
+    {
+        expected.insert(expected.end(), blob.begin(), blob.end());
+    }
+    ASSERT_EQ(writtenBlobs.size(), 1u);
+    EXPECT_EQ(writtenBlobs[0], expected);
+}
+
+
+} // namespace
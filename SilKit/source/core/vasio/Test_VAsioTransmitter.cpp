@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "VAsioTransmitter.hpp"
+
+#include "MockVAsioPeer.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+
+namespace {
+
+
+using namespace SilKit::Core;
+using namespace SilKit::Services::PubSub;
+
+using namespace std::chrono_literals;
+
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::ReturnRef;
+
+
+struct DummyServiceEndpoint : IServiceEndpoint
+{
+    void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
+    {
+        _serviceDescriptor = serviceDescriptor;
+    }
+    auto GetServiceDescriptor() const -> const ServiceDescriptor& override
+    {
+        return _serviceDescriptor;
+    }
+
+    ServiceDescriptor _serviceDescriptor{"P1", "N1", "C1", 5};
+};
+
+
+struct Test_VAsioTransmitter : ::testing::Test
+{
+    Test_VAsioTransmitter()
+    {
+        peerInfo.participantName = "P2";
+        ON_CALL(peer, GetInfo).WillByDefault(ReturnRef(peerInfo));
+        ON_CALL(peer, SendSilKitMsg).WillByDefault([this](SerializedMessage message) {
+            EXPECT_EQ(message.GetRemoteIndex(), remoteIdx);
+            EXPECT_EQ(message.GetEndpointAddress(), from.GetServiceDescriptor().to_endpointAddress());
+            // the messages of the history are aggregated like the new ones
+            EXPECT_EQ(message.GetAggregationKind(), MessageAggregationKind::UserDataMessage);
+            sentData.push_back(message.Deserialize<WireDataMessageEvent>().data.AsSpan()[0]);
+        });
+    }
+
+    static auto MakeDataMessage(uint8_t value) -> WireDataMessageEvent
+    {
+        return WireDataMessageEvent{1ns, {value}};
+    }
+
+    const EndpointId remoteIdx{9};
+
+    VAsioPeerInfo peerInfo;
+    NiceMock<MockVAsioPeer> peer;
+    DummyServiceEndpoint from;
+    VAsioTransmitter<WireDataMessageEvent> transmitter;
+
+    std::vector<uint8_t> sentData;
+};
+
+
+TEST_F(Test_VAsioTransmitter, new_receivers_get_the_last_message_by_default)
+{
+    transmitter.ReceiveMsg(&from, MakeDataMessage(1));
+    transmitter.ReceiveMsg(&from, MakeDataMessage(2));
+
+    transmitter.AddRemoteReceiver(&peer, remoteIdx);
+    EXPECT_EQ(sentData, (std::vector<uint8_t>{2}));
+}
+
+TEST_F(Test_VAsioTransmitter, new_receivers_get_the_last_messages_of_the_history_in_order)
+{
+    transmitter.SetHistoryLength(3);
+    for (uint8_t value = 1; value <= 5; ++value)
+    {
+        transmitter.ReceiveMsg(&from, MakeDataMessage(value));
+    }
+
+    transmitter.AddRemoteReceiver(&peer, remoteIdx);
+    EXPECT_EQ(sentData, (std::vector<uint8_t>{3, 4, 5}));
+
+    // Connected receivers get the new messages
+    transmitter.ReceiveMsg(&from, MakeDataMessage(6));
+    EXPECT_EQ(sentData, (std::vector<uint8_t>{3, 4, 5, 6}));
+}
+
+TEST_F(Test_VAsioTransmitter, new_receivers_get_no_messages_without_history)
+{
+    transmitter.SetHistoryLength(0);
+    transmitter.ReceiveMsg(&from, MakeDataMessage(1));
+
+    EXPECT_CALL(peer, SendSilKitMsg(_)).Times(0);
+    transmitter.AddRemoteReceiver(&peer, remoteIdx);
+}
+
+TEST_F(Test_VAsioTransmitter, messages_are_only_sent_to_receivers_accepted_by_the_filter)
+{
+    transmitter.AddRemoteReceiver(&peer, remoteIdx);
+    transmitter.SetReceiverFilter([](const std::string& participantName, const WireDataMessageEvent& msg) {
+        EXPECT_EQ(participantName, "P2");
+        return msg.data.AsSpan()[0] % 2 == 0;
+    });
+
+    for (uint8_t value = 1; value <= 4; ++value)
+    {
+        transmitter.ReceiveMsg(&from, MakeDataMessage(value));
+    }
+    EXPECT_EQ(sentData, (std::vector<uint8_t>{2, 4}));
+}
+
+TEST_F(Test_VAsioTransmitter, filtered_messages_are_kept_in_the_history)
+{
+    transmitter.SetReceiverFilter([](const std::string&, const WireDataMessageEvent&) { return false; });
+    transmitter.ReceiveMsg(&from, MakeDataMessage(1));
+
+    transmitter.AddRemoteReceiver(&peer, remoteIdx);
+    EXPECT_EQ(sentData, (std::vector<uint8_t>{1}));
+}
+
+
+} // namespace
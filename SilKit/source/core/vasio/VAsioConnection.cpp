@@ -42,6 +42,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "Assert.hpp"
 #include "TransformAcceptorUris.hpp"
 #include "StringHelpers.hpp"
+#include "Hash.hpp"
 
 #include "ConnectPeer.hpp"
 #include "util/TracingMacros.hpp"
@@ -222,9 +223,21 @@ auto MakeConnectKnownParticipantsSettings(const SilKit::Config::ParticipantConfi
     SilKit::Core::ConnectKnownParticipantsSettings settings;
     settings.directConnectTimeout = GetConnectTimeoutSeconds(config);
     settings.remoteConnectRequestTimeout = GetConnectTimeoutSeconds(config);
+    // Static peers are retried for the time the registry connection is attempted, since they might not be started yet
+    const auto staticPeerConnectDuration{std::max(1, config.middleware.connectAttempts)
+                                         * GetConnectTimeoutSeconds(config)};
+    settings.staticPeerConnectAttempts =
+        std::max<size_t>(1, static_cast<size_t>(staticPeerConnectDuration / settings.staticPeerRetryInterval));
     return settings;
 }
 
+auto IsStaticPeer(const SilKit::Config::ParticipantConfiguration& config, const std::string& participantName) -> bool
+{
+    const auto& staticPeers = config.middleware.staticPeers;
+    return std::any_of(staticPeers.begin(), staticPeers.end(),
+                       [&participantName](const auto& staticPeer) { return staticPeer.name == participantName; });
+}
+
 auto MakeRemoteConnectionManagerSettings(const SilKit::Config::ParticipantConfiguration& config)
     -> SilKit::Core::RemoteConnectionManagerSettings
 {
@@ -438,6 +451,9 @@ void VAsioConnection::JoinSimulation(std::string connectUri)
     // Open all configured acceptors and start accepting connections.
     OpenParticipantAcceptors(connectUri);
 
+    // Start connecting to the statically configured peers, concurrently to the registry handshake.
+    ConnectToStaticPeers();
+
     // Connects this participant to the registry. Each connection attempt has its own timeout.
     ConnectParticipantToRegistryAndStartIoWorker(connectUri);
 
@@ -472,6 +488,38 @@ void VAsioConnection::OpenParticipantAcceptors(const std::string& connectUri)
     }
 }
 
+void VAsioConnection::ConnectToStaticPeers()
+{
+    const auto& staticPeers = _config.middleware.staticPeers;
+    if (staticPeers.empty())
+    {
+        return;
+    }
+
+    // Within the static mesh, exactly one side of each pair connects: The participant with the greater name connects
+    // to the one with the lesser name. The lesser participant accepts the connection, even if it joins later.
+    std::vector<VAsioPeerInfo> peerInfos;
+    for (const auto& staticPeer : staticPeers)
+    {
+        if (!(staticPeer.name < _participantName))
+        {
+            continue;
+        }
+
+        VAsioPeerInfo peerInfo;
+        peerInfo.participantName = staticPeer.name;
+        peerInfo.participantId = Util::Hash::Hash(staticPeer.name);
+        peerInfo.acceptorUris = staticPeer.acceptorUris;
+        // The peers of a static mesh are expected to share the middleware configuration
+        peerInfo.capabilities = MakeCapabilitiesStringFromConfiguration(_config);
+        peerInfos.push_back(std::move(peerInfo));
+    }
+
+    Log::Debug(_logger, "Connecting to {} of {} static peers", peerInfos.size(), staticPeers.size());
+
+    _connectKnownParticipants.SetStaticPeers(peerInfos);
+}
+
 void VAsioConnection::ConnectParticipantToRegistryAndStartIoWorker(const std::string& connectUriString)
 {
     _logger->Debug("Connecting to SIL Kit Registry");
@@ -845,6 +893,12 @@ void VAsioConnection::ReceiveKnownParticpants(IVAsioPeer* peer, SerializedMessag
 
     peer->SetProtocolVersion(ExtractProtocolVersion(msg.messageHeader));
 
+    // Static peers are either connected already, or will connect to this participant
+    const auto isStaticPeer = [this](const VAsioPeerInfo& peerInfo) {
+        return IsStaticPeer(_config, peerInfo.participantName);
+    };
+    msg.peerInfos.erase(std::remove_if(msg.peerInfos.begin(), msg.peerInfos.end(), isStaticPeer), msg.peerInfos.end());
+
     _connectKnownParticipants.SetKnownParticipants(msg.peerInfos);
 }
 
@@ -1560,16 +1614,13 @@ bool VAsioConnection::TryAddRemoteSubscriber(IVAsioPeer* from, const VAsioMsgSub
         if (subscriber.msgTypeName != LinkType::MessageSerdesName())
             return;
 
-        // create the link under lock
+        // create the link and add the remote receiver under lock, the services query the receivers from other threads
         std::unique_lock<decltype(_linksMx)> lock{_linksMx};
         auto& link = linkMap[subscriber.networkName];
         if (!link)
         {
             link = std::make_shared<LinkType>(subscriber.networkName, _logger, _timeProvider);
         }
-        lock.unlock();
-
-        // add the remote receiver without taking the lock
         link->AddRemoteReceiver(from, subscriber.receiverIdx);
 
         wasAdded = true;
@@ -112,6 +112,7 @@ public:
 
 private: // JoinSimulation Helper Functions
     void OpenParticipantAcceptors(const std::string& connectUri);
+    void ConnectToStaticPeers();
     void ConnectParticipantToRegistryAndStartIoWorker(const std::string& connectUriString);
     void WaitForRegistryHandshakeToComplete(std::chrono::milliseconds timeout);
     void ConnectToKnownParticipants();
@@ -159,6 +160,29 @@ public:
         });
     }
 
+    template <class SilKitServiceT>
+    void SetKeepLatestForLink(bool keepLatest, SilKitServiceT* service)
+    {
+        typename SilKitServiceT::SilKitSendMessagesTypes sendMessageTypes{};
+
+        auto&& networkName = GetServiceDescriptor(service).GetNetworkName();
+
+        Util::tuple_tools::for_each(sendMessageTypes, [this, networkName, keepLatest](auto&& message) {
+            using SilKitMessageT = std::decay_t<decltype(message)>;
+            auto link = this->GetLinkByName<SilKitMessageT>(networkName);
+            link->SetKeepLatest(keepLatest);
+        });
+    }
+
+    template <typename SilKitMessageT, class SilKitServiceT>
+    void SetReceiverFilterForLink(std::function<bool(const std::string&, const SilKitMessageT&)> receiverFilter,
+                                  SilKitServiceT* service)
+    {
+        auto&& networkName = GetServiceDescriptor(service).GetNetworkName();
+        auto link = GetLinkByName<SilKitMessageT>(networkName);
+        link->SetReceiverFilter(std::move(receiverFilter));
+    }
+
     template <typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, SilKitMessageT&& msg)
     {
@@ -238,7 +262,8 @@ private: // data types
     using SilKitMessageTypes = std::tuple<
         Services::Logging::LogMsg, Services::Orchestration::NextSimTask, Services::Orchestration::SystemCommand,
         Services::Orchestration::ParticipantStatus, Services::Orchestration::WorkflowConfiguration,
-        Services::PubSub::WireDataMessageEvent, Services::Rpc::FunctionCall, Services::Rpc::FunctionCallResponse,
+        Services::PubSub::WireDataMessageEvent, Services::PubSub::WireDataMessageBatch, Services::Rpc::FunctionCall,
+        Services::Rpc::FunctionCallResponse, Services::Rpc::FunctionCallBatch, Services::Rpc::FunctionCallResponseBatch,
         Services::Can::WireCanFrameEvent, Services::Can::CanFrameTransmitEvent, Services::Can::CanControllerStatus,
         Services::Can::CanConfigureBaudrate, Services::Can::CanSetControllerMode,
         Services::Ethernet::WireEthernetFrameEvent, Services::Ethernet::EthernetFrameTransmitEvent,
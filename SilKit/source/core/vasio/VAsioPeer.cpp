@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "VAsioPeer.hpp"
 
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 #include <thread>
@@ -75,6 +76,7 @@ void VAsioPeer::Shutdown()
     {
         std::unique_lock<decltype(_sendingQueueMutex)> lock{_sendingQueueMutex};
         _sendingQueue.clear();
+        _queuedKeepLatestMessages.clear();
     }
 
     _socket->Shutdown();
@@ -118,13 +120,22 @@ void VAsioPeer::SendSilKitMsg(SerializedMessage buffer)
 {
     auto blob = buffer.ReleaseStorage();
 
-    if (_useAggregation && buffer.GetAggregationKind() == MessageAggregationKind::UserDataMessage)
+    if (buffer.GetKeepLatest() && !_useAggregation)
     {
-        Aggregate(blob);
+        QueuedMessage message;
+        message.blob = std::move(blob);
+        message.keepLatest = true;
+        message.endpointAddress = buffer.GetEndpointAddress();
+        message.remoteIndex = buffer.GetRemoteIndex();
+        SendSilKitMsgInternal(std::move(message));
+    }
+    else if (_useAggregation && buffer.GetAggregationKind() == MessageAggregationKind::UserDataMessage)
+    {
+        Aggregate(blob, buffer.GetKeepLatest(), KeepLatestKey{buffer.GetEndpointAddress(), buffer.GetRemoteIndex()});
     }
     else if (_useAggregation && buffer.GetAggregationKind() == MessageAggregationKind::FlushAggregationMessage)
     {
-        Aggregate(blob); // don't forget to send (current) time sync message
+        Aggregate(blob, false, {}); // don't forget to send (current) time sync message
         Flush();
     }
     else
@@ -134,13 +145,36 @@ void VAsioPeer::SendSilKitMsg(SerializedMessage buffer)
 }
 
 void VAsioPeer::SendSilKitMsgInternal(std::vector<uint8_t> blob)
+{
+    QueuedMessage message;
+    message.blob = std::move(blob);
+    SendSilKitMsgInternal(std::move(message));
+}
+
+void VAsioPeer::SendSilKitMsgInternal(QueuedMessage message)
 {
     // Prevent sending when shutting down
     if (!_isShuttingDown && _socket != nullptr)
     {
         std::unique_lock<std::mutex> lock{_sendingQueueMutex};
 
-        _sendingQueue.emplace_back(std::move(blob));
+        if (message.keepLatest)
+        {
+            // The outdated message is dropped instead of being overwritten in place. Otherwise, the newer message would
+            // overtake the messages that were queued in between, e.g., the time advances of its sender.
+            auto& queued = _queuedKeepLatestMessages[KeepLatestKey{message.endpointAddress, message.remoteIndex}];
+            if (queued != nullptr)
+            {
+                queued->outdated = true;
+                queued->blob = {};
+            }
+            _sendingQueue.emplace_back(std::move(message));
+            queued = &_sendingQueue.back();
+        }
+        else
+        {
+            _sendingQueue.emplace_back(std::move(message));
+        }
 
         lock.unlock();
 
@@ -148,7 +182,7 @@ void VAsioPeer::SendSilKitMsgInternal(std::vector<uint8_t> blob)
     }
 }
 
-void VAsioPeer::Aggregate(const std::vector<uint8_t>& blob)
+void VAsioPeer::Aggregate(const std::vector<uint8_t>& blob, bool keepLatest, const KeepLatestKey& keepLatestKey)
 {
     // start initial timer
     // NB: resetting timer in every Aggregate() is costly
@@ -158,6 +192,28 @@ void VAsioPeer::Aggregate(const std::vector<uint8_t>& blob)
         _initialTimerStarted = true;
     }
 
+    if (keepLatest)
+    {
+        // Like in the sending queue, the outdated message is removed and the newer message is appended
+        auto outdated = _aggregatedKeepLatestMessages.find(keepLatestKey);
+        if (outdated != _aggregatedKeepLatestMessages.end())
+        {
+            const auto removed = outdated->second;
+            const auto removedBegin = _aggregatedMessages.begin() + static_cast<std::ptrdiff_t>(removed.offset);
+            _aggregatedMessages.erase(removedBegin, removedBegin + static_cast<std::ptrdiff_t>(removed.size));
+            _aggregatedKeepLatestMessages.erase(outdated);
+
+            for (auto& entry : _aggregatedKeepLatestMessages)
+            {
+                if (entry.second.offset > removed.offset)
+                {
+                    entry.second.offset -= removed.size;
+                }
+            }
+        }
+        _aggregatedKeepLatestMessages[keepLatestKey] = AggregatedMessage{_aggregatedMessages.size(), blob.size()};
+    }
+
     _aggregatedMessages.insert(_aggregatedMessages.end(), blob.begin(), blob.end());
 
     // ensure that the aggregation buffer does not exceed a certain size
@@ -175,6 +231,7 @@ void VAsioPeer::Flush()
 {
     decltype(_aggregatedMessages) blob;
     blob.swap(_aggregatedMessages);
+    _aggregatedKeepLatestMessages.clear();
     SendSilKitMsgInternal(std::move(blob));
 
     // reset timer when flush is triggered
@@ -187,6 +244,10 @@ void VAsioPeer::StartAsyncWrite()
         return;
 
     std::unique_lock<std::mutex> lock{_sendingQueueMutex};
+    while (!_sendingQueue.empty() && _sendingQueue.front().outdated)
+    {
+        _sendingQueue.pop_front();
+    }
     if (_sendingQueue.empty())
     {
         return;
@@ -194,7 +255,13 @@ void VAsioPeer::StartAsyncWrite()
 
     _sending = true;
 
-    _currentSendingBufferData = std::move(_sendingQueue.front());
+    auto& message = _sendingQueue.front();
+    if (message.keepLatest)
+    {
+        // The message is written now and can no longer be replaced
+        _queuedKeepLatestMessages.erase(KeepLatestKey{message.endpointAddress, message.remoteIndex});
+    }
+    _currentSendingBufferData = std::move(message.blob);
     _sendingQueue.pop_front();
     lock.unlock();
 
@@ -23,6 +23,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 
 #include <vector>
+#include <map>
 #include <queue>
 #include <mutex>
 #include <sstream>
@@ -97,6 +98,27 @@ public:
 
     void EnableAggregation() override;
 
+private:
+    // ----------------------------------------
+    // Private Data Types
+    struct QueuedMessage
+    {
+        std::vector<uint8_t> blob;
+        // Only set for messages which may be replaced by a newer message of the same sender and receiver
+        bool keepLatest{false};
+        EndpointAddress endpointAddress{};
+        EndpointId remoteIndex{0};
+        // Set if a newer message of the same sender and receiver was queued, the message is dropped instead of sent
+        bool outdated{false};
+    };
+    // The sender and receiver of a message which may be replaced by a newer message
+    using KeepLatestKey = std::pair<EndpointAddress, EndpointId>;
+    struct AggregatedMessage
+    {
+        size_t offset;
+        size_t size;
+    };
+
 private:
     // ----------------------------------------
     // Private Methods
@@ -105,7 +127,8 @@ private:
     void ReadSomeAsync();
     void DispatchBuffer();
     void SendSilKitMsgInternal(std::vector<uint8_t> blob);
-    void Aggregate(const std::vector<uint8_t>& blob);
+    void SendSilKitMsgInternal(QueuedMessage message);
+    void Aggregate(const std::vector<uint8_t>& blob, bool keepLatest, const KeepLatestKey& keepLatestKey);
     void Flush();
 
 private: // IRawByteStreamListener
@@ -137,10 +160,14 @@ private:
 
     // sending
     mutable std::mutex _sendingQueueMutex;
-    std::deque<std::vector<uint8_t>> _sendingQueue;
+    std::deque<QueuedMessage> _sendingQueue;
+    // The queued messages which may still be replaced, references into the deque stay valid on push_back and pop_front
+    std::map<KeepLatestKey, QueuedMessage*> _queuedKeepLatestMessages;
     ConstBuffer _currentSendingBuffer;
     std::vector<uint8_t> _currentSendingBufferData;
     std::vector<uint8_t> _aggregatedMessages;
+    // The messages in the aggregation buffer which may still be replaced
+    std::map<KeepLatestKey, AggregatedMessage> _aggregatedKeepLatestMessages;
 
     std::atomic_bool _sending{false};
     Core::ServiceDescriptor _serviceDescriptor;
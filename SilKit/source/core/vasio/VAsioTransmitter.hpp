@@ -21,6 +21,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <deque>
+#include <functional>
 #include <sstream>
 
 #include "IVAsioPeer.hpp"
@@ -45,41 +47,54 @@ template <typename MsgT>
 struct MessageHistory<MsgT, 0>
 {
     void SetHistoryLength(size_t) {}
-    void Save(const IServiceEndpoint*, const MsgT&) {}
+    bool IsEnabled() const
+    {
+        return false;
+    }
+    void Save(std::vector<uint8_t>) {}
     void NotifyPeer(IVAsioPeer*, EndpointId) {}
 };
-// MessageHistory<.., 1>: save last message and notify peers about it
+// MessageHistory<.., 1>: save the last messages (by default, only the last one) and notify peers about them
 template <typename MsgT>
 struct MessageHistory<MsgT, 1>
 {
     void SetHistoryLength(size_t historyLength)
     {
-        _hasHistory = historyLength != 0;
+        _historyLength = historyLength;
+        while (_history.size() > _historyLength)
+        {
+            _history.pop_front();
+        }
+    }
+
+    bool IsEnabled() const
+    {
+        return _historyLength != 0;
     }
 
-    void Save(const IServiceEndpoint* from, const MsgT& msg)
+    // The messages are kept serialized, and only their remote index is replaced when they are replayed
+    void Save(std::vector<uint8_t> blob)
     {
-        if (!_hasHistory)
+        if (!IsEnabled())
             return;
 
-        _from = from->GetServiceDescriptor().to_endpointAddress();
-        _last = msg;
-        _hasValue = true;
+        if (_history.size() == _historyLength)
+        {
+            _history.pop_front();
+        }
+        _history.push_back(std::move(blob));
     }
     void NotifyPeer(IVAsioPeer* peer, EndpointId remoteIdx)
     {
-        if (!_hasValue || !_hasHistory)
-            return;
-
-        auto buffer = SerializedMessage(_last, _from, remoteIdx);
-        peer->SendSilKitMsg(std::move(buffer));
+        for (const auto& blob : _history)
+        {
+            peer->SendSilKitMsg(SerializedMessage{blob, remoteIdx, aggregationKind<MsgT>()});
+        }
     }
 
 private:
-    MsgT _last;
-    EndpointAddress _from;
-    bool _hasValue{false};
-    bool _hasHistory{true};
+    size_t _historyLength{1};
+    std::deque<std::vector<uint8_t>> _history;
 };
 
 
@@ -145,7 +160,6 @@ public:
 
     void SendMessageToTarget(const IServiceEndpoint* from, const std::string& targetParticipantName, const MsgT& msg)
     {
-        _hist.Save(from, msg);
         auto&& receiverIter =
             std::find_if(_remoteReceivers.begin(), _remoteReceivers.end(), [targetParticipantName](auto&& receiver) {
             return receiver.peer->GetInfo().participantName == targetParticipantName;
@@ -158,6 +172,11 @@ public:
             throw SilKitError{ss.str()};
         }
         auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiverIter->remoteIdx);
+        if (_hist.IsEnabled())
+        {
+            _hist.Save(SerializedMessage{buffer}.ReleaseStorage());
+        }
+        buffer.SetKeepLatest(_keepLatest);
         receiverIter->peer->SendSilKitMsg(std::move(buffer));
     }
 
@@ -166,15 +185,46 @@ public:
         _hist.SetHistoryLength(historyLength);
     }
 
+    void SetKeepLatest(bool keepLatest)
+    {
+        _keepLatest = keepLatest;
+    }
+
+    //! Messages are only sent to the remote receivers whose participant is accepted by the filter.
+    void SetReceiverFilter(std::function<bool(const std::string&, const MsgT&)> receiverFilter)
+    {
+        _receiverFilter = std::move(receiverFilter);
+    }
+
 public:
     // ----------------------------------------
     // Public interface methods
     void ReceiveMsg(const IServiceEndpoint* from, const MsgT& msg) override
     {
-        _hist.Save(from, msg);
+        if (_hist.IsEnabled())
+        {
+            // Serialize the message only once, for the history and all receivers
+            auto blob = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), 0).ReleaseStorage();
+            for (auto& receiver : _remoteReceivers)
+            {
+                if (!IsWantedBy(receiver, msg))
+                    continue;
+
+                auto buffer = SerializedMessage(blob, receiver.remoteIdx, aggregationKind<MsgT>());
+                buffer.SetKeepLatest(_keepLatest);
+                receiver.peer->SendSilKitMsg(std::move(buffer));
+            }
+            _hist.Save(std::move(blob));
+            return;
+        }
+
         for (auto& receiver : _remoteReceivers)
         {
+            if (!IsWantedBy(receiver, msg))
+                continue;
+
             auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiver.remoteIdx);
+            buffer.SetKeepLatest(_keepLatest);
             receiver.peer->SendSilKitMsg(std::move(buffer));
         }
     }
@@ -189,11 +239,21 @@ public:
         return _serviceDescriptor;
     }
 
+private:
+    // ----------------------------------------
+    // private methods
+    bool IsWantedBy(const RemoteReceiver& receiver, const MsgT& msg) const
+    {
+        return !_receiverFilter || _receiverFilter(receiver.peer->GetInfo().participantName, msg);
+    }
+
 private:
     // ----------------------------------------
     // private members
     std::vector<RemoteReceiver> _remoteReceivers;
     ServiceDescriptor _serviceDescriptor;
+    bool _keepLatest{false};
+    std::function<bool(const std::string&, const MsgT&)> _receiverFilter;
 };
 
 // ================================================================================
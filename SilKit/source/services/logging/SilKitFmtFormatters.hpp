@@ -108,9 +108,12 @@ MAKE_FORMATTER(SilKit::Services::Orchestration::SystemCommand);
 MAKE_FORMATTER(SilKit::Services::Orchestration::WorkflowConfiguration);
 
 MAKE_FORMATTER(SilKit::Services::PubSub::WireDataMessageEvent);
+MAKE_FORMATTER(SilKit::Services::PubSub::WireDataMessageBatch);
 
 MAKE_FORMATTER(SilKit::Services::Rpc::FunctionCall);
 MAKE_FORMATTER(SilKit::Services::Rpc::FunctionCallResponse);
+MAKE_FORMATTER(SilKit::Services::Rpc::FunctionCallBatch);
+MAKE_FORMATTER(SilKit::Services::Rpc::FunctionCallResponseBatch);
 
 
 MAKE_FORMATTER(SilKit::Core::ServiceDescriptor);
@@ -0,0 +1,18 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <string>
+
+namespace VSilKit {
+
+//! In contrast to a string list, each event is submitted only once, with the next update of the metrics.
+struct IEventListMetric
+{
+    virtual ~IEventListMetric() = default;
+    virtual void Add(const std::string& event) = 0;
+};
+
+} // namespace VSilKit
@@ -10,6 +10,7 @@
 #include "ICounterMetric.hpp"
 #include "IStatisticMetric.hpp"
 #include "IStringListMetric.hpp"
+#include "IEventListMetric.hpp"
 #include "IMetricsManager.hpp"
 #include "IMetricsSender.hpp"
 #include "IMetricsProcessor.hpp"
@@ -20,6 +21,7 @@ namespace Core {
 using VSilKit::ICounterMetric;
 using VSilKit::IStatisticMetric;
 using VSilKit::IStringListMetric;
+using VSilKit::IEventListMetric;
 using VSilKit::IMetricsManager;
 using VSilKit::IMetricsProcessor;
 using VSilKit::IMetricsSender;
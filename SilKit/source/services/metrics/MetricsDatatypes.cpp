@@ -32,6 +32,8 @@ auto operator<<(std::ostream& os, const MetricKind& metricKind) -> std::ostream&
         return os << "MetricKind::STATISTIC";
     case MetricKind::STRING_LIST:
         return os << "MetricKind::STRING_LIST";
+    case MetricKind::EVENT_LIST:
+        return os << "MetricKind::EVENT_LIST";
     default:
         return os << "MetricKind(" << static_cast<std::underlying_type_t<MetricKind>>(metricKind) << ")";
     }
@@ -24,6 +24,8 @@ struct MetricKindString
             return ostream << "STATISTIC";
         case VSilKit::MetricKind::STRING_LIST:
             return ostream << "STRING_LIST";
+        case VSilKit::MetricKind::EVENT_LIST:
+            return ostream << "EVENT_LIST";
         default:
             return ostream << static_cast<std::underlying_type_t<VSilKit::MetricKind>>(self.kind);
         }
@@ -41,6 +41,45 @@ auto MetricClockNow() -> VSilKit::MetricTimePoint
     return VSilKit::MetricClock::now();
 }
 #endif
+
+// Formats the strings as a JSON array of strings
+auto FormatStrings(const std::vector<std::string> &strings) -> std::string
+{
+    std::string result;
+    const auto formatString = [](std::string &result, const std::string &string) {
+        result.push_back('"');
+        for (const char ch : string)
+        {
+            switch (ch)
+            {
+            case '\\':
+                result.push_back(ch);
+                result.push_back(ch);
+                break;
+            case '"':
+                result.push_back('\\');
+                result.push_back(ch);
+                break;
+            default:
+                result.push_back(ch);
+                break;
+            }
+        }
+        result.push_back('"');
+    };
+
+    result.push_back('[');
+    for (size_t index = 0; index != strings.size(); ++index)
+    {
+        if (index != 0)
+        {
+            result.push_back(',');
+        }
+        formatString(result, strings[index]);
+    }
+    result.push_back(']');
+    return result;
+}
 } // namespace
 namespace VSilKit {
 
@@ -117,6 +156,31 @@ private:
 };
 
 
+class MetricsManager::EventListMetric
+    : public IEventListMetric
+    , public IMetric
+{
+public:
+    EventListMetric();
+
+public: // IEventListMetric
+    void Add(std::string const &event) override;
+
+public: // MetricsManager::IMetric
+    auto GetMetricKind() const -> MetricKind override;
+    auto GetUpdateTime() const -> MetricTimePoint override;
+    auto FormatValue() const -> std::string override;
+    void OnSubmitted() override;
+
+private:
+    // Bounds the memory if the metrics are never submitted, e.g., because no metrics sinks are configured
+    static constexpr size_t maxPendingEvents{100000};
+
+    MetricTimePoint _timestamp;
+    std::vector<std::string> _events;
+};
+
+
 MetricsManager::MetricsManager(std::string participantName, IMetricsProcessor &processor)
     : _participantName{std::move(participantName)}
     , _processor{&processor}
@@ -146,7 +210,7 @@ void MetricsManager::SubmitUpdates()
         for (const auto &pair : _metrics)
         {
             const auto &name = pair.first;
-            const auto *metric = pair.second.get();
+            auto *metric = pair.second.get();
 
             const auto timepoint = metric->GetUpdateTime();
             if (timepoint <= _lastSubmitUpdate)
@@ -161,6 +225,7 @@ void MetricsManager::SubmitUpdates()
             data.value = metric->FormatValue();
 
             msg.metrics.emplace_back(std::move(data));
+            metric->OnSubmitted();
         }
 
         _lastSubmitUpdate = MetricClockNow();
@@ -190,6 +255,11 @@ auto MetricsManager::GetStringList(const std::string &name) -> IStringListMetric
     return &dynamic_cast<IStringListMetric &>(*GetOrCreateMetric(name, MetricKind::STRING_LIST));
 }
 
+auto MetricsManager::GetEventList(const std::string &name) -> IEventListMetric *
+{
+    return &dynamic_cast<IEventListMetric &>(*GetOrCreateMetric(name, MetricKind::EVENT_LIST));
+}
+
 
 // MetricsManager
 
@@ -212,6 +282,9 @@ auto MetricsManager::GetOrCreateMetric(std::string name, MetricKind kind) -> IMe
         case MetricKind::STRING_LIST:
             it = _metrics.emplace(name, std::make_unique<StringListMetric>()).first;
             break;
+        case MetricKind::EVENT_LIST:
+            it = _metrics.emplace(name, std::make_unique<EventListMetric>()).first;
+            break;
         default:
             throw SilKit::SilKitError{fmt::format("Invalid MetricKind ({})", kind)};
         }
@@ -323,40 +396,41 @@ auto MetricsManager::StringListMetric::GetUpdateTime() const -> MetricTimePoint
 
 auto MetricsManager::StringListMetric::FormatValue() const -> std::string
 {
-    std::string result;
-    const auto formatString = [](std::string &result, const std::string &string) {
-        result.push_back('"');
-        for (const char ch : string)
-        {
-            switch (ch)
-            {
-            case '\\':
-                result.push_back(ch);
-                result.push_back(ch);
-                break;
-            case '"':
-                result.push_back('\\');
-                result.push_back(ch);
-                break;
-            default:
-                result.push_back(ch);
-                break;
-            }
-        }
-        result.push_back('"');
-    };
+    return FormatStrings(_strings);
+}
 
-    result.push_back('[');
-    for (size_t index = 0; index != _strings.size(); ++index)
+
+// EventListMetric
+
+MetricsManager::EventListMetric::EventListMetric() = default;
+
+void MetricsManager::EventListMetric::Add(std::string const &event)
+{
+    _timestamp = MetricClockNow();
+    if (_events.size() < maxPendingEvents)
     {
-        if (index != 0)
-        {
-            result.push_back(',');
-        }
-        formatString(result, _strings[index]);
+        _events.emplace_back(event);
     }
-    result.push_back(']');
-    return result;
+}
+
+auto MetricsManager::EventListMetric::GetMetricKind() const -> MetricKind
+{
+    return MetricKind::EVENT_LIST;
+}
+
+auto MetricsManager::EventListMetric::GetUpdateTime() const -> MetricTimePoint
+{
+    return _timestamp;
+}
+
+auto MetricsManager::EventListMetric::FormatValue() const -> std::string
+{
+    return FormatStrings(_events);
+}
+
+void MetricsManager::EventListMetric::OnSubmitted()
+{
+    _events.clear();
 }
 
 
@@ -41,11 +41,14 @@ private:
         virtual auto GetMetricKind() const -> MetricKind = 0;
         virtual auto GetUpdateTime() const -> MetricTimePoint = 0;
         virtual auto FormatValue() const -> std::string = 0;
+        //! Called after the formatted value was submitted
+        virtual void OnSubmitted() {}
     };
 
     class CounterMetric;
     class StatisticMetric;
     class StringListMetric;
+    class EventListMetric;
 
 public:
     MetricsManager(std::string participantName, IMetricsProcessor& processor);
@@ -57,6 +60,7 @@ public: // IMetricsManager
     auto GetCounter(const std::string& name) -> ICounterMetric* override;
     auto GetStatistic(const std::string& name) -> IStatisticMetric* override;
     auto GetStringList(const std::string& name) -> IStringListMetric* override;
+    auto GetEventList(const std::string& name) -> IEventListMetric* override;
 
 private:
     auto GetOrCreateMetric(std::string name, MetricKind kind) -> IMetric*;
@@ -4,93 +4,33 @@
 
 #include "MetricsTimerThread.hpp"
 
-#include "SetThreadName.hpp"
-
 namespace VSilKit {
 
-MetricsTimerThread::MetricsTimerThread(std::function<void()> callback)
+MetricsTimerThread::MetricsTimerThread(std::function<void()> callback, SilKit::Services::Logging::ILogger* logger)
     : _callback{std::move(callback)}
-    , _thread{MakeThread()}
+    , _logger{logger}
 {
 }
 
 MetricsTimerThread::~MetricsTimerThread()
 {
-    if (!_started.exchange(true))
-    {
-        try
-        {
-            _go.set_value();
-        }
-        catch (const std::future_error &)
-        {
-        }
-    }
-
-    try
-    {
-        _done.set_value();
-    }
-    catch (const std::future_error &)
-    {
-    }
-
-    if (_thread.joinable())
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    if (_thread)
     {
-        _thread.join();
+        _thread->Remove(this);
     }
 }
 
 void MetricsTimerThread::Start()
 {
-    if (!_started.exchange(true))
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    if (_thread || !_callback)
     {
-        try
-        {
-            _go.set_value();
-        }
-        catch (const std::future_error &)
-        {
-        }
+        return;
     }
-}
-
-auto MetricsTimerThread::MakeThread() -> std::thread
-{
-    auto go = _go.get_future();
-    auto done = _done.get_future();
-    return std::thread{[go = std::move(go), done = std::move(done), callback = &_callback]() mutable {
-        try
-        {
-            SilKit::Util::SetThreadName("SK Metrics");
-
-            go.get();
-
-            while (true)
-            {
-                if (done.wait_for(std::chrono::seconds{1}) != std::future_status::timeout)
-                {
-                    break;
-                }
 
-                if (*callback)
-                {
-                    try
-                    {
-                        (*callback)();
-                    }
-                    catch (...)
-                    {
-                        // ignore exceptions thrown in the callback
-                    }
-                }
-            }
-        }
-        catch (...)
-        {
-            // leaking an exception here can result in a hard crash
-        }
-    }};
+    _thread = SilKit::Util::SharedPeriodicThread::Get(std::chrono::seconds{1}, "SK Metrics");
+    _thread->Add(this, [this] { _callback(); }, _logger);
 }
 
 } // namespace VSilKit
@@ -6,31 +6,32 @@
 
 #include "IMetricsTimerThread.hpp"
 
-#include <atomic>
+#include "SharedPeriodicThread.hpp"
+
+#include "silkit/services/logging/ILogger.hpp"
+
 #include <functional>
-#include <future>
-#include <thread>
+#include <memory>
+#include <mutex>
 
 namespace VSilKit {
 
+//! Invokes the callback once per second after Start() was called. The underlying thread is shared by all metrics
+//! timers of the process. Exceptions thrown by the callback are logged to the given logger.
 class MetricsTimerThread : public IMetricsTimerThread
 {
-    std::atomic<bool> _started{false};
-    std::promise<void> _go;
-    std::promise<void> _done;
+    std::mutex _mutex;
     std::function<void()> _callback;
+    SilKit::Services::Logging::ILogger* _logger;
 
-    std::thread _thread;
+    std::shared_ptr<SilKit::Util::SharedPeriodicThread> _thread;
 
 public:
-    explicit MetricsTimerThread(std::function<void()> callback);
+    MetricsTimerThread(std::function<void()> callback, SilKit::Services::Logging::ILogger* logger);
 
     ~MetricsTimerThread() override;
 
     void Start() override;
-
-private:
-    auto MakeThread() -> std::thread;
 };
 
-} // namespace VSilKit
\ No newline at end of file
+} // namespace VSilKit
@@ -37,6 +37,12 @@ MATCHER_P2(MetricsUpdateWithSingleMetricWithNameAndKind, metricName, metricKind,
     return arg.metrics.size() == 1 && Matches(MetricDataWithNameAndKind(metricName, metricKind))(arg.metrics.front());
 }
 
+MATCHER_P2(MetricsUpdateWithSingleEventListWithNameAndValue, metricName, metricValue, "")
+{
+    return arg.metrics.size() == 1 && arg.metrics.front().name == metricName
+           && arg.metrics.front().kind == MetricKind::EVENT_LIST && arg.metrics.front().value == metricValue;
+}
+
 
 TEST(Test_MetricsManager, counter_metric_create_and_update_only_submits_after_change)
 {
@@ -119,4 +125,39 @@ TEST(Test_MetricsManager, string_list_metric_create_and_update_only_submits_afte
 }
 
 
+TEST(Test_MetricsManager, event_list_metric_submits_each_event_once)
+{
+    const std::string participantName{"Participant Name"};
+    const std::string metricName{"Event-List Metric"};
+
+    MockMetricsProcessor mockMetricsProcessor;
+    testing::Sequence sequence;
+    EXPECT_CALL(mockMetricsProcessor, Process(participantName, MetricsUpdateWithSingleEventListWithNameAndValue(
+                                                                   metricName, R"(["1","2"])")))
+        .Times(1)
+        .InSequence(sequence);
+    EXPECT_CALL(mockMetricsProcessor, Process(participantName, MetricsUpdateWithSingleEventListWithNameAndValue(
+                                                                   metricName, R"(["3"])")))
+        .Times(1)
+        .InSequence(sequence);
+
+    MetricsManager metricsManager{participantName, mockMetricsProcessor};
+
+    auto metric = metricsManager.GetEventList(metricName);
+    // no events to report, no Process call should be made
+    metricsManager.SubmitUpdates();
+
+    metric->Add("1");
+    metric->Add("2");
+    // events to report, single Process call
+    metricsManager.SubmitUpdates();
+    // the events were already submitted, no Process call should be made
+    metricsManager.SubmitUpdates();
+
+    metric->Add("3");
+    // only the new event is reported
+    metricsManager.SubmitUpdates();
+}
+
+
 } // anonymous namespace
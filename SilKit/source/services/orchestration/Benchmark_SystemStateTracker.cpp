@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+// Scale benchmark for the SystemStateTracker.
+//
+// Simulates the participant status streams of a simulation with a configurable number of required participants, as
+// seen by a single SystemMonitor, and reports the results as JSON.
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "SystemStateTracker.hpp"
+#include "BenchmarkResults.hpp"
+#include "CommandlineParser.hpp"
+
+namespace {
+
+using SilKit::Services::Orchestration::ParticipantState;
+using SilKit::Services::Orchestration::ParticipantStatus;
+using VSilKit::Benchmark::MeasurePhase;
+using VSilKit::Benchmark::ScenarioResult;
+
+using CliParser = SilKit::Util::CommandlineParser;
+
+// The lifecycle every participant goes through, from creation to shutdown
+const std::vector<ParticipantState> startupStates{
+    ParticipantState::ServicesCreated,
+    ParticipantState::CommunicationInitializing,
+    ParticipantState::CommunicationInitialized,
+    ParticipantState::ReadyToRun,
+    ParticipantState::Running,
+};
+
+const std::vector<ParticipantState> shutdownStates{
+    ParticipantState::Stopping,
+    ParticipantState::Stopped,
+    ParticipantState::ShuttingDown,
+    ParticipantState::Shutdown,
+};
+
+auto RunScenario(std::uint64_t numParticipants) -> ScenarioResult
+{
+    ScenarioResult result;
+    result.parameters = {{"participants", numParticipants}};
+
+    std::vector<std::string> participantNames;
+    participantNames.reserve(numParticipants);
+    for (std::uint64_t i = 0; i < numParticipants; ++i)
+    {
+        participantNames.push_back("Participant" + std::to_string(i));
+    }
+
+    VSilKit::SystemStateTracker tracker;
+
+    // All participants advance in lockstep, i.e., every participant reports a state before anyone reports the next
+    auto updateAll = [&tracker, &participantNames](const std::vector<ParticipantState>& states) {
+        std::uint64_t systemStateChanges{0};
+        ParticipantStatus status;
+        for (const auto state : states)
+        {
+            for (const auto& participantName : participantNames)
+            {
+                status.participantName = participantName;
+                status.state = state;
+                status.enterTime = std::chrono::system_clock::now();
+                if (tracker.UpdateParticipantStatus(status).systemStateChanged)
+                {
+                    ++systemStateChanges;
+                }
+            }
+        }
+        return systemStateChanges;
+    };
+
+    result.phases.push_back(MeasurePhase("UpdateRequiredParticipants", 1, [&] {
+        return tracker.UpdateRequiredParticipants(participantNames).systemStateChanged ? std::uint64_t{1}
+                                                                                      : std::uint64_t{0};
+    }));
+
+    result.phases.push_back(MeasurePhase("Startup", numParticipants * startupStates.size(),
+                                         [&] { return updateAll(startupStates); }));
+
+    result.phases.push_back(MeasurePhase("Shutdown", numParticipants * shutdownStates.size(),
+                                         [&] { return updateAll(shutdownStates); }));
+
+    result.phases.push_back(MeasurePhase("RemoveParticipant", numParticipants, [&] {
+        std::uint64_t systemStateChanges{0};
+        for (const auto& participantName : participantNames)
+        {
+            if (tracker.RemoveParticipant(participantName).systemStateChanged)
+            {
+                ++systemStateChanges;
+            }
+        }
+        return systemStateChanges;
+    }));
+
+    return result;
+}
+
+} // namespace
+
+
+int main(int argc, char** argv)
+{
+    CliParser commandlineParser;
+    VSilKit::Benchmark::AddCommonOptions(commandlineParser);
+    commandlineParser.Add<CliParser::Option>(
+        "participants", "p", "10,100,1000", "[--participants <n1,n2,...>]",
+        "-p, --participants <n1,n2,...>: Comma separated list of participant counts, one scenario each. Defaults to "
+        "'10,100,1000'.");
+
+    std::vector<std::uint64_t> participantCounts;
+    try
+    {
+        commandlineParser.ParseArguments(argc, argv);
+        participantCounts =
+            VSilKit::Benchmark::ParseCountList(commandlineParser.Get<CliParser::Option>("participants").Value());
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        commandlineParser.PrintUsageInfo(std::cerr, argv[0]);
+        return -1;
+    }
+
+    if (commandlineParser.Get<CliParser::Flag>("help").Value())
+    {
+        commandlineParser.PrintUsageInfo(std::cout, argv[0]);
+        return 0;
+    }
+
+    std::vector<ScenarioResult> results;
+    for (const auto numParticipants : participantCounts)
+    {
+        results.push_back(RunScenario(numParticipants));
+    }
+
+    return VSilKit::Benchmark::WriteResults(commandlineParser, "SystemStateTracker", "systemStateChanges", results);
+}
@@ -69,6 +69,18 @@ auto ValidateParticipantStateUpdate(ParticipantState oldParticipantState, Partic
     }
 }
 
+auto ToParticipantStateIndex(ParticipantState participantState) -> size_t
+{
+    // The participant states are numbered in steps of ten, from Invalid (0) to Aborting (120)
+    const auto value{static_cast<size_t>(participantState)};
+    if (value % 10 == 0 && value / 10 < 13)
+    {
+        return value / 10;
+    }
+
+    return 13;
+}
+
 auto FormatTimePoint(std::chrono::system_clock::time_point timePoint) -> std::string
 {
     std::time_t enterTime = std::chrono::system_clock::to_time_t(timePoint);
@@ -113,6 +125,8 @@ auto SystemStateTracker::UpdateRequiredParticipants(SilKit::Util::Span<const std
     _requiredParticipants.clear();
     _requiredParticipants.insert(requiredParticipantNames.begin(), requiredParticipantNames.end());
 
+    RecountRequiredParticipantStates();
+
     // recompute the system state
 
     UpdateRequiredParticipantsResult result;
@@ -208,6 +222,7 @@ auto SystemStateTracker::RemoveParticipant(const std::string& participantName) -
 
     if (participantStatusIt != _participantStatusCache.end())
     {
+        RemoveRequiredParticipantState(participantName, participantStatusIt->second.state);
         _participantStatusCache.erase(participantStatusIt);
 
         const auto oldSystemState{_systemState};
@@ -261,6 +276,7 @@ auto SystemStateTracker::GetOrCreateParticipantStatus(const std::string& partici
         participantStatus.state = SilKit::Services::Orchestration::ParticipantState::Invalid;
 
         it = _participantStatusCache.emplace(participantName, std::move(participantStatus)).first;
+        AddRequiredParticipantState(participantName, it->second.state);
     }
 
     return it->second;
@@ -270,7 +286,20 @@ void SystemStateTracker::SetParticipantStatus(const std::string& participantName
                                               const ParticipantStatus& participantStatus)
 {
     std::lock_guard<decltype(_mutex)> lock{_mutex};
-    _participantStatusCache[participantName] = participantStatus;
+
+    auto it{_participantStatusCache.find(participantName)};
+
+    if (it == _participantStatusCache.end())
+    {
+        it = _participantStatusCache.emplace(participantName, participantStatus).first;
+    }
+    else
+    {
+        RemoveRequiredParticipantState(participantName, it->second.state);
+        it->second = participantStatus;
+    }
+
+    AddRequiredParticipantState(participantName, it->second.state);
 }
 
 auto SystemStateTracker::GetAnyRequiredParticipantState() const -> ParticipantState
@@ -297,24 +326,9 @@ auto SystemStateTracker::ComputeSystemState(ParticipantState newParticipantState
 
     auto ChangeToIfAllIn = [this, &newSystemState](SystemState systemState,
                                                    std::initializer_list<ParticipantState> stateList) {
-        for (const auto& requiredParticipantName : _requiredParticipants)
+        if (!AllRequiredParticipantsIn(stateList))
         {
-            const auto* const requiredParticipantStatus{GetParticipantStatus(requiredParticipantName)};
-            if (requiredParticipantStatus == nullptr)
-            {
-                return false;
-            }
-
-            const auto requiredParticipantState{requiredParticipantStatus->state};
-
-            const bool accepted = std::any_of(
-                begin(stateList), end(stateList),
-                [requiredParticipantState](auto candidate) { return candidate == requiredParticipantState; });
-
-            if (!accepted)
-            {
-                return false;
-            }
+            return false;
         }
 
         newSystemState = systemState;
@@ -421,5 +435,49 @@ auto SystemStateTracker::ComputeSystemState(ParticipantState newParticipantState
     return newSystemState;
 }
 
+void SystemStateTracker::RecountRequiredParticipantStates()
+{
+    _requiredParticipantStateCounts.fill(0);
+
+    for (const auto& requiredParticipantName : _requiredParticipants)
+    {
+        const auto it{_participantStatusCache.find(requiredParticipantName)};
+        if (it != _participantStatusCache.end())
+        {
+            ++_requiredParticipantStateCounts[ToParticipantStateIndex(it->second.state)];
+        }
+    }
+}
+
+void SystemStateTracker::AddRequiredParticipantState(const std::string& participantName,
+                                                     ParticipantState participantState)
+{
+    if (IsRequiredParticipant(participantName))
+    {
+        ++_requiredParticipantStateCounts[ToParticipantStateIndex(participantState)];
+    }
+}
+
+void SystemStateTracker::RemoveRequiredParticipantState(const std::string& participantName,
+                                                        ParticipantState participantState)
+{
+    if (IsRequiredParticipant(participantName))
+    {
+        --_requiredParticipantStateCounts[ToParticipantStateIndex(participantState)];
+    }
+}
+
+auto SystemStateTracker::AllRequiredParticipantsIn(std::initializer_list<ParticipantState> stateList) const -> bool
+{
+    // Required participants without a known status are not counted in any state, so they never satisfy the check
+    size_t count{0};
+    for (const auto participantState : stateList)
+    {
+        count += _requiredParticipantStateCounts[ToParticipantStateIndex(participantState)];
+    }
+
+    return count == _requiredParticipants.size();
+}
+
 
 } // namespace VSilKit
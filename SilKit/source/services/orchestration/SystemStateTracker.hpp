@@ -9,6 +9,8 @@
 #include "silkit/services/logging/ILogger.hpp"
 #include "silkit/util/Span.hpp"
 
+#include <array>
+#include <initializer_list>
 #include <unordered_map>
 #include <unordered_set>
 #include <mutex>
@@ -24,6 +26,9 @@ class SystemStateTracker
 
     using SystemState = SilKit::Services::Orchestration::SystemState;
 
+    /// One slot per ParticipantState (Invalid to Aborting) and one for unknown values
+    static constexpr size_t ParticipantStateIndexCount{14};
+
 public:
     struct UpdateRequiredParticipantsResult
     {
@@ -63,6 +68,11 @@ private:
     auto GetAnyRequiredParticipantState() const -> ParticipantState;
     auto ComputeSystemState(ParticipantState newParticipantState) const -> SystemState;
 
+    void RecountRequiredParticipantStates();
+    void AddRequiredParticipantState(const std::string& participantName, ParticipantState participantState);
+    void RemoveRequiredParticipantState(const std::string& participantName, ParticipantState participantState);
+    auto AllRequiredParticipantsIn(std::initializer_list<ParticipantState> stateList) const -> bool;
+
 private:
     mutable std::recursive_mutex _mutex;
 
@@ -72,6 +82,11 @@ private:
 
     /// Mutable because GetParticipantStatus is allowed to insert the default (invalid) value.
     mutable std::unordered_map<std::string, ParticipantStatus> _participantStatusCache;
+
+    /// Number of required participants with a known status, per participant state. Kept up to date on every change
+    /// of _participantStatusCache or _requiredParticipants, so the system state is derived without iterating over all
+    /// required participants.
+    std::array<size_t, ParticipantStateIndexCount> _requiredParticipantStateCounts{};
 };
 
 
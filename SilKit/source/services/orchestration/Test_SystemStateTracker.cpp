@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "SystemStateTracker.hpp"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "silkit/services/orchestration/string_utils.hpp"
+
+namespace {
+
+using namespace SilKit::Services::Orchestration;
+
+using VSilKit::SystemStateTracker;
+
+class Test_SystemStateTracker : public testing::Test
+{
+protected:
+    auto Update(const std::string& participantName, ParticipantState participantState)
+        -> SystemStateTracker::UpdateParticipantStatusResult
+    {
+        ParticipantStatus participantStatus;
+        participantStatus.participantName = participantName;
+        participantStatus.state = participantState;
+        return tracker.UpdateParticipantStatus(participantStatus);
+    }
+
+    void SetRequired(std::vector<std::string> participantNames)
+    {
+        requiredParticipantNames = std::move(participantNames);
+        tracker.UpdateRequiredParticipants(requiredParticipantNames);
+    }
+
+protected:
+    SystemStateTracker tracker;
+    std::vector<std::string> requiredParticipantNames;
+};
+
+TEST_F(Test_SystemStateTracker, system_state_changes_when_the_last_required_participant_arrives)
+{
+    SetRequired({"A", "B"});
+
+    EXPECT_FALSE(Update("A", ParticipantState::ServicesCreated).systemStateChanged);
+    EXPECT_EQ(tracker.GetSystemState(), SystemState::Invalid);
+
+    EXPECT_TRUE(Update("B", ParticipantState::ServicesCreated).systemStateChanged);
+    EXPECT_EQ(tracker.GetSystemState(), SystemState::ServicesCreated);
+
+    // The counter of the previous state is decremented, B is still in ServicesCreated
+    EXPECT_FALSE(Update("A", ParticipantState::CommunicationInitializing).systemStateChanged);
+    EXPECT_EQ(tracker.GetSystemState(), SystemState::ServicesCreated);
+
+    EXPECT_TRUE(Update("B", ParticipantState::CommunicationInitializing).systemStateChanged);
+    EXPECT_EQ(tracker.GetSystemState(), SystemState::CommunicationInitializing);
+}
+
+TEST_F(Test_SystemStateTracker, participants_which_are_not_required_are_not_counted)
+{
+    SetRequired({"A"});
+
+    EXPECT_FALSE(Update("C", ParticipantState::ServicesCreated).systemStateChanged);
+    EXPECT_FALSE(Update("C", ParticipantState::CommunicationInitializing).systemStateChanged);
+    EXPECT_EQ(tracker.GetSystemState(), SystemState::Invalid);
+
+    EXPECT_TRUE(Update("A", ParticipantState::ServicesCreated).systemStateChanged);
+    EXPECT_EQ(tracker.GetSystemState(), SystemState::ServicesCreated);
+}
+
+TEST_F(Test_SystemStateTracker, required_participants_are_recounted_when_they_change)
+{
+    SetRequired({"A"});
+    Update("A", ParticipantState::ServicesCreated);
+    Update("B", ParticipantState::ServicesCreated);
+    ASSERT_EQ(tracker.GetSystemState(), SystemState::ServicesCreated);
+
+    // B already has a status when it becomes required, C has none yet
+    SetRequired({"A", "B", "C"});
+    EXPECT_EQ(tracker.GetSystemState(), SystemState::ServicesCreated);
+
+    EXPECT_FALSE(Update("A", ParticipantState::CommunicationInitializing).systemStateChanged);
+    EXPECT_FALSE(Update("B", ParticipantState::CommunicationInitializing).systemStateChanged);
+    EXPECT_FALSE(Update("C", ParticipantState::ServicesCreated).systemStateChanged);
+    EXPECT_TRUE(Update("C", ParticipantState::CommunicationInitializing).systemStateChanged);
+    EXPECT_EQ(tracker.GetSystemState(), SystemState::CommunicationInitializing);
+
+    // Without C, the remaining required participants decide
+    SetRequired({"A", "B"});
+    EXPECT_FALSE(Update("A", ParticipantState::CommunicationInitialized).systemStateChanged);
+    EXPECT_TRUE(Update("B", ParticipantState::CommunicationInitialized).systemStateChanged);
+    EXPECT_FALSE(Update("A", ParticipantState::ReadyToRun).systemStateChanged);
+    EXPECT_TRUE(Update("B", ParticipantState::ReadyToRun).systemStateChanged);
+    EXPECT_EQ(tracker.GetSystemState(), SystemState::ReadyToRun);
+}
+
+TEST_F(Test_SystemStateTracker, removed_participants_are_no_longer_counted)
+{
+    SetRequired({"A", "B"});
+    Update("A", ParticipantState::ServicesCreated);
+    Update("B", ParticipantState::ServicesCreated);
+    ASSERT_EQ(tracker.GetSystemState(), SystemState::ServicesCreated);
+
+    tracker.RemoveParticipant("B");
+    EXPECT_EQ(tracker.GetParticipantStatus("B"), nullptr);
+
+    // ServicesCreated is accepted for ShuttingDown, but the removed B must not count as being in that state anymore
+    EXPECT_FALSE(Update("A", ParticipantState::ShuttingDown).systemStateChanged);
+    EXPECT_EQ(tracker.GetSystemState(), SystemState::ServicesCreated);
+
+    EXPECT_TRUE(Update("B", ParticipantState::ShuttingDown).systemStateChanged);
+    EXPECT_EQ(tracker.GetSystemState(), SystemState::ShuttingDown);
+}
+
+} // namespace
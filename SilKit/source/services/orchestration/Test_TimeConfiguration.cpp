@@ -0,0 +1,239 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "TimeConfiguration.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using namespace testing;
+
+using namespace SilKit::Services::Orchestration;
+
+auto MakeTask(std::chrono::nanoseconds timePoint) -> NextSimTask
+{
+    NextSimTask task;
+    task.timePoint = timePoint;
+    task.duration = 1ms;
+    return task;
+}
+
+TEST(Test_TimeConfiguration, no_other_participants_never_blocks)
+{
+    TimeConfiguration configuration{nullptr};
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.AdvanceTimeStep();
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, blocks_until_all_other_participants_reached_the_next_time_point)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.AddSynchronizedParticipant("P2");
+    configuration.AddSynchronizedParticipant("P3");
+
+    // Our next time point is 0ns, the other participants are still at their initial -1ns
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P2", MakeTask(0ms));
+    configuration.OnReceiveNextSimStep("P3", MakeTask(1ms));
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P1", MakeTask(0ms));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    // Our next time point is 1ms, P1 and P2 are still at 0ms
+    configuration.AdvanceTimeStep();
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P1", MakeTask(2ms));
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P2", MakeTask(1ms));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, receiving_a_next_step_reports_whether_it_ended_the_waiting)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.AddSynchronizedParticipant("P2");
+
+    auto result = configuration.OnReceiveNextSimStep("P1", MakeTask(0ms));
+    EXPECT_TRUE(result.otherParticipantHadLowerTimepoint);
+    EXPECT_TRUE(result.otherParticipantHasLowerTimepoint);
+
+    result = configuration.OnReceiveNextSimStep("P2", MakeTask(0ms));
+    EXPECT_TRUE(result.otherParticipantHadLowerTimepoint);
+    EXPECT_FALSE(result.otherParticipantHasLowerTimepoint);
+
+    result = configuration.OnReceiveNextSimStep("P2", MakeTask(1ms));
+    EXPECT_FALSE(result.otherParticipantHadLowerTimepoint);
+    EXPECT_FALSE(result.otherParticipantHasLowerTimepoint);
+
+    // Unknown participants do not change anything
+    configuration.AdvanceTimeStep();
+    result = configuration.OnReceiveNextSimStep("P3", MakeTask(5ms));
+    EXPECT_TRUE(result.otherParticipantHadLowerTimepoint);
+    EXPECT_TRUE(result.otherParticipantHasLowerTimepoint);
+}
+
+TEST(Test_TimeConfiguration, removing_the_lowest_participant_unblocks)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.AddSynchronizedParticipant("P2");
+
+    configuration.OnReceiveNextSimStep("P2", MakeTask(0ms));
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    EXPECT_TRUE(configuration.RemoveSynchronizedParticipant("P1"));
+    EXPECT_FALSE(configuration.RemoveSynchronizedParticipant("P1"));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    EXPECT_THAT(configuration.GetSynchronizedParticipantNames(), ElementsAre("P2"));
+}
+
+TEST(Test_TimeConfiguration, lookahead_allows_running_ahead_of_other_participants)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.AddSynchronizedParticipant("P1", 5ms);
+
+    // A participant that has not announced its first step yet is not extended by its lookahead
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P1", MakeTask(0ms));
+    for (auto i = 0; i < 5; ++i)
+    {
+        configuration.AdvanceTimeStep();
+        EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint()) << "step " << i;
+    }
+
+    // Our next time point is 6ms, which is beyond the lookahead of P1
+    configuration.AdvanceTimeStep();
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P1", MakeTask(1ms));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, lowest_next_sim_step_includes_lookahead)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.SetLookahead(2ms);
+    configuration.AddSynchronizedParticipant("P1", 5ms);
+    EXPECT_EQ(configuration.LowestNextSimStep().timePoint, -1ns);
+
+    configuration.OnReceiveNextSimStep("P1", MakeTask(0ms));
+    EXPECT_EQ(configuration.LowestNextSimStep().timePoint, 2ms);
+
+    // Our next time point is 4ms, which is extended to 6ms and thus beyond the lookahead of P1
+    for (auto i = 0; i < 4; ++i)
+    {
+        configuration.AdvanceTimeStep();
+    }
+    EXPECT_EQ(configuration.LowestNextSimStep().timePoint, 5ms);
+}
+
+TEST(Test_TimeConfiguration, running_ahead_by_our_lookahead_is_no_hop_on)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.SetLookahead(5ms);
+    configuration.AddSynchronizedParticipant("P1");
+
+    // P1 executed the steps 0ms to 5ms ahead of our first step
+    configuration.OnReceiveNextSimStep("P1", MakeTask(6ms));
+    EXPECT_FALSE(configuration.HandleHopOn());
+
+    configuration.OnReceiveNextSimStep("P1", MakeTask(7ms));
+    EXPECT_TRUE(configuration.HandleHopOn());
+    EXPECT_EQ(configuration.NextSimStep().timePoint, 7ms);
+}
+
+TEST(Test_TimeConfiguration, lookahead_saturates_at_the_maximal_time_point)
+{
+    TimeConfiguration configuration{nullptr};
+    configuration.SetLookahead(std::chrono::nanoseconds::max());
+    configuration.AddSynchronizedParticipant("P1", std::chrono::nanoseconds::max());
+
+    configuration.OnReceiveNextSimStep("P1", MakeTask(1ms));
+    EXPECT_EQ(configuration.LowestNextSimStep().timePoint, std::chrono::nanoseconds::max());
+
+    for (auto i = 0; i < 10; ++i)
+    {
+        configuration.AdvanceTimeStep();
+        EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint()) << "step " << i;
+    }
+    EXPECT_FALSE(configuration.HandleHopOn());
+}
+
+TEST(Test_TimeConfiguration, matches_linear_scan_for_random_updates)
+{
+    constexpr size_t numParticipants{32};
+
+    TimeConfiguration configuration{nullptr};
+    std::vector<std::string> names;
+    std::vector<std::chrono::nanoseconds> timePoints;
+    std::vector<bool> isSynchronized(numParticipants, false);
+
+    for (size_t i = 0; i < numParticipants; ++i)
+    {
+        names.push_back("P" + std::to_string(i));
+        timePoints.push_back(-1ns);
+    }
+
+    std::mt19937 rng{42};
+    for (int step = 0; step < 10000; ++step)
+    {
+        const auto i = rng() % numParticipants;
+        switch (rng() % 8)
+        {
+        case 0:
+            configuration.AddSynchronizedParticipant(names[i]);
+            if (!isSynchronized[i])
+            {
+                isSynchronized[i] = true;
+                timePoints[i] = -1ns;
+            }
+            break;
+        case 1:
+            EXPECT_EQ(configuration.RemoveSynchronizedParticipant(names[i]), isSynchronized[i]);
+            isSynchronized[i] = false;
+            break;
+        case 2:
+            configuration.AdvanceTimeStep();
+            break;
+        default:
+            if (isSynchronized[i])
+            {
+                timePoints[i] += std::chrono::milliseconds{rng() % 3};
+                configuration.OnReceiveNextSimStep(names[i], MakeTask(timePoints[i]));
+            }
+            break;
+        }
+
+        bool expected{false};
+        for (size_t j = 0; j < numParticipants; ++j)
+        {
+            if (isSynchronized[j] && configuration.NextSimStep().timePoint > timePoints[j])
+            {
+                expected = true;
+            }
+        }
+        ASSERT_EQ(configuration.OtherParticipantHasLowerTimepoint(), expected) << "step " << step;
+    }
+}
+
+} // namespace
@@ -21,7 +21,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <chrono>
 #include <functional>
+#include <map>
 #include <string>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -161,4 +163,243 @@ TEST_F(Test_TimeSyncService, async_simtask_mismatching_number_of_complete_calls)
     ASSERT_EQ(numAsyncTaskCalled, 3) << "Calling too many CompleteSimulationStep() should not wreak havoc";
 }
 
+TEST(Test_TimeSyncServiceLookahead, invalid_lookahead_of_other_participants_is_ignored)
+{
+    NiceMock<DummyParticipant> participant;
+    Discovery::ServiceDiscoveryHandler discoveryHandler;
+    ON_CALL(participant.mockServiceDiscovery, RegisterServiceDiscoveryHandler(_))
+        .WillByDefault(SaveArg<0>(&discoveryHandler));
+
+    LifecycleService lifecycleService{&participant};
+    lifecycleService.SetLifecycleConfiguration(LifecycleConfiguration{OperationMode::Coordinated});
+    TimeProvider timeProvider{};
+    Config::HealthCheck healthCheckConfig;
+    TimeSyncService timeSyncService{&participant, &timeProvider, healthCheckConfig, &lifecycleService};
+    ASSERT_TRUE(discoveryHandler);
+
+    const std::vector<std::string> invalidLookaheads{"abc", "1ms", "-5", "99999999999999999999"};
+    EXPECT_CALL(participant.logger, Log(_, _)).Times(AnyNumber());
+    EXPECT_CALL(participant.logger, Log(Services::Logging::Level::Warn, HasSubstr("invalid lookahead")))
+        .Times(static_cast<int>(invalidLookaheads.size()));
+
+    for (const auto& invalidLookahead : invalidLookaheads)
+    {
+        ServiceDescriptor descriptor;
+        descriptor.SetParticipantNameAndComputeId("P1");
+        descriptor.SetServiceType(ServiceType::InternalController);
+        descriptor.SetSupplementalDataItem(Discovery::controllerType, Discovery::controllerTypeTimeSyncService);
+        descriptor.SetSupplementalDataItem(Discovery::timeSyncActive, "1");
+        descriptor.SetSupplementalDataItem(Discovery::timeSyncLookahead, invalidLookahead);
+
+        EXPECT_NO_THROW(discoveryHandler(Discovery::ServiceDiscoveryEvent::Type::ServiceCreated, descriptor));
+    }
+}
+
+//! Records the values of the counters and the events of the event lists
+class RecordingMetricsManager : public DummyMetricsManager
+{
+public:
+    struct Counter : ICounterMetric
+    {
+        void Add(uint64_t delta) override
+        {
+            value += delta;
+        }
+        void Set(uint64_t newValue) override
+        {
+            value = newValue;
+        }
+        uint64_t value{0};
+    };
+
+    struct EventList : IEventListMetric
+    {
+        void Add(const std::string& event) override
+        {
+            events.push_back(event);
+        }
+        std::vector<std::string> events;
+    };
+
+    auto GetCounter(const std::string& name) -> ICounterMetric* override
+    {
+        return &counters[name];
+    }
+
+    auto GetEventList(const std::string& name) -> IEventListMetric* override
+    {
+        return &eventLists[name];
+    }
+
+    std::map<std::string, Counter> counters;
+    std::map<std::string, EventList> eventLists;
+};
+
+class MockTimeSyncParticipant : public DummyParticipant
+{
+public:
+    using DummyParticipant::SendMsg;
+
+    MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const NextSimTask&), (override));
+    MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const std::string&, const NextSimTask&), (override));
+
+    auto GetMetricsManager() -> IMetricsManager* override
+    {
+        return &metricsManager;
+    }
+
+    RecordingMetricsManager metricsManager;
+};
+
+class Test_TimeSyncServiceCoordinated : public testing::Test
+{
+protected:
+    void Setup(const std::string& timeAdvanceCoordinator, const std::vector<std::string>& otherParticipantNames)
+    {
+        Config::TimeSynchronization timeSynchronizationConfig;
+        timeSynchronizationConfig.timeAdvanceCoordinator = timeAdvanceCoordinator;
+        Setup(timeSynchronizationConfig, otherParticipantNames);
+    }
+
+    void Setup(const Config::TimeSynchronization& timeSynchronizationConfig,
+               const std::vector<std::string>& otherParticipantNames)
+    {
+        lifecycleService = std::make_unique<LifecycleService>(&participant);
+        lifecycleService->SetLifecycleConfiguration(LifecycleConfiguration{OperationMode::Coordinated});
+        timeSyncService = std::make_unique<TimeSyncService>(&participant, &timeProvider, healthCheckConfig,
+                                                            lifecycleService.get(), timeSynchronizationConfig);
+        lifecycleService->SetTimeSyncService(timeSyncService.get());
+
+        timeSyncService->SetSimulationStepHandler([this](auto now, auto) { simStepTimePoints.push_back(now); }, 1ms);
+
+        lifecycleService->SetTimeSyncActive(true);
+        (void)lifecycleService->StartLifecycle();
+
+        for (const auto& otherParticipantName : otherParticipantNames)
+        {
+            timeSyncService->GetTimeConfiguration()->AddSynchronizedParticipant(otherParticipantName);
+        }
+
+        lifecycleService->NewSystemState(SystemState::ServicesCreated);
+        lifecycleService->NewSystemState(SystemState::CommunicationInitializing);
+        lifecycleService->NewSystemState(SystemState::CommunicationInitialized);
+        lifecycleService->NewSystemState(SystemState::ReadyToRun);
+        lifecycleService->NewSystemState(SystemState::Running);
+    }
+
+protected:
+    NiceMock<MockServiceEndpoint> coordinatorEndpoint{"Coordinator", "N1", "C1"};
+    NiceMock<MockServiceEndpoint> endpoint1{"P1", "N1", "C1"};
+    NiceMock<MockServiceEndpoint> endpoint2{"P2", "N1", "C1"};
+
+    NiceMock<MockTimeSyncParticipant> participant;
+    Config::HealthCheck healthCheckConfig;
+
+    std::unique_ptr<LifecycleService> lifecycleService;
+    TimeProvider timeProvider{};
+    std::unique_ptr<TimeSyncService> timeSyncService;
+
+    std::vector<std::chrono::nanoseconds> simStepTimePoints;
+};
+
+TEST_F(Test_TimeSyncServiceCoordinated, participant_sends_next_sim_task_only_to_coordinator)
+{
+    EXPECT_CALL(participant, SendMsg(_, An<const NextSimTask&>())).Times(0);
+    EXPECT_CALL(participant, SendMsg(_, "Coordinator", Field(&NextSimTask::timePoint, 0ms))).Times(1);
+    EXPECT_CALL(participant, SendMsg(_, "Coordinator", Field(&NextSimTask::timePoint, 1ms))).Times(1);
+
+    Setup("Coordinator", {"Coordinator"});
+    ASSERT_TRUE(simStepTimePoints.empty());
+
+    // The grant of the coordinator allows advancing to 0ms
+    timeSyncService->ReceiveMsg(&coordinatorEndpoint, {0ms, 1ms});
+    EXPECT_THAT(simStepTimePoints, ElementsAre(0ms));
+
+    // Our next time point 1ms is not granted yet
+    timeSyncService->ReceiveMsg(&coordinatorEndpoint, {0ms, 1ms});
+    EXPECT_THAT(simStepTimePoints, ElementsAre(0ms));
+}
+
+TEST_F(Test_TimeSyncServiceCoordinated, coordinator_broadcasts_lowest_next_time_point)
+{
+    EXPECT_CALL(participant, SendMsg(_, An<const std::string&>(), An<const NextSimTask&>())).Times(0);
+
+    Sequence s;
+    EXPECT_CALL(participant, SendMsg(_, Field(&NextSimTask::timePoint, 0ms))).Times(1).InSequence(s);
+    EXPECT_CALL(participant, SendMsg(_, Field(&NextSimTask::timePoint, 1ms))).Times(1).InSequence(s);
+
+    // The participant of the test fixture is the coordinator
+    Setup(participant.GetParticipantName(), {"P1", "P2"});
+    ASSERT_TRUE(simStepTimePoints.empty());
+
+    // P2 has not sent its next time point yet
+    timeSyncService->ReceiveMsg(&endpoint1, {0ms, 1ms});
+    EXPECT_TRUE(simStepTimePoints.empty());
+
+    // All participants are at 0ms: The grant for 0ms is sent and we advance ourselves
+    timeSyncService->ReceiveMsg(&endpoint2, {0ms, 1ms});
+    EXPECT_THAT(simStepTimePoints, ElementsAre(0ms));
+
+    timeSyncService->ReceiveMsg(&endpoint1, {1ms, 1ms});
+    timeSyncService->ReceiveMsg(&endpoint2, {1ms, 1ms});
+    EXPECT_THAT(simStepTimePoints, ElementsAre(0ms, 1ms));
+}
+
+TEST_F(Test_TimeSyncServiceCoordinated, grant_extended_by_the_lookahead_is_no_hop_on)
+{
+    // With a coordinated lifecycle, a hop-on aborts the simulation
+    EXPECT_CALL(participant.mockSystemController, AbortSimulation()).Times(0);
+
+    Config::TimeSynchronization timeSynchronizationConfig;
+    timeSynchronizationConfig.timeAdvanceCoordinator = "Coordinator";
+    timeSynchronizationConfig.lookahead = 5ms;
+    Setup(timeSynchronizationConfig, {"Coordinator"});
+
+    // The first grant is our next time point 0ms, extended by our lookahead
+    timeSyncService->ReceiveMsg(&coordinatorEndpoint, {5ms, 1ms});
+    EXPECT_THAT(simStepTimePoints, ElementsAre(0ms, 1ms, 2ms, 3ms, 4ms, 5ms));
+}
+
+using Test_TimeSyncServiceCriticalPath = Test_TimeSyncServiceCoordinated;
+
+TEST_F(Test_TimeSyncServiceCriticalPath, waiting_is_attributed_to_the_participant_that_arrived_last)
+{
+    Config::TimeSynchronization timeSynchronizationConfig;
+    timeSynchronizationConfig.recordCriticalPath = true;
+    Setup(timeSynchronizationConfig, {"P1", "P2"});
+
+    // P2 arrives last at 0ms
+    timeSyncService->ReceiveMsg(&endpoint1, {0ms, 1ms});
+    timeSyncService->ReceiveMsg(&endpoint2, {0ms, 1ms});
+    // P1 arrives last at 1ms, the NextSimTask of P2 does not end our waiting
+    timeSyncService->ReceiveMsg(&endpoint2, {5ms, 1ms});
+    timeSyncService->ReceiveMsg(&endpoint1, {3ms, 1ms});
+    // At 2ms and 3ms, both other participants are already waiting for us
+    EXPECT_THAT(simStepTimePoints, ElementsAre(0ms, 1ms, 2ms, 3ms));
+
+    const auto& counters = participant.metricsManager.counters;
+    EXPECT_EQ(counters.at("SimStepCriticalParticipant/P1").value, 1u);
+    EXPECT_EQ(counters.at("SimStepCriticalParticipant/P2").value, 1u);
+    EXPECT_EQ(counters.at("SimStepCriticalParticipant/" + participant.GetParticipantName()).value, 2u);
+
+    const auto& events = participant.metricsManager.eventLists.at("SimStepCriticalPath").events;
+    ASSERT_EQ(events.size(), 4u);
+    EXPECT_THAT(events[0], StartsWith("0 "));
+    EXPECT_THAT(events[0], EndsWith(" P2"));
+    EXPECT_THAT(events[1], StartsWith("1000000 "));
+    EXPECT_THAT(events[1], EndsWith(" P1"));
+    EXPECT_THAT(events[3], EndsWith(" " + participant.GetParticipantName()));
+}
+
+TEST_F(Test_TimeSyncServiceCriticalPath, events_are_only_recorded_if_enabled)
+{
+    Setup(Config::TimeSynchronization{}, {"P1"});
+
+    timeSyncService->ReceiveMsg(&endpoint1, {0ms, 1ms});
+    EXPECT_THAT(simStepTimePoints, ElementsAre(0ms));
+
+    EXPECT_EQ(participant.metricsManager.counters.at("SimStepCriticalParticipant/P1").value, 1u);
+    EXPECT_TRUE(participant.metricsManager.eventLists.empty());
+}
+
 } // namespace
@@ -355,4 +355,34 @@ TEST_F(Test_WatchDog, warn_and_error_with_soft_and_hard)
     ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
 }
 
+TEST_F(Test_WatchDog, blocking_handler_does_not_delay_other_watchdogs)
+{
+    LimitedMockClock blockedClock{50ms, 2ms};
+    LimitedMockClock otherClock{50ms, 2ms};
+
+    std::promise<void> blockedHandlerStarted;
+    std::promise<void> unblockHandler;
+    auto unblockHandlerFuture = unblockHandler.get_future();
+
+    WatchDog blockedWatchDog{Config::HealthCheck{10ms, std::chrono::milliseconds::max()}, &blockedClock};
+    blockedWatchDog.SetWarnHandler([&](std::chrono::milliseconds) {
+        blockedHandlerStarted.set_value();
+        unblockHandlerFuture.wait();
+    });
+
+    WatchDog otherWatchDog{Config::HealthCheck{10ms, std::chrono::milliseconds::max()}, &otherClock};
+    otherWatchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
+
+    EXPECT_CALL(callbacks, WarnHandler(_)).Times(1);
+
+    blockedWatchDog.Start();
+    ASSERT_EQ(blockedHandlerStarted.get_future().wait_for(WAIT_EXPECT_READY), std::future_status::ready);
+
+    // both watchdogs are checked by the same thread, which must not wait for the blocked handler
+    otherWatchDog.Start();
+    EXPECT_TRUE(otherClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+
+    unblockHandler.set_value();
+}
+
 } // anonymous namespace
@@ -41,10 +41,11 @@ void TimeConfiguration::SetBlockingMode(bool blocking)
     _blocking = blocking;
 }
 
-void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParticipantName)
+void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParticipantName,
+                                                   std::chrono::nanoseconds lookahead)
 {
     Lock lock{_mx};
-    if (_otherNextTasks.find(otherParticipantName) != _otherNextTasks.end())
+    if (_otherParticipantIndices.find(otherParticipantName) != _otherParticipantIndices.end())
     {
         // ignore already known participants
         return;
@@ -52,17 +53,23 @@ void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParti
     NextSimTask task;
     task.timePoint = -1ns;
     task.duration = 0ns;
-    _otherNextTasks.emplace(otherParticipantName, task);
+
+    const auto index = _otherParticipants.size();
+    _otherParticipants.push_back(
+        OtherParticipant{otherParticipantName, task, lookahead, _otherNextTasksHeap.size()});
+    _otherParticipantIndices.emplace(otherParticipantName, index);
+    _otherNextTasksHeap.push_back(index);
+    SiftUp(_otherNextTasksHeap.size() - 1);
 }
 
 
 bool TimeConfiguration::RemoveSynchronizedParticipant(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    auto it = _otherNextTasks.find(otherParticipantName);
-    if (it != _otherNextTasks.end())
+    auto it = _otherParticipantIndices.find(otherParticipantName);
+    if (it != _otherParticipantIndices.end())
     {
-        _otherNextTasks.erase(it);
+        RemoveOtherParticipant(it->second);
         return true;
     }
     return false;
@@ -70,51 +77,73 @@ bool TimeConfiguration::RemoveSynchronizedParticipant(const std::string& otherPa
 
 auto TimeConfiguration::GetSynchronizedParticipantNames() -> std::vector<std::string>
 {
+    Lock lock{_mx};
     std::vector<std::string> participantNames;
-    for (auto const& it : _otherNextTasks)
+    participantNames.reserve(_otherParticipants.size());
+    for (auto const& otherParticipant : _otherParticipants)
     {
-        participantNames.push_back(it.first);
+        participantNames.push_back(otherParticipant.name);
     }
     return participantNames;
 }
 
-void TimeConfiguration::OnReceiveNextSimStep(const std::string& participantName, NextSimTask nextStep)
+auto TimeConfiguration::OnReceiveNextSimStep(const std::string& participantName, NextSimTask nextStep)
+    -> ReceiveNextSimStepResult
 {
     Lock lock{_mx};
 
-    auto&& itOtherNextTask = _otherNextTasks.find(participantName);
-    if (itOtherNextTask == _otherNextTasks.end())
+    ReceiveNextSimStepResult result;
+    result.otherParticipantHadLowerTimepoint = GetOtherParticipantWithLowerTimepoint() != nullptr;
+
+    auto&& itOtherParticipantIndex = _otherParticipantIndices.find(participantName);
+    if (itOtherParticipantIndex == _otherParticipantIndices.end())
     {
         Logging::Error(_logger, "Received NextSimTask from unknown participant {}", participantName);
-        return;
+        result.otherParticipantHasLowerTimepoint = result.otherParticipantHadLowerTimepoint;
+        return result;
     }
 
-    if (nextStep.timePoint < itOtherNextTask->second.timePoint)
+    auto& otherParticipant = _otherParticipants[itOtherParticipantIndex->second];
+    const auto lastTimePoint = otherParticipant.nextTask.timePoint;
+
+    if (nextStep.timePoint < lastTimePoint)
     {
         Logging::Error(
             _logger,
             "Chonology error: Received NextSimTask from participant \'{}\' with lower timePoint {} than last "
             "known timePoint {}",
-            participantName, nextStep.timePoint.count(), itOtherNextTask->second.timePoint.count());
+            participantName, nextStep.timePoint.count(), lastTimePoint.count());
+    }
+
+    otherParticipant.nextTask = std::move(nextStep);
+    if (otherParticipant.nextTask.timePoint < lastTimePoint)
+    {
+        SiftUp(otherParticipant.heapPosition);
+    }
+    else
+    {
+        SiftDown(otherParticipant.heapPosition);
     }
 
-    _otherNextTasks.at(participantName) = std::move(nextStep);
     Logging::Debug(_logger, "Updated _otherNextTasks for participant {} with time {}", participantName,
                    nextStep.timePoint.count());
+
+    result.otherParticipantHasLowerTimepoint = GetOtherParticipantWithLowerTimepoint() != nullptr;
+    return result;
 }
 
 void TimeConfiguration::SynchronizedParticipantRemoved(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    if (_otherNextTasks.find(otherParticipantName) != _otherNextTasks.end())
+    if (_otherParticipantIndices.find(otherParticipantName) != _otherParticipantIndices.end())
     {
         const std::string errorMessage{"Participant " + otherParticipantName + " unknown."};
         throw SilKitError{errorMessage};
     }
-    auto it = _otherNextTasks.find(otherParticipantName);
-    if (it != _otherNextTasks.end())
+    auto it = _otherParticipantIndices.find(otherParticipantName);
+    if (it != _otherParticipantIndices.end())
     {
-        _otherNextTasks.erase(it);
+        RemoveOtherParticipant(it->second);
     }
 }
 void TimeConfiguration::SetStepDuration(std::chrono::nanoseconds duration)
@@ -123,6 +152,12 @@ void TimeConfiguration::SetStepDuration(std::chrono::nanoseconds duration)
     _myNextTask.duration = duration;
 }
 
+void TimeConfiguration::SetLookahead(std::chrono::nanoseconds lookahead)
+{
+    Lock lock{_mx};
+    _myLookahead = lookahead;
+}
+
 void TimeConfiguration::AdvanceTimeStep()
 {
     Lock lock{_mx};
@@ -146,16 +181,50 @@ bool TimeConfiguration::OtherParticipantHasLowerTimepoint() const
 {
     Lock lock{_mx};
 
-    for (const auto& otherTask : _otherNextTasks)
+    const auto otherParticipant = GetOtherParticipantWithLowerTimepoint();
+    if (otherParticipant != nullptr)
     {
-        if (_myNextTask.timePoint > otherTask.second.timePoint)
+        Trace(_logger, "Not advancing because participant \'{}\' has lower timepoint {}", otherParticipant->name,
+              otherParticipant->nextTask.timePoint.count());
+        return true;
+    }
+    return false;
+}
+
+auto TimeConfiguration::GetOtherParticipantWithLowerTimepoint() const -> const OtherParticipant*
+{
+    if (_otherNextTasksHeap.empty())
+    {
+        return nullptr;
+    }
+
+    // The participant with the lowest next time point is always at the top of the heap
+    const auto& otherParticipant = _otherParticipants[_otherNextTasksHeap.front()];
+    if (_myNextTask.timePoint > UnaffectedUntil(otherParticipant.nextTask, otherParticipant.lookahead))
+    {
+        return &otherParticipant;
+    }
+    return nullptr;
+}
+
+auto TimeConfiguration::LowestNextSimStep() const -> NextSimTask
+{
+    Lock lock{_mx};
+
+    NextSimTask lowestTask = _myNextTask;
+    lowestTask.timePoint = UnaffectedUntil(_myNextTask, _myLookahead);
+
+    if (!_otherNextTasksHeap.empty())
+    {
+        const auto& otherParticipant = _otherParticipants[_otherNextTasksHeap.front()];
+        const auto otherTimePoint = UnaffectedUntil(otherParticipant.nextTask, otherParticipant.lookahead);
+        if (otherTimePoint < lowestTask.timePoint)
         {
-            Debug(_logger, "Not advancing because participant \'{}\' has lower timepoint {}", otherTask.first,
-                  otherTask.second.timePoint.count());
-            return true;
+            lowestTask = otherParticipant.nextTask;
+            lowestTask.timePoint = otherTimePoint;
         }
     }
-    return false;
+    return lowestTask;
 }
 
 void TimeConfiguration::Initialize()
@@ -182,15 +251,18 @@ bool TimeConfiguration::HandleHopOn()
         if (_currentTask.timePoint == -1ns) // On initial time
         {
             std::chrono::nanoseconds minimalOtherTime = std::chrono::nanoseconds::max();
-            for (const auto& otherTask : _otherNextTasks)
+            for (const auto& otherParticipant : _otherParticipants)
             {
+                const auto& otherTask = otherParticipant.nextTask;
                 // Any other participant has already advanced further that its duration -> HopOn
-                if (otherTask.second.timePoint > otherTask.second.duration)
+                // The other participants (or the grant of a coordinator) may be ahead of our first step by our
+                // lookahead, which is not a HopOn.
+                if (otherTask.timePoint > SaturatingAdd(otherTask.duration, _myLookahead))
                 {
                     _hoppedOn = true;
-                    if (otherTask.second.timePoint < minimalOtherTime)
+                    if (otherTask.timePoint < minimalOtherTime)
                     {
-                        minimalOtherTime = otherTask.second.timePoint;
+                        minimalOtherTime = otherTask.timePoint;
                     }
                 }
             }
@@ -206,6 +278,106 @@ bool TimeConfiguration::HandleHopOn()
     return false;
 }
 
+void TimeConfiguration::RemoveOtherParticipant(size_t index)
+{
+    // Remove the participant from the heap, by replacing it with the last heap entry
+    const auto heapPosition = _otherParticipants[index].heapPosition;
+    const auto lastHeapPosition = _otherNextTasksHeap.size() - 1;
+    if (heapPosition != lastHeapPosition)
+    {
+        SwapHeapPositions(heapPosition, lastHeapPosition);
+    }
+    _otherNextTasksHeap.pop_back();
+    if (heapPosition != lastHeapPosition)
+    {
+        SiftUp(heapPosition);
+        SiftDown(heapPosition);
+    }
+
+    // Keep the participant indices dense, by moving the last participant into the freed slot
+    _otherParticipantIndices.erase(_otherParticipants[index].name);
+    const auto lastIndex = _otherParticipants.size() - 1;
+    if (index != lastIndex)
+    {
+        _otherParticipants[index] = std::move(_otherParticipants[lastIndex]);
+        _otherParticipantIndices[_otherParticipants[index].name] = index;
+        _otherNextTasksHeap[_otherParticipants[index].heapPosition] = index;
+    }
+    _otherParticipants.pop_back();
+}
+
+auto TimeConfiguration::UnaffectedUntil(const NextSimTask& task, std::chrono::nanoseconds lookahead)
+    -> std::chrono::nanoseconds
+{
+    // A participant that has not announced a step yet cannot be run ahead of
+    if (task.timePoint < 0ns)
+    {
+        return task.timePoint;
+    }
+    return SaturatingAdd(task.timePoint, lookahead);
+}
+
+auto TimeConfiguration::SaturatingAdd(std::chrono::nanoseconds timePoint, std::chrono::nanoseconds lookahead)
+    -> std::chrono::nanoseconds
+{
+    // The lookahead of other participants may be arbitrarily large, a time point beyond the range means 'never'
+    if (lookahead > std::chrono::nanoseconds::max() - timePoint)
+    {
+        return std::chrono::nanoseconds::max();
+    }
+    return timePoint + lookahead;
+}
+
+auto TimeConfiguration::HasLowerTimepoint(size_t lhsHeapPosition, size_t rhsHeapPosition) const -> bool
+{
+    const auto& lhs = _otherParticipants[_otherNextTasksHeap[lhsHeapPosition]];
+    const auto& rhs = _otherParticipants[_otherNextTasksHeap[rhsHeapPosition]];
+    return UnaffectedUntil(lhs.nextTask, lhs.lookahead) < UnaffectedUntil(rhs.nextTask, rhs.lookahead);
+}
+
+void TimeConfiguration::SwapHeapPositions(size_t lhsHeapPosition, size_t rhsHeapPosition)
+{
+    std::swap(_otherNextTasksHeap[lhsHeapPosition], _otherNextTasksHeap[rhsHeapPosition]);
+    _otherParticipants[_otherNextTasksHeap[lhsHeapPosition]].heapPosition = lhsHeapPosition;
+    _otherParticipants[_otherNextTasksHeap[rhsHeapPosition]].heapPosition = rhsHeapPosition;
+}
+
+void TimeConfiguration::SiftUp(size_t heapPosition)
+{
+    while (heapPosition > 0)
+    {
+        const auto parentHeapPosition = (heapPosition - 1) / 2;
+        if (!HasLowerTimepoint(heapPosition, parentHeapPosition))
+        {
+            break;
+        }
+        SwapHeapPositions(heapPosition, parentHeapPosition);
+        heapPosition = parentHeapPosition;
+    }
+}
+
+void TimeConfiguration::SiftDown(size_t heapPosition)
+{
+    const auto heapSize = _otherNextTasksHeap.size();
+    while (true)
+    {
+        auto lowestHeapPosition = heapPosition;
+        for (const auto childHeapPosition : {2 * heapPosition + 1, 2 * heapPosition + 2})
+        {
+            if (childHeapPosition < heapSize && HasLowerTimepoint(childHeapPosition, lowestHeapPosition))
+            {
+                lowestHeapPosition = childHeapPosition;
+            }
+        }
+        if (lowestHeapPosition == heapPosition)
+        {
+            break;
+        }
+        SwapHeapPositions(heapPosition, lowestHeapPosition);
+        heapPosition = lowestHeapPosition;
+    }
+}
+
 } // namespace Orchestration
 } // namespace Services
 } // namespace SilKit
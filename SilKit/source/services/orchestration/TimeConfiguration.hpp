@@ -21,8 +21,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <string>
 #include <chrono>
-#include <map>
+#include <unordered_map>
 #include <mutex>
+#include <vector>
 
 #include "OrchestrationDatatypes.hpp"
 #include "silkit/services/logging/ILogger.hpp"
@@ -34,21 +35,38 @@ namespace Orchestration {
 using namespace std::chrono_literals;
 class TimeConfiguration
 {
+public: //Types
+    struct ReceiveNextSimStepResult
+    {
+        //! Whether OtherParticipantHasLowerTimepoint was true before the received next simulation step was applied
+        bool otherParticipantHadLowerTimepoint;
+        //! Whether OtherParticipantHasLowerTimepoint is true after the received next simulation step was applied
+        bool otherParticipantHasLowerTimepoint;
+    };
+
 public: //Ctor
     TimeConfiguration(Logging::ILogger* logger);
 
 public: //Methods
     void SetBlockingMode(bool blocking);
-    void AddSynchronizedParticipant(const std::string& otherParticipantName);
+    //! The lookahead is the time span after a simulation step of the other participant, in which its outputs do not
+    //! affect this participant. Our own steps may run ahead of the other participant by up to the lookahead.
+    void AddSynchronizedParticipant(const std::string& otherParticipantName,
+                                    std::chrono::nanoseconds lookahead = 0ns);
     bool RemoveSynchronizedParticipant(const std::string& otherParticipantName);
     auto GetSynchronizedParticipantNames() -> std::vector<std::string>;
-    void OnReceiveNextSimStep(const std::string& participantName, NextSimTask nextStep);
+    auto OnReceiveNextSimStep(const std::string& participantName, NextSimTask nextStep) -> ReceiveNextSimStepResult;
     void SynchronizedParticipantRemoved(const std::string& otherParticipantName);
     void SetStepDuration(std::chrono::nanoseconds duration);
+    //! Our own lookahead, which is only used by LowestNextSimStep
+    void SetLookahead(std::chrono::nanoseconds lookahead);
     void AdvanceTimeStep();
     auto CurrentSimStep() const -> NextSimTask;
     auto NextSimStep() const -> NextSimTask;
     bool OtherParticipantHasLowerTimepoint() const;
+    //! The next simulation step with the lowest time point, our own or that of any other participant, extended by the
+    //! respective lookahead
+    auto LowestNextSimStep() const -> NextSimTask;
     void Initialize();
     bool IsBlocking() const;
 
@@ -57,12 +75,43 @@ public: //Methods
     // Returns true (only once) in the step the actual hop-on happened
     bool HandleHopOn();
 
+private: //Types
+    struct OtherParticipant
+    {
+        std::string name;
+        NextSimTask nextTask;
+        std::chrono::nanoseconds lookahead;
+        //! Position of this participant in _otherNextTasksHeap
+        size_t heapPosition;
+    };
+
+private: //Methods
+    void RemoveOtherParticipant(size_t index);
+    //! The other participant with the lowest next time point, if our next step is not unaffected by it
+    auto GetOtherParticipantWithLowerTimepoint() const -> const OtherParticipant*;
+    //! The time point up to which our steps are unaffected by the given next task
+    static auto UnaffectedUntil(const NextSimTask& task, std::chrono::nanoseconds lookahead)
+        -> std::chrono::nanoseconds;
+    //! Adds the non-negative lookahead to the non-negative time point, saturating at the maximal time point
+    static auto SaturatingAdd(std::chrono::nanoseconds timePoint, std::chrono::nanoseconds lookahead)
+        -> std::chrono::nanoseconds;
+    auto HasLowerTimepoint(size_t lhsHeapPosition, size_t rhsHeapPosition) const -> bool;
+    void SwapHeapPositions(size_t lhsHeapPosition, size_t rhsHeapPosition);
+    void SiftUp(size_t heapPosition);
+    void SiftDown(size_t heapPosition);
+
 private: //Members
     mutable std::mutex _mx;
     using Lock = std::unique_lock<decltype(_mx)>;
     NextSimTask _currentTask;
     NextSimTask _myNextTask;
-    std::map<std::string, NextSimTask> _otherNextTasks;
+    std::chrono::nanoseconds _myLookahead{0};
+    //! The synchronized participants, densely indexed. Removing a participant moves the last one into its slot.
+    std::vector<OtherParticipant> _otherParticipants;
+    std::unordered_map<std::string, size_t> _otherParticipantIndices;
+    //! Indices into _otherParticipants, as a binary min-heap ordered by the time point of their next task, extended by
+    //! their lookahead
+    std::vector<size_t> _otherNextTasksHeap;
     bool _blocking;
 
     bool _hoppedOn = false;
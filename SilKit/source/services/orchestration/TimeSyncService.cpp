@@ -22,6 +22,13 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <future>
 #include <functional>
 #include <atomic>
+#include <cstdlib>
+#include <cerrno>
+
+#if defined(__linux__)
+#include <time.h>
+#include <sys/prctl.h>
+#endif
 
 #include "silkit/services/orchestration/string_utils.hpp"
 #include "silkit/services/orchestration/ISystemMonitor.hpp"
@@ -36,17 +43,67 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 using namespace std::chrono_literals;
 
 namespace {
-#ifdef _WIN32
-auto GetDefaultTimerResolution() -> std::chrono::nanoseconds
+#if defined(_WIN32)
+// By default, Windows timer have a resolution of 15.6ms
+// The effective time that wait_for or sleep_for actually waits will be a step function with steps every 15.6ms
+auto GetDefaultWallClockSpinTail() -> std::chrono::nanoseconds
 {
     return 16ms;
 }
+#elif defined(__linux__)
+// Sleeping until an absolute deadline with a minimal timer slack wakes up within some tens of microseconds
+auto GetDefaultWallClockSpinTail() -> std::chrono::nanoseconds
+{
+    return 50us;
+}
 #else
-auto GetDefaultTimerResolution() -> std::chrono::nanoseconds
+auto GetDefaultWallClockSpinTail() -> std::chrono::nanoseconds
 {
     return 1ms;
 }
 #endif
+
+// The lookahead is announced by other participants, so it must be parsed without throwing
+bool TryParseLookahead(const std::string& lookaheadString, std::chrono::nanoseconds& lookahead)
+{
+    if (lookaheadString.empty())
+    {
+        return false;
+    }
+
+    errno = 0;
+    char* end{nullptr};
+    const auto value = std::strtoll(lookaheadString.c_str(), &end, 10);
+    if (errno != 0 || end != lookaheadString.c_str() + lookaheadString.size() || value < 0)
+    {
+        return false;
+    }
+
+    lookahead = std::chrono::nanoseconds{value};
+    return true;
+}
+
+void SleepUntil(std::chrono::steady_clock::time_point deadline)
+{
+#if defined(__linux__)
+    // The steady_clock is based on CLOCK_MONOTONIC. In contrast to a relative sleep, the absolute deadline neither
+    // accumulates the time spent between computing and starting the sleep, nor an interruption by a signal.
+    const auto deadlineNs =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+    if (deadlineNs <= 0)
+    {
+        return;
+    }
+    timespec deadlineTs{};
+    deadlineTs.tv_sec = static_cast<time_t>(deadlineNs / 1000000000);
+    deadlineTs.tv_nsec = static_cast<long>(deadlineNs % 1000000000);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadlineTs, nullptr) == EINTR)
+    {
+    }
+#else
+    std::this_thread::sleep_until(deadline);
+#endif
+}
 } // namespace
 
 namespace SilKit {
@@ -119,7 +176,7 @@ public:
                 != _configuration->NextSimStep().timePoint) // Prevent sending same step more than once
             {
                 _lastSentNextSimTask = _configuration->NextSimStep().timePoint;
-                _controller.SendMsg(_configuration->NextSimStep());
+                _controller.SendNextSimTask(_configuration->NextSimStep());
             }
             // Bootstrap checked execution, in case there is no other participant.
             // Else, checked execution is initiated when we receive their NextSimTask messages.
@@ -129,7 +186,13 @@ public:
 
     void ReceiveNextSimTask(const Core::IServiceEndpoint* from, const NextSimTask& task) override
     {
-        _configuration->OnReceiveNextSimStep(from->GetServiceDescriptor().GetParticipantName(), task);
+        const auto& participantName = from->GetServiceDescriptor().GetParticipantName();
+        const auto result = _configuration->OnReceiveNextSimStep(participantName, task);
+        if (result.otherParticipantHadLowerTimepoint && !result.otherParticipantHasLowerTimepoint)
+        {
+            _controller.SetSimStepCriticalParticipant(participantName);
+        }
+        _controller.UpdateTimeAdvanceGrant();
 
         switch (_controller.State())
         {
@@ -141,7 +204,7 @@ public:
             return;
         case ParticipantState::Paused: // [[fallthrough]]
         case ParticipantState::Running:
-            ProcessSimulationTimeUpdate();
+            ProcessSimulationTimeUpdate(result.otherParticipantHasLowerTimepoint);
             return;
         case ParticipantState::Stopping: // [[fallthrough]]
         case ParticipantState::Stopped: // [[fallthrough]]
@@ -157,9 +220,15 @@ public:
     }
 
     void ProcessSimulationTimeUpdate() override
+    {
+        ProcessSimulationTimeUpdate(_configuration->OtherParticipantHasLowerTimepoint());
+    }
+
+private:
+    void ProcessSimulationTimeUpdate(bool otherParticipantHasLowerTimepoint)
     {
         // Check if we meet the conditions to trigger our local time advancement
-        if (IsTimeAdvancePossible())
+        if (IsTimeAdvancePossible(otherParticipantHasLowerTimepoint))
         {
             if (IsSimStepSync())
             {
@@ -172,13 +241,12 @@ public:
         }
     }
 
-private:
     bool IsSimStepSync() const
     {
         return _configuration->IsBlocking();
     }
 
-    bool IsTimeAdvancePossible()
+    bool IsTimeAdvancePossible(bool otherParticipantHasLowerTimepoint)
     {
         // Deferred execution of this callback was initiated, but simulation stopped/paused in the meantime
         if (_controller.State() != ParticipantState::Running)
@@ -200,7 +268,7 @@ private:
             return false;
         }
 
-        if (_configuration->OtherParticipantHasLowerTimepoint())
+        if (otherParticipantHasLowerTimepoint)
         {
             return false;
         }
@@ -282,7 +350,7 @@ private:
 
 TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeProvider* timeProvider,
                                  const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService,
-                                 double animationFactor)
+                                 const Config::TimeSynchronization& timeSynchronizationConfig)
     : _participant{participant}
     , _lifecycleService{lifecycleService}
     , _logger{participant->GetLogger()}
@@ -292,13 +360,40 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
     , _simStepHandlerExecutionTimeStatisticMetric{participant->GetMetricsManager()->GetStatistic("SimStepHandlerExecutionDuration")}
     , _simStepCompletionTimeStatisticMetric{participant->GetMetricsManager()->GetStatistic("SimStepCompletionDuration")}
     , _simStepWaitingTimeStatisticMetric{participant->GetMetricsManager()->GetStatistic("SimStepWaitingDuration")}
-    , _watchDog{healthCheckConfig}
-    , _animationFactor{animationFactor}
+    , _watchDog{healthCheckConfig, nullptr, participant->GetLogger()}
+    , _animationFactor{timeSynchronizationConfig.animationFactor}
+    , _wallClockSpinTail{timeSynchronizationConfig.wallClockSpinTail.has_value()
+                             ? timeSynchronizationConfig.wallClockSpinTail.value()
+                             : GetDefaultWallClockSpinTail()}
+    , _timeAdvanceCoordinator{timeSynchronizationConfig.timeAdvanceCoordinator}
+    , _lookahead{timeSynchronizationConfig.lookahead}
 {
+    _simStepOwnCriticalParticipant = GetSimStepCriticalParticipant(_participant->GetParticipantName());
+    _simStepCriticalParticipant = _simStepOwnCriticalParticipant;
+    if (timeSynchronizationConfig.recordCriticalPath)
+    {
+        _simStepCriticalPathEventListMetric = participant->GetMetricsManager()->GetEventList("SimStepCriticalPath");
+    }
+
     _isCoupledToWallClock = _animationFactor != 0.0;
     if (_isCoupledToWallClock)
     {
-        Debug(_logger, "TimeSyncService: Coupled to the local wall clock with animation factor {}", _animationFactor);
+        Debug(_logger, "TimeSyncService: Coupled to the local wall clock with animation factor {} (spin tail {}ns)",
+              _animationFactor, _wallClockSpinTail.count());
+        _wallClockSyncPointLatenessStatisticMetric =
+            participant->GetMetricsManager()->GetStatistic("WallClockSyncPointLateness");
+    }
+
+    if (IsTimeAdvanceCoordinated())
+    {
+        Debug(_logger, "TimeSyncService: The time advance is coordinated by participant \'{}\'",
+              _timeAdvanceCoordinator);
+    }
+
+    if (_lookahead > 0ns)
+    {
+        Debug(_logger, "TimeSyncService: Other participants may run ahead by a lookahead of {}ns", _lookahead.count());
+        _timeConfiguration.SetLookahead(_lookahead);
     }
 
     _watchDog.SetWarnHandler([logger = _logger](std::chrono::milliseconds timeout) {
@@ -344,11 +439,37 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
                             return;
                         }
 
+                        if (IsTimeAdvanceCoordinated() && !IsTimeAdvanceCoordinator()
+                            && descriptorParticipantName != _timeAdvanceCoordinator)
+                        {
+                            // With a coordinated time advance, only the coordinator's grants are awaited
+                            return;
+                        }
+
                         Debug(_participant->GetLogger(),
                               "TimeSyncService: Participant \'{}\' is added to the distributed time synchronization",
                               descriptorParticipantName);
 
-                        _timeConfiguration.AddSynchronizedParticipant(descriptorParticipantName);
+                        // With a coordinated time advance, the lookahead is already part of the coordinator's grant
+                        std::chrono::nanoseconds lookahead{0};
+                        std::string lookaheadString;
+                        if (!IsTimeAdvanceCoordinated() || IsTimeAdvanceCoordinator())
+                        {
+                            if (descriptor.GetSupplementalDataItem(Core::Discovery::timeSyncLookahead,
+                                                                   lookaheadString))
+                            {
+                                if (!TryParseLookahead(lookaheadString, lookahead))
+                                {
+                                    Warn(_logger,
+                                         "TimeSyncService: Ignoring the invalid lookahead \'{}\' of participant "
+                                         "\'{}\'",
+                                         lookaheadString, descriptorParticipantName);
+                                    lookahead = 0ns;
+                                }
+                            }
+                        }
+
+                        _timeConfiguration.AddSynchronizedParticipant(descriptorParticipantName, lookahead);
 
                         // If our time has advanced, we just added a late-joining participant.
                         if (_timeConfiguration.CurrentSimStep().timePoint >= 0ns)
@@ -360,7 +481,7 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
                                   "Participant \'{}\' is joining an already running simulation. Resending our "
                                   "NextSimTask.",
                                   descriptorParticipantName);
-                            SendMsg(_timeConfiguration.NextSimStep());
+                            ResendNextSimTask();
                         }
                     }
                     else if (discoveryEventType == Core::Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved)
@@ -373,6 +494,14 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
                                   "distributed time synchronization.",
                                   descriptorParticipantName);
 
+                            if (descriptorParticipantName == _timeAdvanceCoordinator)
+                            {
+                                Warn(_logger,
+                                     "TimeSyncService: The time advance coordinator '{}' has left the simulation. The "
+                                     "time advance of this participant is no longer synchronized.",
+                                     descriptorParticipantName);
+                            }
+
                             if (_timeSyncPolicy)
                             {
                                 // _otherNextTasks has changed, check if our sim task is due
@@ -482,8 +611,10 @@ void TimeSyncService::ExecuteSimStep(std::chrono::nanoseconds timePoint, std::ch
     using DoubleMSecs = std::chrono::duration<double, std::milli>;
     using DoubleSecs = std::chrono::duration<double>;
 
+    const auto stepStartTime = std::chrono::steady_clock::now();
     _waitTimeMonitor.StopMeasurement();
-    const auto waitingDuration = _waitTimeMonitor.CurrentDuration();
+    const auto waitingDuration =
+        _waitTimeMonitor.SampleCount() > 1 ? _waitTimeMonitor.CurrentDuration() : std::chrono::nanoseconds{0};
     const auto waitingDurationMs = std::chrono::duration_cast<DoubleMSecs>(waitingDuration);
     const auto waitingDurationS = std::chrono::duration_cast<DoubleSecs>(waitingDuration);
 
@@ -514,6 +645,19 @@ void TimeSyncService::ExecuteSimStep(std::chrono::nanoseconds timePoint, std::ch
     _simStepHandlerExecutionTimeStatisticMetric->Take(executionDurationS.count());
     _lastHandlerExecutionTimeMs = executionDurationMs;
 
+    // Attribution of the waiting time to the participant that we waited for
+    _simStepCriticalParticipant->second->Add(1);
+    if (_simStepCriticalPathEventListMetric != nullptr)
+    {
+        // <timePointNs> <waitingStartNs> <waitingDurationNs> <executionDurationNs> <criticalParticipant>
+        const auto waitingStartTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            (stepStartTime - waitingDuration).time_since_epoch());
+        _simStepCriticalPathEventListMetric->Add(
+            std::to_string(timePoint.count()) + ' ' + std::to_string(waitingStartTime.count()) + ' '
+            + std::to_string(waitingDuration.count()) + ' ' + std::to_string(executionDuration.count()) + ' '
+            + _simStepCriticalParticipant->first);
+    }
+
     if (IsBlocking())
     {
         // With the blocking SimulationStepHandler, the logical sim step ends here
@@ -526,6 +670,26 @@ void TimeSyncService::LogicalSimStepCompleted(std::chrono::duration<double, std:
     _simStepCounterMetric->Add(1);
     Trace(_logger, "Finished Simulation Step. Execution time was: {}ms", logicalSimStepTimeMs.count());
     _waitTimeMonitor.StartMeasurement();
+    // Unless a NextSimTask of another participant arrives that we still wait for, we are the last one
+    _simStepCriticalParticipant = _simStepOwnCriticalParticipant;
+}
+
+void TimeSyncService::SetSimStepCriticalParticipant(const std::string& participantName)
+{
+    _simStepCriticalParticipant = GetSimStepCriticalParticipant(participantName);
+}
+
+auto TimeSyncService::GetSimStepCriticalParticipant(const std::string& participantName)
+    -> const CriticalParticipantCounterMetrics::value_type*
+{
+    auto it = _simStepCriticalParticipantCounterMetrics.find(participantName);
+    if (it == _simStepCriticalParticipantCounterMetrics.end())
+    {
+        auto counterMetric =
+            _participant->GetMetricsManager()->GetCounter("SimStepCriticalParticipant/" + participantName);
+        it = _simStepCriticalParticipantCounterMetrics.emplace(participantName, counterMetric).first;
+    }
+    return &*it;
 }
 
 void TimeSyncService::CompleteSimulationStep()
@@ -581,6 +745,11 @@ void TimeSyncService::InitializeTimeSyncPolicy(bool isSynchronizingVirtualTime)
 
         _serviceDescriptor.SetSupplementalDataItem(SilKit::Core::Discovery::timeSyncActive,
                                                    (isSynchronizingVirtualTime) ? "1" : "0");
+        if (_lookahead > 0ns)
+        {
+            _serviceDescriptor.SetSupplementalDataItem(SilKit::Core::Discovery::timeSyncLookahead,
+                                                       std::to_string(_lookahead.count()));
+        }
         ResetTime();
     }
     catch (const std::exception& e)
@@ -592,9 +761,66 @@ void TimeSyncService::InitializeTimeSyncPolicy(bool isSynchronizingVirtualTime)
 
 void TimeSyncService::ResetTime()
 {
+    _hasSentNextSimTask = false;
+    _lastSentTimeAdvanceGrant = NextSimTask{-1ns, 0ns};
     GetTimeSyncPolicy()->Initialize();
 }
 
+void TimeSyncService::SendNextSimTask(const NextSimTask& task)
+{
+    _hasSentNextSimTask = true;
+
+    if (!IsTimeAdvanceCoordinated())
+    {
+        SendMsg(task);
+    }
+    else if (IsTimeAdvanceCoordinator())
+    {
+        UpdateTimeAdvanceGrant();
+    }
+    else
+    {
+        _participant->SendMsg(this, _timeAdvanceCoordinator, task);
+    }
+}
+
+void TimeSyncService::UpdateTimeAdvanceGrant()
+{
+    // Before our own first NextSimTask, the lowest next time point is not known yet
+    if (!IsTimeAdvanceCoordinator() || !_hasSentNextSimTask)
+    {
+        return;
+    }
+
+    // A lower grant (e.g., after a participant joined) is never sent. The participants only advance to time points
+    // that were already granted until the new participant has caught up, which is what the lower grant would enforce.
+    const auto grant = _timeConfiguration.LowestNextSimStep();
+    if (grant.timePoint > _lastSentTimeAdvanceGrant.timePoint)
+    {
+        _lastSentTimeAdvanceGrant = grant;
+        SendMsg(grant);
+    }
+}
+
+void TimeSyncService::ResendNextSimTask()
+{
+    if (!IsTimeAdvanceCoordinated())
+    {
+        SendMsg(_timeConfiguration.NextSimStep());
+    }
+    else if (IsTimeAdvanceCoordinator())
+    {
+        if (_lastSentTimeAdvanceGrant.timePoint >= 0ns)
+        {
+            SendMsg(_lastSentTimeAdvanceGrant);
+        }
+    }
+    else
+    {
+        _participant->SendMsg(this, _timeAdvanceCoordinator, _timeConfiguration.NextSimStep());
+    }
+}
+
 void TimeSyncService::ConfigureTimeProvider(Orchestration::TimeProviderKind timeProviderKind)
 {
     _timeProvider->ConfigureTimeProvider(timeProviderKind);
@@ -691,33 +917,19 @@ auto TimeSyncService::GetCurrentWallClockSyncPoint() const -> std::chrono::nanos
 
 
 // Mixture of sleep_for and busy waiting to achieve higher precision sleeps with the low-res windows times
-void TimeSyncService::HybridWait(std::chrono::nanoseconds targetWaitDuration)
+void TimeSyncService::HybridWait(std::chrono::steady_clock::time_point deadline)
 {
-    auto busyWait = [](std::chrono::nanoseconds duration) {
-        auto startTime = std::chrono::steady_clock::now();
-        while (std::chrono::steady_clock::now() - startTime < duration)
-        {
-            std::this_thread::yield();
-        }
-    };
-
-    // By default, Windows timer have a resolution of 15.6ms
-    // The effective time that wait_for or sleep_for actually waits will be a step function with steps every 15.6ms
-    const auto defaultTimerResolution = GetDefaultTimerResolution();
-
-    if (targetWaitDuration < defaultTimerResolution)
+    // Sleep until shortly before the deadline, which is as precise as the timers of the platform allow, and busy-wait
+    // the remaining spin tail
+    const auto sleepDeadline = deadline - _wallClockSpinTail;
+    if (sleepDeadline > std::chrono::steady_clock::now())
     {
-        busyWait(targetWaitDuration);
+        SleepUntil(sleepDeadline);
     }
-    else
+
+    while (std::chrono::steady_clock::now() < deadline)
     {
-        auto timeBeforeSleep = std::chrono::steady_clock::now();
-        // Wait the share of the targetWaitDuration that we can precisely achieve with the low timer resolution
-        auto sleepDuration = targetWaitDuration - defaultTimerResolution;
-        std::this_thread::sleep_for(sleepDuration);
-        // Busy-wait the remainder
-        auto remainder = targetWaitDuration - (std::chrono::steady_clock::now() - timeBeforeSleep);
-        busyWait(remainder);
+        std::this_thread::yield();
     }
 }
 
@@ -727,6 +939,12 @@ void TimeSyncService::StartWallClockCouplingThread()
     _wallClockCouplingThreadRunning = true;
     _wallClockCouplingThread = std::thread{[this]() {
         SilKit::Util::SetThreadName("SK-WallClkSync");
+#if defined(__linux__)
+        // The default timer slack of 50us delays every wake-up from a sleep of this thread
+        (void)prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+#endif
+
+        using DoubleSecs = std::chrono::duration<double>;
 
         const auto startTime = std::chrono::steady_clock::now();
         auto nextAnimatedWallClockSyncPoint = _timeConfiguration.NextSimStep().duration * _animationFactor;
@@ -734,17 +952,21 @@ void TimeSyncService::StartWallClockCouplingThread()
         while (_wallClockCouplingThreadRunning)
         {
             // Wait until the next SimTask is due according to the (animated) wall clock
-            auto currentRunDuration = std::chrono::steady_clock::now() - startTime;
-            auto durationUntilNextWallClockSyncPoint = nextAnimatedWallClockSyncPoint - currentRunDuration;
-            HybridWait(std::chrono::duration_cast<std::chrono::nanoseconds>(durationUntilNextWallClockSyncPoint));
+            const auto deadline =
+                startTime + std::chrono::duration_cast<std::chrono::nanoseconds>(nextAnimatedWallClockSyncPoint);
+            HybridWait(deadline);
 
             if (State() == ParticipantState::Running)
             {
+                const auto lateness =
+                    std::chrono::duration_cast<DoubleSecs>(std::chrono::steady_clock::now() - deadline);
+
                 auto duration =
                     std::chrono::duration_cast<std::chrono::nanoseconds>(_timeConfiguration.NextSimStep().duration);
                 _currentWallClockSyncPointNs += duration.count();
                 nextAnimatedWallClockSyncPoint += duration * _animationFactor;
 
+                bool requestNextStep{false};
                 if (GetTimeSyncPolicy()->IsExecutingSimStep())
                 {
                     // AsyncSimStepHandler not completed? Execution is lagging behind. Don't send the NextSimStep now, but after completion.
@@ -753,8 +975,17 @@ void TimeSyncService::StartWallClockCouplingThread()
                 }
                 else
                 {
-                    _participant->ExecuteDeferred([this]() { GetTimeSyncPolicy()->RequestNextStep(); });
+                    requestNextStep = true;
                 }
+
+                // The metrics are not thread-safe, they are only updated on the I/O worker thread
+                _participant->ExecuteDeferred([this, lateness, requestNextStep]() {
+                    _wallClockSyncPointLatenessStatisticMetric->Take(lateness.count());
+                    if (requestNextStep)
+                    {
+                        GetTimeSyncPolicy()->RequestNextStep();
+                    }
+                });
             }
         }
     }};
@@ -777,6 +1008,16 @@ bool TimeSyncService::IsBlocking() const
     return _timeConfiguration.IsBlocking();
 }
 
+auto TimeSyncService::IsTimeAdvanceCoordinated() const -> bool
+{
+    return !_timeAdvanceCoordinator.empty();
+}
+
+auto TimeSyncService::IsTimeAdvanceCoordinator() const -> bool
+{
+    return _timeAdvanceCoordinator == _participant->GetParticipantName();
+}
+
 } // namespace Orchestration
 } // namespace Services
 } // namespace SilKit
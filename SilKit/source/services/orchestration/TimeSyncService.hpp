@@ -24,6 +24,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <future>
 #include <tuple>
 #include <map>
+#include <unordered_map>
 #include <atomic>
 
 #include "silkit/services/orchestration/ITimeSyncService.hpp"
@@ -61,7 +62,7 @@ public:
     // Constructors, Destructor, and Assignment
     TimeSyncService(Core::IParticipantInternal* participant, ITimeProvider* timeProvider,
                     const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService,
-                    double animationFactor = 0);
+                    const Config::TimeSynchronization& timeSynchronizationConfig = {});
 
     ~TimeSyncService();
 
@@ -81,6 +82,12 @@ public:
     template <class MsgT>
     void SendMsg(MsgT&& msg) const;
     void ExecuteSimStep(std::chrono::nanoseconds timePoint, std::chrono::nanoseconds duration);
+    //! Announces our next simulation step, either to all synchronized participants, or to the coordinator
+    void SendNextSimTask(const NextSimTask& task);
+    //! Broadcasts the time point all participants may advance to, if we are the coordinator and it has increased
+    void UpdateTimeAdvanceGrant();
+    //! Attributes the waiting time before our next simulation step to the participant whose NextSimTask arrived last
+    void SetSimStepCriticalParticipant(const std::string& participantName);
 
     // Get the instance of the internal ITimeProvider that is updated with our simulation time
     void InitializeTimeSyncPolicy(bool isSynchronizingVirtualTime);
@@ -111,6 +118,16 @@ public:
 
     bool IsBlocking() const;
 
+    auto IsTimeAdvanceCoordinated() const -> bool;
+    auto IsTimeAdvanceCoordinator() const -> bool;
+
+private:
+    // ----------------------------------------
+    // private types
+
+    //! The counter metrics of the critical participants by participant name
+    using CriticalParticipantCounterMetrics = std::unordered_map<std::string, VSilKit::ICounterMetric*>;
+
 private:
     // ----------------------------------------
     // private methods
@@ -123,10 +140,18 @@ private:
 
     void StopWallClockCouplingThread();
     void StartWallClockCouplingThread();
-    void HybridWait(std::chrono::nanoseconds targetWaitDuration);
+    //! Waits until the deadline by sleeping and busy-waiting the final _wallClockSpinTail
+    void HybridWait(std::chrono::steady_clock::time_point deadline);
 
     void LogicalSimStepCompleted(std::chrono::duration<double, std::milli> logicalSimStepExecutionTimeMs);
 
+    //! Makes a late-joining participant aware of our (or, as coordinator, the granted) next simulation step
+    void ResendNextSimTask();
+
+    //! Returns the entry of the counter metric of the given participant, which is created on first use
+    auto GetSimStepCriticalParticipant(const std::string& participantName)
+        -> const CriticalParticipantCounterMetrics::value_type*;
+
 private:
     // ----------------------------------------
     // private members
@@ -141,7 +166,15 @@ private:
     VSilKit::IStatisticMetric* _simStepHandlerExecutionTimeStatisticMetric;
     VSilKit::IStatisticMetric* _simStepCompletionTimeStatisticMetric;
     VSilKit::IStatisticMetric* _simStepWaitingTimeStatisticMetric;
+    VSilKit::IStatisticMetric* _wallClockSyncPointLatenessStatisticMetric{nullptr};
+    VSilKit::IEventListMetric* _simStepCriticalPathEventListMetric{nullptr};
     std::chrono::duration<double, std::milli> _lastHandlerExecutionTimeMs;
+    // The entries are never removed, so pointers to them stay valid
+    CriticalParticipantCounterMetrics _simStepCriticalParticipantCounterMetrics;
+    // The participant whose NextSimTask arrived last before our next simulation step, or ourselves if all other
+    // participants were already waiting for us
+    const CriticalParticipantCounterMetrics::value_type* _simStepCriticalParticipant{nullptr};
+    const CriticalParticipantCounterMetrics::value_type* _simStepOwnCriticalParticipant{nullptr};
 
     mutable std::mutex _timeSyncPolicyMx;
     std::shared_ptr<ITimeSyncPolicy> _timeSyncPolicy{nullptr};
@@ -164,8 +197,17 @@ private:
     mutable std::mutex _mx;
     std::atomic<std::chrono::nanoseconds::rep> _currentWallClockSyncPointNs{0};
     double _animationFactor{0};
+    std::chrono::nanoseconds _wallClockSpinTail{0};
     std::atomic<bool> _wallClockCouplingThreadRunning{false};
     std::atomic<bool> _wallClockReachedBeforeCompletion{false};
+
+    // Coordinated time advance: The participants send their next simulation step only to the coordinator, which
+    // broadcasts the lowest next time point of all participants as a NextSimTask, i.e., as a grant to advance. The
+    // grant is not ordered with the messages sent directly between the participants, and may overtake them.
+    std::string _timeAdvanceCoordinator;
+    bool _hasSentNextSimTask{false};
+    std::chrono::nanoseconds _lookahead{0};
+    NextSimTask _lastSentTimeAdvanceGrant{-1ns, 0ns};
 };
 
 // ================================================================================
@@ -22,7 +22,6 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <iostream>
 
 #include "WatchDog.hpp"
-#include "SetThreadName.hpp"
 
 using namespace std::chrono_literals;
 
@@ -30,16 +29,20 @@ namespace {
 
 auto GetDefaultClock() -> SilKit::Services::Orchestration::WatchDog::IClock*;
 
+// The resolution of the checks, common to all watchdogs of the process
+constexpr std::chrono::milliseconds watchDogResolution{2};
+
 } // namespace
 
 namespace SilKit {
 namespace Services {
 namespace Orchestration {
 
-WatchDog::WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock)
+WatchDog::WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock, Logging::ILogger* logger)
     : _clock{clock ? clock : GetDefaultClock()}
     , _warnHandler{[](std::chrono::milliseconds) {}}
     , _errorHandler{[](std::chrono::milliseconds) {}}
+    , _logger{logger}
 {
     if (healthCheckConfig.softResponseTimeout.has_value())
     {
@@ -54,13 +57,18 @@ WatchDog::WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock)
         if (_errorTimeout <= 0ms)
             throw SilKitError{"WatchDog requires errorTimeout > 0ms"};
     }
-    _watchThread = std::thread{&WatchDog::Run, this};
+    _watchThread = Util::SharedPeriodicThread::Get(watchDogResolution, "SilKit-Watchdog");
+    _watchThread->Add(this, [this] { Check(); }, logger);
 }
 
 WatchDog::~WatchDog()
 {
-    _stopPromise.set_value();
-    _watchThread.join();
+    _watchThread->Remove(this);
+
+    if (_pendingHandler.valid())
+    {
+        _pendingHandler.wait();
+    }
 }
 
 void WatchDog::Start()
@@ -83,68 +91,81 @@ void WatchDog::SetErrorHandler(std::function<void(std::chrono::milliseconds)> ha
     _errorHandler = std::move(handler);
 }
 
-void WatchDog::Run()
+void WatchDog::Check()
 {
-    enum class WatchDogState
+    if (_pendingHandler.valid() && _pendingHandler.wait_for(0ms) != std::future_status::ready)
     {
-        Healthy,
-        Warn,
-        Error
-    };
+        // The next state is checked once the handler of the last one has finished. This keeps the handlers in order.
+        return;
+    }
 
-    SilKit::Util::SetThreadName("SilKit-Watchdog");
-    WatchDogState state = WatchDogState::Healthy;
-    auto stopFuture = _stopPromise.get_future();
+    const auto startTime = _startTime.load();
 
-    while (true)
+    // We only communicate with the "main thread" via the atomic _startTime.
+    // If _startTime is duration::min(), Start() has not yet been called.
+    // Otherwise, _startTime is the duration since epoch when the Start() was called.
+    if (startTime == std::chrono::nanoseconds::min())
     {
-        auto futureStatus = stopFuture.wait_for(_resolution);
+        // no job is currently running. Reset state.
+        _state = WatchDogState::Healthy;
+        return;
+    }
+
+    // These declarations are after the startTime check to prevent integer overflow
+    // by deferring arithmetic on duration::min() until Start() was called.
+    const auto now = _clock->Now();
+    const auto currentRunDuration = std::chrono::duration_cast<std::chrono::milliseconds>(now - startTime);
 
-        if (futureStatus == std::future_status::ready)
+    if (currentRunDuration > _warnTimeout && currentRunDuration <= _errorTimeout)
+    {
+        if (_state == WatchDogState::Healthy)
         {
-            // stop was signaled; stopping thread;
-            return;
+            InvokeHandler(_warnHandler, currentRunDuration);
+            _state = WatchDogState::Warn;
         }
+        return;
+    }
 
-        const auto startTime = _startTime.load();
-
-        // We only communicate with the "main thread" via the atomic _startTime.
-        // If _startTime is duration::min(), Start() has not yet been called.
-        // Otherwise, _startTime is the duration since epoch when the Start() was called.
-        if (startTime == std::chrono::nanoseconds::min())
+    if (currentRunDuration > _errorTimeout)
+    {
+        if (_state != WatchDogState::Error)
         {
-            // no job is currently running. Reset state and continue.
-            state = WatchDogState::Healthy;
-            continue;
+            InvokeHandler(_errorHandler, currentRunDuration);
+            _state = WatchDogState::Error;
         }
+        return;
+    }
 
-        // These declarations are after the startTime check to prevent integer overflow
-        // by deferring arithmetic on duration::min() until Start() was called.
-        const auto now = _clock->Now();
-        const auto currentRunDuration = std::chrono::duration_cast<std::chrono::milliseconds>(now - startTime);
+    // If neither warning, nor error timeouts were hit, the state is healthy.
+    _state = WatchDogState::Healthy;
+}
 
-        if (currentRunDuration > _warnTimeout && currentRunDuration <= _errorTimeout)
+void WatchDog::InvokeHandler(const std::function<void(std::chrono::milliseconds)>& handler,
+                             std::chrono::milliseconds currentRunDuration)
+{
+    // The handlers may block, e.g., when the error is reported to the lifecycle. They run on their own thread, so they
+    // do not delay the checks of the other watchdogs on the shared thread.
+    _pendingHandler = std::async(std::launch::async, [this, handler, currentRunDuration] {
+        try
         {
-            if (state == WatchDogState::Healthy)
-            {
-                _warnHandler(currentRunDuration);
-                state = WatchDogState::Warn;
-            }
-            continue;
+            handler(currentRunDuration);
         }
-
-        if (currentRunDuration > _errorTimeout)
+        catch (const std::exception& e)
         {
-            if (state != WatchDogState::Error)
-            {
-                _errorHandler(currentRunDuration);
-                state = WatchDogState::Error;
-            }
-            continue;
+            LogHandlerException(e.what());
         }
+        catch (...)
+        {
+            LogHandlerException("unknown exception");
+        }
+    });
+}
 
-        // If neither warning, nor error timeouts were hit, the state is healthy.
-        state = WatchDogState::Healthy;
+void WatchDog::LogHandlerException(const char* what)
+{
+    if (_logger != nullptr)
+    {
+        _logger->Error(std::string{"WatchDog: Handler threw an exception: "} + what);
     }
 }
 
@@ -24,9 +24,13 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <atomic>
 #include <future>
 #include <chrono>
+#include <functional>
 #include <memory>
 
+#include "silkit/services/logging/ILogger.hpp"
+
 #include "ParticipantConfiguration.hpp"
+#include "SharedPeriodicThread.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -46,7 +50,10 @@ public:
 public:
     // ----------------------------------------
     // Constructors, Destructor, and Assignment
-    WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock = nullptr);
+    //! The warn and error handlers run on a thread of their own, in the order of the timeouts. Exceptions thrown by
+    //! them are logged to the given logger, if any.
+    WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock = nullptr,
+             Logging::ILogger* logger = nullptr);
     ~WatchDog();
 
 public:
@@ -62,10 +69,27 @@ public:
     std::chrono::milliseconds GetWarnTimeout();
     std::chrono::milliseconds GetErrorTimeout();
 
+private:
+    // ----------------------------------------
+    // private types
+    enum class WatchDogState
+    {
+        Healthy,
+        Warn,
+        Error
+    };
+
 private:
     // ----------------------------------------
     // private methods
-    void Run();
+
+    //! Called periodically by the watchdog thread, which is shared by all watchdogs of the process
+    void Check();
+
+    //! Runs the handler on its own thread
+    void InvokeHandler(const std::function<void(std::chrono::milliseconds)>& handler,
+                       std::chrono::milliseconds currentRunDuration);
+    void LogHandlerException(const char* what);
 
 public:
     const std::chrono::milliseconds _defaultTimeout = std::chrono::milliseconds::max();
@@ -73,20 +97,24 @@ public:
 private:
     // ----------------------------------------
     // private members
-    std::promise<void> _stopPromise;
     /// Clock used for watchdog timing. Can be injected via the constructor.
     IClock* _clock;
     // we use a duration instead of a timepoint to avoid a bug in clang6 (up to v9.0)
     std::atomic<std::chrono::nanoseconds> _startTime{std::chrono::nanoseconds::min()};
 
-    std::chrono::milliseconds _resolution = std::chrono::milliseconds{2};
     std::chrono::milliseconds _warnTimeout = _defaultTimeout;
     std::chrono::milliseconds _errorTimeout = _defaultTimeout;
 
     std::function<void(std::chrono::milliseconds)> _warnHandler;
     std::function<void(std::chrono::milliseconds)> _errorHandler;
+    Logging::ILogger* _logger;
+
+    //! Only accessed by the watchdog thread
+    WatchDogState _state{WatchDogState::Healthy};
+    //! The last invoked handler. Only accessed by the watchdog thread and the destructor.
+    std::future<void> _pendingHandler;
 
-    std::thread _watchThread;
+    std::shared_ptr<Util::SharedPeriodicThread> _watchThread;
 };
 
 } // namespace Orchestration
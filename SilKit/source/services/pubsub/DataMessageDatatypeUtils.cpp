@@ -21,8 +21,76 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "DataMessageDatatypeUtils.hpp"
 #include "silkit/services/datatypes.hpp"
+#include "silkit/participant/exception.hpp"
 #include "Optional.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+namespace {
+
+const char hexDigits[] = "0123456789abcdef";
+
+void AppendHex(std::string& out, const std::vector<uint8_t>& bytes)
+{
+    for (auto byte : bytes)
+    {
+        out.push_back(hexDigits[byte >> 4]);
+        out.push_back(hexDigits[byte & 0x0f]);
+    }
+}
+
+auto ParseHex(const std::string& hex) -> std::vector<uint8_t>
+{
+    auto parseDigit = [](char digit) -> uint8_t {
+        const auto* end = hexDigits + sizeof(hexDigits) - 1;
+        const auto* it = std::find(hexDigits, end, digit);
+        if (it == end)
+        {
+            throw SilKit::SilKitError{"Invalid content filter: bad hex digit"};
+        }
+        return static_cast<uint8_t>(it - hexDigits);
+    };
+
+    if (hex.size() % 2 != 0)
+    {
+        throw SilKit::SilKitError{"Invalid content filter: odd number of hex digits"};
+    }
+    std::vector<uint8_t> bytes;
+    bytes.reserve(hex.size() / 2);
+    for (size_t i = 0; i < hex.size(); i += 2)
+    {
+        bytes.push_back(static_cast<uint8_t>((parseDigit(hex[i]) << 4) | parseDigit(hex[i + 1])));
+    }
+    return bytes;
+}
+
+bool MatchContentFilter(const SilKit::Services::PubSub::DataContentFilter& contentFilter,
+                        SilKit::Util::Span<const uint8_t> data)
+{
+    if (contentFilter.offset > data.size() || data.size() - contentFilter.offset < contentFilter.value.size())
+    {
+        return false;
+    }
+
+    const auto* compared = data.data() + contentFilter.offset;
+    if (contentFilter.mask.empty())
+    {
+        return std::equal(contentFilter.value.begin(), contentFilter.value.end(), compared);
+    }
+    for (size_t i = 0; i < contentFilter.value.size(); ++i)
+    {
+        if (((compared[i] ^ contentFilter.value[i]) & contentFilter.mask[i]) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
 namespace SilKit {
 namespace Services {
 namespace PubSub {
@@ -39,11 +107,125 @@ bool operator==(const WireDataMessageEvent& lhs, const WireDataMessageEvent& rhs
     return ToDataMessageEvent(lhs) == ToDataMessageEvent(rhs);
 }
 
+bool operator==(const WireDataMessageBatch& lhs, const WireDataMessageBatch& rhs)
+{
+    return Util::ItemsAreEqual(lhs.data, rhs.data) && lhs.sampleSizes == rhs.sampleSizes;
+}
+
+auto MakeWireDataMessageBatch(std::chrono::nanoseconds timestamp,
+                              Util::Span<const Util::Span<const uint8_t>> samples) -> WireDataMessageBatch
+{
+    size_t size{0};
+    for (const auto& sample : samples)
+    {
+        if (sample.size() > (std::numeric_limits<uint32_t>::max)())
+        {
+            throw SilKitError{"DataPublisher::PublishBatch: The data of a sample must be smaller than 4 GiB"};
+        }
+        size += sample.size();
+    }
+
+    std::vector<uint8_t> data;
+    data.reserve(size);
+    std::vector<uint32_t> sampleSizes;
+    sampleSizes.reserve(samples.size());
+    for (const auto& sample : samples)
+    {
+        data.insert(data.end(), sample.begin(), sample.end());
+        sampleSizes.push_back(static_cast<uint32_t>(sample.size()));
+    }
+    return WireDataMessageBatch{timestamp, std::move(data), std::move(sampleSizes)};
+}
+
+auto GetSamples(const WireDataMessageBatch& batch) -> std::vector<Util::Span<const uint8_t>>
+{
+    const auto data = batch.data.AsSpan();
+
+    std::vector<Util::Span<const uint8_t>> samples;
+    samples.reserve(batch.sampleSizes.size());
+    size_t offset{0};
+    for (const auto sampleSize : batch.sampleSizes)
+    {
+        if (data.size() - offset < sampleSize)
+        {
+            throw SilKitError{"Invalid data message batch: The samples exceed the data"};
+        }
+        samples.emplace_back(data.data() + offset, sampleSize);
+        offset += sampleSize;
+    }
+    return samples;
+}
+
 bool MatchMediaType(const std::string& subMediaType, const std::string& pubMediaType)
 {
     return subMediaType == "" || subMediaType == pubMediaType;
 }
 
+bool MatchContentFilters(const std::vector<DataContentFilter>& contentFilters, Util::Span<const uint8_t> data)
+{
+    return std::all_of(contentFilters.begin(), contentFilters.end(), [data](const DataContentFilter& contentFilter) {
+        return MatchContentFilter(contentFilter, data);
+    });
+}
+
+// The filters are separated by ';' and consist of "offset:value:mask", with the value and mask as hex digits
+auto SerializeContentFilters(const std::vector<DataContentFilter>& contentFilters) -> std::string
+{
+    std::string out;
+    for (const auto& contentFilter : contentFilters)
+    {
+        if (!out.empty())
+        {
+            out.push_back(';');
+        }
+        out += std::to_string(contentFilter.offset);
+        out.push_back(':');
+        AppendHex(out, contentFilter.value);
+        out.push_back(':');
+        AppendHex(out, contentFilter.mask);
+    }
+    return out;
+}
+
+auto DeserializeContentFilters(const std::string& serializedContentFilters) -> std::vector<DataContentFilter>
+{
+    std::vector<DataContentFilter> contentFilters;
+    if (serializedContentFilters.empty())
+    {
+        return contentFilters;
+    }
+
+    std::istringstream in{serializedContentFilters};
+    std::string serializedContentFilter;
+    while (std::getline(in, serializedContentFilter, ';'))
+    {
+        const auto valuePos = serializedContentFilter.find(':');
+        const auto maskPos = serializedContentFilter.find(':', valuePos + 1);
+        if (valuePos == 0 || valuePos == std::string::npos || maskPos == std::string::npos)
+        {
+            throw SilKitError{"Invalid content filter: " + serializedContentFilter};
+        }
+
+        DataContentFilter contentFilter;
+        const auto offset = serializedContentFilter.substr(0, valuePos);
+        // NB: At most 18 digits always fit into 64 bits
+        if (offset.size() > 18
+            || !std::all_of(offset.begin(), offset.end(), [](char c) { return c >= '0' && c <= '9'; }))
+        {
+            throw SilKitError{"Invalid content filter: " + serializedContentFilter};
+        }
+        contentFilter.offset = static_cast<size_t>(std::stoull(offset));
+        contentFilter.value = ParseHex(serializedContentFilter.substr(valuePos + 1, maskPos - valuePos - 1));
+        contentFilter.mask = ParseHex(serializedContentFilter.substr(maskPos + 1));
+        if (!contentFilter.mask.empty() && contentFilter.mask.size() != contentFilter.value.size())
+        {
+            throw SilKitError{"Invalid content filter: " + serializedContentFilter};
+        }
+        contentFilters.push_back(std::move(contentFilter));
+    }
+    return contentFilters;
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace SilKit
@@ -21,10 +21,14 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <chrono>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "silkit/services/datatypes.hpp"
 #include "silkit/services/pubsub/PubSubDatatypes.hpp"
+#include "silkit/services/pubsub/PubSubSpec.hpp"
 #include "silkit/util/HandlerId.hpp"
 
 #include "WireDataMessages.hpp"
@@ -39,8 +43,26 @@ bool operator==(const DataMessageEvent& lhs, const DataMessageEvent& rhs);
 
 bool operator==(const WireDataMessageEvent& lhs, const WireDataMessageEvent& rhs);
 
+bool operator==(const WireDataMessageBatch& lhs, const WireDataMessageBatch& rhs);
+
+//! Copies the samples back to back into a single message
+auto MakeWireDataMessageBatch(std::chrono::nanoseconds timestamp,
+                              Util::Span<const Util::Span<const uint8_t>> samples) -> WireDataMessageBatch;
+
+//! Returns non-owning references to the samples of the batch
+//! \throw SilKit::SilKitError If the sample sizes exceed the size of the data
+auto GetSamples(const WireDataMessageBatch& batch) -> std::vector<Util::Span<const uint8_t>>;
+
 bool MatchMediaType(const std::string& subMediaType, const std::string& pubMediaType);
 
+//! True if the data matches all content filters
+bool MatchContentFilters(const std::vector<DataContentFilter>& contentFilters, Util::Span<const uint8_t> data);
+
+//! Encodes the content filters for the supplemental data of a service descriptor
+auto SerializeContentFilters(const std::vector<DataContentFilter>& contentFilters) -> std::string;
+//! \throw SilKit::SilKitError If the string is not a valid encoding of content filters
+auto DeserializeContentFilters(const std::string& serializedContentFilters) -> std::vector<DataContentFilter>;
+
 } // namespace PubSub
 } // namespace Services
 } // namespace SilKit
@@ -23,7 +23,18 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IParticipantInternal.hpp"
 #include "DataMessageDatatypeUtils.hpp"
 #include "WireDataMessages.hpp"
+#include "IServiceDiscovery.hpp"
+#include "ServiceConfigKeys.hpp"
+#include "traits/SilKitMsgTraits.hpp"
 #include "silkit/util/Span.hpp"
+#include "silkit/services/logging/ILogger.hpp"
+
+namespace {
+
+// The pool must hold the buffers which are still being transmitted
+constexpr size_t maxPooledBuffers{16};
+
+} // namespace
 
 namespace SilKit {
 namespace Services {
@@ -40,12 +51,100 @@ DataPublisher::DataPublisher(Core::IParticipantInternal* participant,
     , _timeProvider{timeProvider}
     , _participant{participant}
     , _config{config}
+    , _bufferPool{Util::BufferPool::Create(maxPooledBuffers)}
+{
+}
+
+void DataPublisher::RegisterServiceDiscovery()
+{
+    auto handler = [this](SilKit::Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
+                          const SilKit::Core::ServiceDescriptor& serviceDescriptor) {
+        const auto& participantName = serviceDescriptor.GetParticipantName();
+        const auto serviceId = serviceDescriptor.GetServiceId();
+
+        std::unique_lock<decltype(_remoteContentFiltersMx)> lock{_remoteContentFiltersMx};
+        if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated)
+        {
+            std::vector<DataContentFilter> contentFilters;
+            std::string contentFiltersStr;
+            if (serviceDescriptor.GetSupplementalDataItem(
+                    Core::Discovery::supplKeyDataSubscriberInternalContentFilters, contentFiltersStr))
+            {
+                try
+                {
+                    contentFilters = DeserializeContentFilters(contentFiltersStr);
+                }
+                catch (const SilKitError& error)
+                {
+                    // Send all data to the subscriber, which still filters it by itself
+                    _participant->GetLogger()->Warn("DataPublisher on topic " + _topic
+                                                    + " ignores the content filters of a subscriber on participant "
+                                                    + participantName + ": " + error.what());
+                }
+            }
+            _remoteContentFilters[participantName][serviceId] = std::move(contentFilters);
+        }
+        else if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved)
+        {
+            auto it = _remoteContentFilters.find(participantName);
+            if (it != _remoteContentFilters.end())
+            {
+                it->second.erase(serviceId);
+                if (it->second.empty())
+                {
+                    _remoteContentFilters.erase(it);
+                }
+            }
+        }
+    };
+
+    _participant->GetServiceDiscovery()->RegisterSpecificServiceDiscoveryHandler(
+        handler, Core::Discovery::controllerTypeDataSubscriberInternal, _pubUUID, {});
+}
+
+bool DataPublisher::IsWantedBy(const std::string& participantName, const WireDataMessageEvent& msg)
+{
+    const auto data = msg.data.AsSpan();
+    return IsWantedByInternal(participantName, {&data, 1});
+}
+
+bool DataPublisher::IsWantedBy(const std::string& participantName, const WireDataMessageBatch& msg)
 {
+    const auto samples = GetSamples(msg);
+    return IsWantedByInternal(participantName, samples);
+}
+
+bool DataPublisher::IsWantedByInternal(const std::string& participantName,
+                                       Util::Span<const Util::Span<const uint8_t>> samples)
+{
+    std::unique_lock<decltype(_remoteContentFiltersMx)> lock{_remoteContentFiltersMx};
+    auto it = _remoteContentFilters.find(participantName);
+    if (it == _remoteContentFilters.end())
+    {
+        // The subscribers of the participant are not discovered yet
+        return true;
+    }
+
+    for (const auto& contentFilters : it->second)
+    {
+        for (const auto& sample : samples)
+        {
+            if (MatchContentFilters(contentFilters.second, sample))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
 }
 
 void DataPublisher::PublishInternal(Util::Span<const uint8_t> data)
 {
-    WireDataMessageEvent msg{_timeProvider->Now(), data};
+    PublishInternal(WireDataMessageEvent{_timeProvider->Now(), data});
+}
+
+void DataPublisher::PublishInternal(WireDataMessageEvent msg)
+{
     _tracer.Trace(SilKit::Services::TransmitDirection::TX, msg.timestamp, ToDataMessageEvent(msg));
     _participant->SendMsg(this, msg);
 }
@@ -59,6 +158,70 @@ void DataPublisher::Publish(Util::Span<const uint8_t> data)
     PublishInternal(data);
 }
 
+void DataPublisher::PublishBatch(Util::Span<const Util::Span<const uint8_t>> data)
+{
+    // NB: Batches are sent as another message type, whose history and latest data are kept apart from the single values
+    if ((_config.history.has_value() && _config.history.value() != 0) || _config.keepLatest)
+    {
+        throw ConfigurationError{
+            "DataPublisher::PublishBatch: Batches cannot be published by a publisher with a history or KeepLatest"};
+    }
+
+    if (Tracing::IsReplayEnabledFor(_config.replay, Config::Replay::Direction::Send) || data.empty())
+    {
+        return;
+    }
+
+    if (!CanPublishBatches())
+    {
+        // NB: Participants of older versions would silently drop the batch, therefore the data is published one by one
+        for (const auto& sample : data)
+        {
+            PublishInternal(sample);
+        }
+        return;
+    }
+
+    const auto msg = MakeWireDataMessageBatch(_timeProvider->Now(), data);
+    for (const auto& sample : data)
+    {
+        _tracer.Trace(SilKit::Services::TransmitDirection::TX, msg.timestamp, DataMessageEvent{msg.timestamp, sample});
+    }
+    _participant->SendMsg(this, msg);
+}
+
+bool DataPublisher::CanPublishBatches()
+{
+    const auto numDataReceivers =
+        _participant->GetNumberOfRemoteReceivers(this, Core::SilKitMsgTraits<WireDataMessageEvent>::SerdesName());
+    const auto numBatchReceivers =
+        _participant->GetNumberOfRemoteReceivers(this, Core::SilKitMsgTraits<WireDataMessageBatch>::SerdesName());
+    return numBatchReceivers >= numDataReceivers;
+}
+
+auto DataPublisher::Loan(size_t size) -> Util::Span<uint8_t>
+{
+    _loanedBuffer = _bufferPool->Acquire(size);
+    return {_loanedBuffer->data(), _loanedBuffer->size()};
+}
+
+void DataPublisher::Commit()
+{
+    if (!_loanedBuffer)
+    {
+        throw StateError{"DataPublisher::Commit: No buffer is loaned"};
+    }
+
+    auto buffer = std::move(_loanedBuffer);
+    _loanedBuffer.reset();
+
+    if (Tracing::IsReplayEnabledFor(_config.replay, Config::Replay::Direction::Send))
+    {
+        return;
+    }
+    PublishInternal(WireDataMessageEvent{_timeProvider->Now(), Util::SharedVector<uint8_t>{std::move(buffer)}});
+}
+
 void DataPublisher::ReplayMessage(const SilKit::IReplayMessage* message)
 {
     using namespace SilKit::Tracing;
@@ -21,6 +21,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "silkit/services/pubsub/IDataPublisher.hpp"
@@ -30,6 +33,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IParticipantInternal.hpp"
 #include "ITraceMessageSource.hpp"
 #include "IReplayDataController.hpp"
+#include "WireDataMessages.hpp"
+#include "BufferPool.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -50,8 +55,22 @@ public:
 
 
 public: // Methods
+    //! Discovers the DataSubscriberInternals on the link of this publisher and their content filters
+    void RegisterServiceDiscovery();
+
+    //! Returns false if no DataSubscriberInternal of the participant accepts the data
+    bool IsWantedBy(const std::string& participantName, const WireDataMessageEvent& msg);
+    //! Returns false if no DataSubscriberInternal of the participant accepts any sample of the batch
+    bool IsWantedBy(const std::string& participantName, const WireDataMessageBatch& msg);
+
     void Publish(Util::Span<const uint8_t> data) override;
 
+    void PublishBatch(Util::Span<const Util::Span<const uint8_t>> data) override;
+
+    auto Loan(size_t size) -> Util::Span<uint8_t> override;
+
+    void Commit() override;
+
     //SilKit::Services::Orchestration::ITimeConsumer
     void SetTimeProvider(Services::Orchestration::ITimeProvider* provider) override;
 
@@ -69,6 +88,12 @@ public: // Methods
 
 private: // Methods
     void PublishInternal(Util::Span<const uint8_t> data);
+    void PublishInternal(WireDataMessageEvent msg);
+
+    //! Participants of older versions do not receive batches
+    bool CanPublishBatches();
+
+    bool IsWantedByInternal(const std::string& participantName, Util::Span<const Util::Span<const uint8_t>> samples);
 
 private: // Member
     std::string _topic;
@@ -82,6 +107,14 @@ private: // Member
     Core::IParticipantInternal* _participant{nullptr};
 
     Config::DataPublisher _config;
+
+    // The loaned buffers are shared with the sent messages and return to the pool once they are transmitted
+    std::shared_ptr<Util::BufferPool> _bufferPool;
+    std::shared_ptr<Util::BufferPool::Buffer> _loanedBuffer;
+
+    // The content filters of the DataSubscriberInternals on the link, by participant name and service id
+    std::mutex _remoteContentFiltersMx;
+    std::map<std::string, std::map<Core::EndpointId, std::vector<DataContentFilter>>> _remoteContentFilters;
 };
 
 // ================================================================================
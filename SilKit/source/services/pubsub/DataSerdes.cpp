@@ -37,6 +37,18 @@ inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buff
     return buffer;
 }
 
+inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer, const WireDataMessageBatch& msg)
+{
+    buffer << msg.data << msg.sampleSizes << msg.timestamp;
+    return buffer;
+}
+
+inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer, WireDataMessageBatch& msg)
+{
+    buffer >> msg.data >> msg.sampleSizes >> msg.timestamp;
+    return buffer;
+}
+
 void Serialize(SilKit::Core::MessageBuffer& buffer, const WireDataMessageEvent& msg)
 {
     buffer << msg;
@@ -48,6 +60,16 @@ void Deserialize(SilKit::Core::MessageBuffer& buffer, WireDataMessageEvent& out)
     buffer >> out;
 }
 
+void Serialize(SilKit::Core::MessageBuffer& buffer, const WireDataMessageBatch& msg)
+{
+    buffer << msg;
+}
+
+void Deserialize(SilKit::Core::MessageBuffer& buffer, WireDataMessageBatch& out)
+{
+    buffer >> out;
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace SilKit
@@ -21,9 +21,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "DataSubscriber.hpp"
 #include "IServiceDiscovery.hpp"
-#include "YamlParser.hpp"
 #include "LabelMatching.hpp"
 
+#include <limits>
+
 #include "silkit/services/logging/ILogger.hpp"
 
 namespace SilKit {
@@ -37,6 +38,7 @@ DataSubscriber::DataSubscriber(Core::IParticipantInternal* participant, Config::
     : _topic{dataSpec.Topic()}
     , _mediaType{dataSpec.MediaType()}
     , _labels{dataSpec.Labels()}
+    , _contentFilters{dataSpec.ContentFilters()}
     , _defaultDataHandler{WrapTracingCallback(defaultDataHandler)}
     , _timeProvider{timeProvider}
     , _participant{participant}
@@ -48,7 +50,7 @@ void DataSubscriber::RegisterServiceDiscovery()
 {
     auto matchHandler = [this](SilKit::Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
                                const SilKit::Core::ServiceDescriptor& serviceDescriptor) {
-        auto getVal = [serviceDescriptor](const std::string& key) {
+        auto getVal = [&serviceDescriptor](const std::string& key) {
             std::string tmp;
             if (!serviceDescriptor.GetSupplementalDataItem(key, tmp))
             {
@@ -73,8 +75,7 @@ void DataSubscriber::RegisterServiceDiscovery()
             if (MatchMediaType(_mediaType, pubMediaType))
             {
                 const std::string labelsStr = getVal(Core::Discovery::supplKeyDataPublisherPubLabels);
-                const std::vector<SilKit::Services::MatchingLabel> publisherLabels =
-                    SilKit::Config::Deserialize<std::vector<SilKit::Services::MatchingLabel>>(labelsStr);
+                const auto& publisherLabels = _participant->GetServiceDiscovery()->GetMatchingLabels(labelsStr);
                 if (Util::MatchLabels(_labels, publisherLabels))
                 {
                     std::unique_lock<decltype(_internalSubscribersMx)> lock(_internalSubscribersMx);
@@ -100,11 +101,133 @@ void DataSubscriber::RegisterServiceDiscovery()
 void DataSubscriber::SetDataMessageHandler(DataMessageHandler callback)
 {
     std::unique_lock<decltype(_internalSubscribersMx)> lock(_internalSubscribersMx);
-    auto tracingCallback = WrapTracingCallback(std::move(callback));
+    // With the receive queue enabled, the received data is only traced
+    auto tracingCallback = WrapTracingCallback(_receiveQueueEnabled ? DataMessageHandler{} : std::move(callback));
     _defaultDataHandler = tracingCallback;
     for (auto internalSubscriber : _internalSubscribers)
     {
-        internalSubscriber.second->SetDataMessageHandler(tracingCallback);
+        internalSubscriber.second->SetDataMessageHandler(this, tracingCallback);
+    }
+}
+
+void DataSubscriber::SetDataMessageBatchHandler(DataMessageBatchHandler callback)
+{
+    std::unique_lock<decltype(_internalSubscribersMx)> lock(_internalSubscribersMx);
+    _dataMessageBatchHandler = WrapBatchTracingCallback(std::move(callback));
+    for (auto internalSubscriber : _internalSubscribers)
+    {
+        internalSubscriber.second->SetDataMessageBatchHandler(this, _dataMessageBatchHandler);
+    }
+}
+
+auto DataSubscriber::GetDataMessageBatchHandler() const -> DataMessageBatchHandler
+{
+    std::unique_lock<decltype(_internalSubscribersMx)> lock(_internalSubscribersMx);
+    return _dataMessageBatchHandler;
+}
+
+void DataSubscriber::EnableReceiveQueue(size_t capacity, ReceiveQueueOverflowPolicy overflowPolicy)
+{
+    if (capacity == 0)
+    {
+        throw SilKitError{"DataSubscriber: The capacity of the receive queue must not be zero"};
+    }
+
+    std::unique_lock<decltype(_internalSubscribersMx)> lock(_internalSubscribersMx);
+    if (_receiveQueueEnabled)
+    {
+        throw StateError{"DataSubscriber: The receive queue is already enabled"};
+    }
+
+    _receiveQueueEnabled = true;
+    if (!_config.keepLatest)
+    {
+        _receiveQueue = std::make_shared<DataMessageReceiveQueue>(
+            capacity, overflowPolicy == ReceiveQueueOverflowPolicy::DropOldest
+                          ? DataMessageReceiveQueue::OverflowPolicy::DropOldest
+                          : DataMessageReceiveQueue::OverflowPolicy::DropNewest);
+    }
+    _taken.reserve(capacity);
+
+    _defaultDataHandler = WrapTracingCallback({});
+    for (auto internalSubscriber : _internalSubscribers)
+    {
+        internalSubscriber.second->SetReceiveQueue(this, GetReceiveQueue(internalSubscriber.second),
+                                                   _defaultDataHandler);
+    }
+}
+
+auto DataSubscriber::GetReceiveQueue(DataSubscriberInternal* internalSubscriber)
+    -> std::shared_ptr<DataMessageReceiveQueue>
+{
+    std::unique_lock<decltype(_internalSubscribersMx)> lock(_internalSubscribersMx);
+    if (!_receiveQueueEnabled)
+    {
+        return nullptr;
+    }
+    if (!_config.keepLatest)
+    {
+        return _receiveQueue;
+    }
+
+    // A single slot which the newer data of the publisher overwrites
+    auto& latestReceiveQueue = _latestReceiveQueues[internalSubscriber];
+    if (!latestReceiveQueue)
+    {
+        latestReceiveQueue =
+            std::make_shared<DataMessageReceiveQueue>(1, DataMessageReceiveQueue::OverflowPolicy::DropOldest);
+    }
+    return latestReceiveQueue;
+}
+
+bool DataSubscriber::TryTake(DataMessageEvent& dataMessageEvent)
+{
+    TakeInternal(1);
+    if (_taken.empty())
+    {
+        return false;
+    }
+    dataMessageEvent = ToDataMessageEvent(_taken.front());
+    return true;
+}
+
+auto DataSubscriber::TakeAll() -> std::vector<DataMessageEvent>
+{
+    TakeInternal((std::numeric_limits<size_t>::max)());
+
+    std::vector<DataMessageEvent> dataMessageEvents;
+    dataMessageEvents.reserve(_taken.size());
+    for (const auto& wireDataMessageEvent : _taken)
+    {
+        dataMessageEvents.push_back(ToDataMessageEvent(wireDataMessageEvent));
+    }
+    return dataMessageEvents;
+}
+
+void DataSubscriber::TakeInternal(size_t maxCount)
+{
+    std::unique_lock<decltype(_internalSubscribersMx)> lock(_internalSubscribersMx);
+    if (!_receiveQueueEnabled)
+    {
+        throw StateError{"DataSubscriber: The receive queue is not enabled"};
+    }
+
+    _taken.clear();
+    WireDataMessageEvent taken;
+    auto takeFrom = [this, maxCount, &taken](DataMessageReceiveQueue& receiveQueue) {
+        while (_taken.size() < maxCount && receiveQueue.TryPop(taken))
+        {
+            _taken.push_back(std::move(taken));
+        }
+    };
+
+    if (_receiveQueue)
+    {
+        takeFrom(*_receiveQueue);
+    }
+    for (auto& latestReceiveQueue : _latestReceiveQueues)
+    {
+        takeFrom(*latestReceiveQueue.second);
     }
 }
 
@@ -122,7 +245,13 @@ void DataSubscriber::RemoveInternalSubscriber(const std::string& pubUUID)
     auto internalSubscriber = _internalSubscribers.find(pubUUID);
     if (internalSubscriber != _internalSubscribers.end())
     {
-        _participant->GetServiceDiscovery()->NotifyServiceRemoved(internalSubscriber->second->GetServiceDescriptor());
+        // NB: The internal subscriber is shared with the other DataSubscribers of this participant on the same link
+        if (_participant->RemoveDataSubscriberInternalParent(internalSubscriber->second, this))
+        {
+            _participant->GetServiceDiscovery()->NotifyServiceRemoved(
+                internalSubscriber->second->GetServiceDescriptor());
+        }
+        _latestReceiveQueues.erase(internalSubscriber->second);
         _internalSubscribers.erase(pubUUID);
     }
 }
@@ -139,6 +268,26 @@ auto DataSubscriber::WrapTracingCallback(DataMessageHandler callback) -> SilKit:
     return tracingCallback;
 }
 
+auto DataSubscriber::WrapBatchTracingCallback(DataMessageBatchHandler callback) -> DataMessageBatchHandler
+{
+    if (!callback)
+    {
+        // Without a batch handler, the samples are delivered to the data message handler, which traces them
+        return {};
+    }
+
+    auto tracingCallback = [this, callback = std::move(callback)](IDataSubscriber* service,
+                                                                  const DataMessageBatchEvent& message) {
+        const auto now = _timeProvider->Now();
+        for (const auto& sample : message.data)
+        {
+            _tracer.Trace(TransmitDirection::RX, now, DataMessageEvent{message.timestamp, sample});
+        }
+        callback(service, message);
+    };
+    return tracingCallback;
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace SilKit
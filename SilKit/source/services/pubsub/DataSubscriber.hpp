@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <map>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -53,6 +54,10 @@ public:
 public: //methods
     void RegisterServiceDiscovery();
     void SetDataMessageHandler(DataMessageHandler callback) override;
+    void SetDataMessageBatchHandler(DataMessageBatchHandler callback) override;
+    void EnableReceiveQueue(size_t capacity, ReceiveQueueOverflowPolicy overflowPolicy) override;
+    bool TryTake(DataMessageEvent& dataMessageEvent) override;
+    auto TakeAll() -> std::vector<DataMessageEvent> override;
 
     // SilKit::Services::Orchestration::ITimeConsumer
     inline void SetTimeProvider(Services::Orchestration::ITimeProvider* provider) override;
@@ -71,6 +76,18 @@ public: //methods
         return _config;
     }
 
+    //For the DataSubscriberInternals of this subscriber
+    inline auto GetContentFilters() const -> const std::vector<DataContentFilter>&
+    {
+        return _contentFilters;
+    }
+
+    //For the DataSubscriberInternals created after the batch handler was set
+    auto GetDataMessageBatchHandler() const -> DataMessageBatchHandler;
+
+    //For the DataSubscriberInternals created after the receive queue was enabled
+    auto GetReceiveQueue(DataSubscriberInternal* internalSubscriber) -> std::shared_ptr<DataMessageReceiveQueue>;
+
 private: //methods
     void AddInternalSubscriber(const std::string& pubUUID, const std::string& joinedMediaType,
                                const std::vector<SilKit::Services::MatchingLabel>& publisherLabels);
@@ -78,19 +95,32 @@ private: //methods
     void RemoveInternalSubscriber(const std::string& pubUUID);
 
     DataMessageHandler WrapTracingCallback(DataMessageHandler callback);
+    DataMessageBatchHandler WrapBatchTracingCallback(DataMessageBatchHandler callback);
+
+    //! Moves at most maxCount queued messages to _taken
+    void TakeInternal(size_t maxCount);
 
 private: //members
     std::string _topic;
     std::string _mediaType;
     std::vector<SilKit::Services::MatchingLabel> _labels;
+    std::vector<DataContentFilter> _contentFilters;
     Tracer _tracer;
 
     DataMessageHandler _defaultDataHandler;
+    DataMessageBatchHandler _dataMessageBatchHandler;
 
     Core::ServiceDescriptor _serviceDescriptor{};
 
     std::unordered_map<std::string, DataSubscriberInternal*> _internalSubscribers;
 
+    bool _receiveQueueEnabled{false};
+    std::shared_ptr<DataMessageReceiveQueue> _receiveQueue;
+    // With KeepLatest, every publisher has its own receive queue which only holds its latest data
+    std::map<DataSubscriberInternal*, std::shared_ptr<DataMessageReceiveQueue>> _latestReceiveQueues;
+    // Keeps the data of the taken messages alive until the next take
+    std::vector<WireDataMessageEvent> _taken;
+
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
     Core::IParticipantInternal* _participant{nullptr};
 
@@ -22,6 +22,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "DataSubscriberInternal.hpp"
 #include "DataSubscriber.hpp"
 
+#include <algorithm>
+
 #include "silkit/services/logging/ILogger.hpp"
 
 namespace SilKit {
@@ -32,52 +34,212 @@ DataSubscriberInternal::DataSubscriberInternal(Core::IParticipantInternal* parti
                                                Services::Orchestration::ITimeProvider* timeProvider,
                                                const std::string& topic, const std::string& mediaType,
                                                const std::vector<SilKit::Services::MatchingLabel>& labels,
-                                               DataMessageHandler defaultHandler, IDataSubscriber* parent)
+                                               DataMessageHandler defaultHandler, IDataSubscriber* parent,
+                                               std::vector<DataContentFilter> contentFilters)
     : _topic{topic}
     , _mediaType{mediaType}
     , _labels{labels}
-    , _defaultHandler{std::move(defaultHandler)}
+    , _contentFilters{std::move(contentFilters)}
+    , _subscribers{std::make_shared<const Subscribers>()}
     , _parent{parent}
     , _timeProvider{timeProvider}
     , _participant{participant}
 {
-    (void)_participant;
+    AddSubscriber(parent, std::move(defaultHandler));
+}
 
-    if (_parent)
+void DataSubscriberInternal::AddSubscriber(IDataSubscriber* parent, DataMessageHandler handler)
+{
+    Subscriber subscriber;
+    subscriber.parent = parent;
+    subscriber.handler = std::move(handler);
+    auto* dataSubscriber = dynamic_cast<DataSubscriber*>(parent);
+    if (dataSubscriber)
     {
-        _replayConfig = dynamic_cast<DataSubscriber&>(*_parent).GetConfig().replay;
+        subscriber.replayConfig = dataSubscriber->GetConfig().replay;
+        subscriber.receiveQueue = dataSubscriber->GetReceiveQueue(this);
+        subscriber.batchHandler = dataSubscriber->GetDataMessageBatchHandler();
     }
+
+    ModifySubscribers([&subscriber](Subscribers& subscribers) { subscribers.push_back(std::move(subscriber)); });
+}
+
+bool DataSubscriberInternal::RemoveSubscriber(IDataSubscriber* parent)
+{
+    bool isEmpty{false};
+    ModifySubscribers([parent, &isEmpty](Subscribers& subscribers) {
+        subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+                                         [parent](const Subscriber& subscriber) { return subscriber.parent == parent; }),
+                          subscribers.end());
+        isEmpty = subscribers.empty();
+    });
+    return isEmpty;
 }
 
 void DataSubscriberInternal::SetDataMessageHandler(DataMessageHandler handler)
 {
-    _defaultHandler = std::move(handler);
+    SetDataMessageHandler(_parent, std::move(handler));
+}
+
+void DataSubscriberInternal::SetDataMessageHandler(IDataSubscriber* parent, DataMessageHandler handler)
+{
+    ModifySubscribers([parent, &handler](Subscribers& subscribers) {
+        for (auto& subscriber : subscribers)
+        {
+            if (subscriber.parent == parent)
+            {
+                subscriber.handler = handler;
+            }
+        }
+    });
+}
+
+void DataSubscriberInternal::SetDataMessageBatchHandler(IDataSubscriber* parent, DataMessageBatchHandler handler)
+{
+    ModifySubscribers([parent, &handler](Subscribers& subscribers) {
+        for (auto& subscriber : subscribers)
+        {
+            if (subscriber.parent == parent)
+            {
+                subscriber.batchHandler = handler;
+            }
+        }
+    });
+}
+
+void DataSubscriberInternal::SetReceiveQueue(IDataSubscriber* parent,
+                                             std::shared_ptr<DataMessageReceiveQueue> receiveQueue,
+                                             DataMessageHandler handler)
+{
+    ModifySubscribers([parent, &receiveQueue, &handler](Subscribers& subscribers) {
+        for (auto& subscriber : subscribers)
+        {
+            if (subscriber.parent == parent)
+            {
+                subscriber.receiveQueue = receiveQueue;
+                subscriber.handler = handler;
+            }
+        }
+    });
 }
 
 void DataSubscriberInternal::ReceiveMsg(const IServiceEndpoint* /*from*/, const WireDataMessageEvent& dataMessageEvent)
 {
-    if (Tracing::IsReplayEnabledFor(_replayConfig, Config::Replay::Direction::Receive))
+    ReceiveInternal(dataMessageEvent, false);
+}
+
+void DataSubscriberInternal::ReceiveInternal(const WireDataMessageEvent& dataMessageEvent, bool isReplay)
+{
+    // Publishers only filter per participant, and replayed or history data is not filtered at all
+    if (!MatchContentFilters(_contentFilters, dataMessageEvent.data.AsSpan()))
     {
         return;
     }
 
-    ReceiveInternal(dataMessageEvent);
+    const auto subscribers = GetSubscribers();
+    const auto dataMessageEventView = ToDataMessageEvent(dataMessageEvent);
+
+    for (const auto& subscriber : *subscribers)
+    {
+        // Subscribers replaying the receive direction only see the replayed messages
+        if (Tracing::IsReplayEnabledFor(subscriber.replayConfig, Config::Replay::Direction::Receive) != isReplay)
+        {
+            continue;
+        }
+
+        if (subscriber.receiveQueue)
+        {
+            // Only the handle of the received data is queued, the payload is not copied
+            subscriber.receiveQueue->Push(dataMessageEvent);
+        }
+
+        if (subscriber.handler)
+        {
+            subscriber.handler(subscriber.parent, dataMessageEventView);
+        }
+        else
+        {
+            _participant->GetLogger()->Warn("DataSubscriber on topic " + _topic
+                                            + " received data, but has no default handler assigned");
+        }
+    }
 }
 
-void DataSubscriberInternal::ReceiveInternal(const WireDataMessageEvent& dataMessageEvent)
+void DataSubscriberInternal::ReceiveMsg(const IServiceEndpoint* /*from*/, const WireDataMessageBatch& dataMessageBatch)
 {
-    if (_defaultHandler)
+    std::vector<Util::Span<const uint8_t>> samples;
+    try
     {
-        _defaultHandler(_parent, ToDataMessageEvent(dataMessageEvent));
+        for (const auto& sample : GetSamples(dataMessageBatch))
+        {
+            if (MatchContentFilters(_contentFilters, sample))
+            {
+                samples.push_back(sample);
+            }
+        }
+    }
+    catch (const SilKitError& error)
+    {
+        _participant->GetLogger()->Warn("DataSubscriber on topic " + _topic + " dropped a batch: " + error.what());
+        return;
+    }
+    if (samples.empty())
+    {
+        return;
     }
 
-    if (!_defaultHandler)
+    const auto subscribers = GetSubscribers();
+
+    for (const auto& subscriber : *subscribers)
     {
-        _participant->GetLogger()->Warn("DataSubscriber on topic " + _topic
-                                        + " received data, but has no default handler assigned");
+        // Batches are never replayed, the replay contains the individual samples
+        if (Tracing::IsReplayEnabledFor(subscriber.replayConfig, Config::Replay::Direction::Receive))
+        {
+            continue;
+        }
+
+        if (subscriber.receiveQueue)
+        {
+            // The queue holds the samples individually, therefore each one is copied out of the batch
+            for (const auto& sample : samples)
+            {
+                subscriber.receiveQueue->Push(WireDataMessageEvent{dataMessageBatch.timestamp, sample});
+            }
+        }
+        else if (subscriber.batchHandler)
+        {
+            subscriber.batchHandler(subscriber.parent, DataMessageBatchEvent{dataMessageBatch.timestamp, samples});
+            continue;
+        }
+
+        if (!subscriber.handler)
+        {
+            _participant->GetLogger()->Warn("DataSubscriber on topic " + _topic
+                                            + " received data, but has no default handler assigned");
+            continue;
+        }
+        for (const auto& sample : samples)
+        {
+            subscriber.handler(subscriber.parent, DataMessageEvent{dataMessageBatch.timestamp, sample});
+        }
     }
 }
 
+auto DataSubscriberInternal::GetSubscribers() const -> std::shared_ptr<const Subscribers>
+{
+    std::unique_lock<decltype(_subscribersMx)> lock{_subscribersMx};
+    return _subscribers;
+}
+
+template <typename ModifierT>
+void DataSubscriberInternal::ModifySubscribers(ModifierT modifier)
+{
+    std::unique_lock<decltype(_subscribersMx)> lock{_subscribersMx};
+    auto subscribers = std::make_shared<Subscribers>(*_subscribers);
+    modifier(*subscribers);
+    _subscribers = std::move(subscribers);
+}
+
 void DataSubscriberInternal::SetTimeProvider(Services::Orchestration::ITimeProvider* provider)
 {
     _timeProvider = provider;
@@ -89,12 +251,11 @@ void DataSubscriberInternal::ReplayMessage(const IReplayMessage* message)
     switch (message->GetDirection())
     {
     case SilKit::Services::TransmitDirection::RX:
-        if (IsReplayEnabledFor(_replayConfig, Config::Replay::Direction::Receive))
-        {
-            auto&& msg = dynamic_cast<const Services::PubSub::WireDataMessageEvent&>(*message);
-            ReceiveInternal(msg);
-        }
+    {
+        auto&& msg = dynamic_cast<const Services::PubSub::WireDataMessageEvent&>(*message);
+        ReceiveInternal(msg, true);
         break;
+    }
     case SilKit::Services::TransmitDirection::TX:
         //Ignore transmit messages
         break;
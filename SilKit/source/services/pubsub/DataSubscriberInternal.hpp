@@ -21,6 +21,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "ITimeConsumer.hpp"
 
 #include "IMsgForDataSubscriberInternal.hpp"
@@ -28,11 +32,18 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "DataMessageDatatypeUtils.hpp"
 #include "SynchronizedHandlers.hpp"
 #include "IReplayDataController.hpp"
+#include "SpscRingBuffer.hpp"
 
 namespace SilKit {
 namespace Services {
 namespace PubSub {
 
+using DataMessageReceiveQueue = Util::SpscRingBuffer<WireDataMessageEvent>;
+
+//! \brief Receives the data of one publisher and delivers it to the DataSubscribers of this participant that match it.
+//!
+//! There is only one receiving endpoint per publisher link and participant, regardless of the number of local
+//! DataSubscribers matching the publisher.
 class DataSubscriberInternal
     : public IMsgForDataSubscriberInternal
     , public Services::Orchestration::ITimeConsumer
@@ -43,13 +54,26 @@ public: //Ctor
     DataSubscriberInternal(Core::IParticipantInternal* participant,
                            Services::Orchestration::ITimeProvider* timeProvider, const std::string& topic,
                            const std::string& mediaType, const std::vector<SilKit::Services::MatchingLabel>& labels,
-                           DataMessageHandler defaultHandler, IDataSubscriber* parent);
+                           DataMessageHandler defaultHandler, IDataSubscriber* parent,
+                           std::vector<DataContentFilter> contentFilters = {});
 
 public: //Methods
+    //! \brief Delivers the received data to another DataSubscriber as well.
+    void AddSubscriber(IDataSubscriber* parent, DataMessageHandler handler);
+    //! \brief Stops delivering the received data to the DataSubscriber. Returns true if no DataSubscriber is left.
+    bool RemoveSubscriber(IDataSubscriber* parent);
+
+    //! \brief Replaces the handler of the DataSubscriber this internal subscriber was created for.
     void SetDataMessageHandler(DataMessageHandler handler);
+    void SetDataMessageHandler(IDataSubscriber* parent, DataMessageHandler handler);
+    void SetDataMessageBatchHandler(IDataSubscriber* parent, DataMessageBatchHandler handler);
+    //! \brief Puts the received data into the queue of the DataSubscriber, in addition to calling the handler.
+    void SetReceiveQueue(IDataSubscriber* parent, std::shared_ptr<DataMessageReceiveQueue> receiveQueue,
+                         DataMessageHandler handler);
 
     //! \brief Accepts messages originating from SilKit communications.
     void ReceiveMsg(const IServiceEndpoint* from, const WireDataMessageEvent& dataMessageEvent) override;
+    void ReceiveMsg(const IServiceEndpoint* from, const WireDataMessageBatch& dataMessageBatch) override;
 
     //SilKit::Services::Orchestration::ITimeConsumer
     void SetTimeProvider(Services::Orchestration::ITimeProvider* provider) override;
@@ -62,6 +86,10 @@ public: //Methods
     {
         return _labels;
     };
+    auto GetContentFilters() -> const std::vector<DataContentFilter>&
+    {
+        return _contentFilters;
+    };
 
     // IServiceEndpoint
     inline void SetServiceDescriptor(const Core::ServiceDescriptor& serviceDescriptor) override;
@@ -70,18 +98,37 @@ public: //Methods
     // IReplayDataProvider
     void ReplayMessage(const IReplayMessage* replayMessage) override;
 
+private: //Types
+    struct Subscriber
+    {
+        IDataSubscriber* parent{nullptr};
+        DataMessageHandler handler;
+        DataMessageBatchHandler batchHandler;
+        Config::Replay replayConfig;
+        std::shared_ptr<DataMessageReceiveQueue> receiveQueue;
+    };
+
+    using Subscribers = std::vector<Subscriber>;
+
 private: //Methods
-    void ReceiveInternal(const WireDataMessageEvent& dataMessageEvent);
+    void ReceiveInternal(const WireDataMessageEvent& dataMessageEvent, bool isReplay);
+
+    auto GetSubscribers() const -> std::shared_ptr<const Subscribers>;
+
+    //! Replaces the subscribers by a modified copy, the current subscribers may still be in use by ReceiveInternal
+    template <typename ModifierT>
+    void ModifySubscribers(ModifierT modifier);
 
 private: // Member
     std::string _topic;
     std::string _mediaType;
     std::vector<SilKit::Services::MatchingLabel> _labels;
-    DataMessageHandler _defaultHandler;
-
-    Config::Replay _replayConfig;
+    std::vector<DataContentFilter> _contentFilters;
 
+    mutable std::mutex _subscribersMx;
+    std::shared_ptr<const Subscribers> _subscribers;
     IDataSubscriber* _parent{nullptr};
+
     Core::ServiceDescriptor _serviceDescriptor{};
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
     Core::IParticipantInternal* _participant{nullptr};
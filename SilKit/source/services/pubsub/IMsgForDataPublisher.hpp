@@ -34,7 +34,7 @@ namespace PubSub {
 //! \brief IMsgForDataSubscriber interface used by the Participant
 class IMsgForDataPublisher
     : public Core::IReceiver<>
-    , public Core::ISender<WireDataMessageEvent>
+    , public Core::ISender<WireDataMessageEvent, WireDataMessageBatch>
 {
 };
 
@@ -33,7 +33,7 @@ namespace PubSub {
 
 //! \brief IMsgForDataSubscriber interface used by the Participant
 class IMsgForDataSubscriberInternal
-    : public Core::IReceiver<WireDataMessageEvent>
+    : public Core::IReceiver<WireDataMessageEvent, WireDataMessageBatch>
     , public Core::ISender<>
 {
 };
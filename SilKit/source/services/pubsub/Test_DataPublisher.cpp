@@ -27,6 +27,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "MockParticipant.hpp"
 
 #include "DataMessageDatatypeUtils.hpp"
+#include "ServiceConfigKeys.hpp"
 #include "silkit/services/pubsub/PubSubSpec.hpp"
 
 namespace {
@@ -45,6 +46,8 @@ class MockParticipant : public DummyParticipant
 {
 public:
     MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const WireDataMessageEvent&), (override));
+    MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const WireDataMessageBatch&), (override));
+    MOCK_METHOD(size_t, GetNumberOfRemoteReceivers, (const IServiceEndpoint*, const std::string&), (override));
 };
 
 SilKit::Services::PubSub::PubSubSpec testDataNodeSpec{"Topic", {}};
@@ -75,4 +78,146 @@ TEST_F(Test_DataPublisher, publish)
     publisher.Publish(sampleData);
 }
 
+TEST_F(Test_DataPublisher, publish_batch_sends_a_single_message)
+{
+    const std::vector<uint8_t> otherSampleData{8u, 9u};
+    const std::vector<Util::Span<const uint8_t>> samples{sampleData, otherSampleData};
+
+    ON_CALL(participant, GetNumberOfRemoteReceivers(&publisher, _)).WillByDefault(Return(2));
+    EXPECT_CALL(participant, SendMsg(&publisher, A<const WireDataMessageEvent&>())).Times(0);
+    EXPECT_CALL(participant, SendMsg(&publisher, MakeWireDataMessageBatch(0ns, samples))).Times(1);
+
+    publisher.PublishBatch(samples);
+}
+
+TEST_F(Test_DataPublisher, publish_batch_falls_back_to_single_messages_for_older_participants)
+{
+    const std::vector<uint8_t> otherSampleData{8u, 9u};
+    const std::vector<Util::Span<const uint8_t>> samples{sampleData, otherSampleData};
+
+    // One of the two receivers does not know batches
+    ON_CALL(participant, GetNumberOfRemoteReceivers(&publisher, "DATAMESSAGEEVENT")).WillByDefault(Return(2));
+    ON_CALL(participant, GetNumberOfRemoteReceivers(&publisher, "DATAMESSAGEBATCH")).WillByDefault(Return(1));
+    EXPECT_CALL(participant, SendMsg(&publisher, A<const WireDataMessageBatch&>())).Times(0);
+    {
+        InSequence sequence;
+        EXPECT_CALL(participant, SendMsg(&publisher, WireDataMessageEvent{0ns, sampleData})).Times(1);
+        EXPECT_CALL(participant, SendMsg(&publisher, WireDataMessageEvent{0ns, otherSampleData})).Times(1);
+    }
+
+    publisher.PublishBatch(samples);
+}
+
+TEST_F(Test_DataPublisher, publish_batch_throws_with_history_or_keep_latest)
+{
+    const std::vector<Util::Span<const uint8_t>> samples{sampleData};
+
+    Config::DataPublisher historyConfig;
+    historyConfig.history = 1;
+    DataPublisher historyPublisher{&participant, participant.GetTimeProvider(), testDataNodeSpec, "pubUUID-2",
+                                   historyConfig};
+
+    Config::DataPublisher keepLatestConfig;
+    keepLatestConfig.keepLatest = true;
+    DataPublisher keepLatestPublisher{&participant, participant.GetTimeProvider(), testDataNodeSpec, "pubUUID-3",
+                                      keepLatestConfig};
+
+    EXPECT_CALL(participant, SendMsg(_, A<const WireDataMessageEvent&>())).Times(0);
+    EXPECT_CALL(participant, SendMsg(_, A<const WireDataMessageBatch&>())).Times(0);
+
+    EXPECT_THROW(historyPublisher.PublishBatch(samples), SilKit::ConfigurationError);
+    EXPECT_THROW(keepLatestPublisher.PublishBatch(samples), SilKit::ConfigurationError);
+}
+
+TEST_F(Test_DataPublisher, commit_publishes_the_loaned_buffer_without_copying)
+{
+    const uint8_t* sentData{nullptr};
+    EXPECT_CALL(participant, SendMsg(&publisher, WireDataMessageEvent{0ns, sampleData}))
+        .WillOnce([&sentData](const IServiceEndpoint*, const WireDataMessageEvent& msg) {
+        sentData = msg.data.AsSpan().data();
+    });
+
+    auto loaned = publisher.Loan(sampleData.size());
+    ASSERT_EQ(loaned.size(), sampleData.size());
+    std::copy(sampleData.begin(), sampleData.end(), loaned.begin());
+    publisher.Commit();
+
+    EXPECT_EQ(sentData, loaned.data());
+}
+
+TEST_F(Test_DataPublisher, loaned_buffers_are_reused_after_sending)
+{
+    EXPECT_CALL(participant, SendMsg(&publisher, A<const WireDataMessageEvent&>())).Times(2);
+
+    auto first = publisher.Loan(sampleData.size());
+    publisher.Commit();
+    auto second = publisher.Loan(sampleData.size());
+    publisher.Commit();
+
+    EXPECT_EQ(first.data(), second.data());
+}
+
+TEST_F(Test_DataPublisher, commit_without_loan_throws)
+{
+    EXPECT_CALL(participant, SendMsg(&publisher, A<const WireDataMessageEvent&>())).Times(1);
+
+    EXPECT_THROW(publisher.Commit(), SilKit::StateError);
+
+    publisher.Loan(sampleData.size());
+    publisher.Commit();
+    EXPECT_THROW(publisher.Commit(), SilKit::StateError);
+}
+
+TEST_F(Test_DataPublisher, is_wanted_by_participants_with_a_subscriber_matching_the_data)
+{
+    Core::Discovery::ServiceDiscoveryHandler discoveryHandler;
+    EXPECT_CALL(participant.mockServiceDiscovery,
+                RegisterSpecificServiceDiscoveryHandler(_, Core::Discovery::controllerTypeDataSubscriberInternal,
+                                                        "pubUUID", _))
+        .WillOnce(SaveArg<0>(&discoveryHandler));
+    publisher.RegisterServiceDiscovery();
+
+    auto makeSubscriberInternal = [](const std::string& participantName, EndpointId serviceId,
+                                     const std::vector<DataContentFilter>& contentFilters) {
+        ServiceDescriptor descriptor{participantName, "pubUUID", "C1", serviceId};
+        descriptor.SetSupplementalDataItem(Core::Discovery::controllerType,
+                                           Core::Discovery::controllerTypeDataSubscriberInternal);
+        if (!contentFilters.empty())
+        {
+            descriptor.SetSupplementalDataItem(Core::Discovery::supplKeyDataSubscriberInternalContentFilters,
+                                               SerializeContentFilters(contentFilters));
+        }
+        return descriptor;
+    };
+    const auto filteringA = makeSubscriberInternal("A", 1, {{0, {1u}, {}}});
+    const auto filteringB = makeSubscriberInternal("B", 2, {{0, {2u}, {}}});
+    const auto unfilteredB = makeSubscriberInternal("B", 3, {});
+
+    discoveryHandler(Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated, filteringA);
+    discoveryHandler(Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated, filteringB);
+
+    const WireDataMessageEvent msg1{0ns, {1u, 0u}};
+    const WireDataMessageEvent msg2{0ns, {2u, 0u}};
+    EXPECT_TRUE(publisher.IsWantedBy("A", msg1));
+    EXPECT_FALSE(publisher.IsWantedBy("A", msg2));
+    EXPECT_FALSE(publisher.IsWantedBy("B", msg1));
+    EXPECT_TRUE(publisher.IsWantedBy("B", msg2));
+    // A batch is wanted if any of its samples is
+    const std::vector<Util::Span<const uint8_t>> samples{msg1.data.AsSpan(), msg2.data.AsSpan()};
+    EXPECT_TRUE(publisher.IsWantedBy("A", MakeWireDataMessageBatch(0ns, samples)));
+    EXPECT_TRUE(publisher.IsWantedBy("B", MakeWireDataMessageBatch(0ns, samples)));
+    EXPECT_FALSE(publisher.IsWantedBy("B", MakeWireDataMessageBatch(0ns, {samples.data(), 1})));
+    // The subscribers of other participants are not known yet
+    EXPECT_TRUE(publisher.IsWantedBy("C", msg1));
+
+    // Any subscriber of the participant that accepts the data suffices
+    discoveryHandler(Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated, unfilteredB);
+    EXPECT_TRUE(publisher.IsWantedBy("B", msg1));
+    discoveryHandler(Core::Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved, unfilteredB);
+    EXPECT_FALSE(publisher.IsWantedBy("B", msg1));
+
+    discoveryHandler(Core::Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved, filteringA);
+    EXPECT_TRUE(publisher.IsWantedBy("A", msg2));
+}
+
 } // anonymous namespace
@@ -53,3 +53,22 @@ TEST(Test_DataSerdes, SimData_LargeDataMessage)
 
     EXPECT_EQ(in, out);
 }
+
+TEST(Test_DataSerdes, SimData_DataMessageBatch)
+{
+    using namespace SilKit::Services::PubSub;
+    using namespace SilKit::Core;
+
+    SilKit::Core::MessageBuffer buffer;
+    WireDataMessageBatch in, out;
+    in.timestamp = 0xabcdefns;
+    in.data = {1, 2, 3, 4, 5};
+    in.sampleSizes = {3, 0, 2};
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+
+    EXPECT_EQ(out.timestamp, in.timestamp);
+    EXPECT_TRUE(SilKit::Util::ItemsAreEqual(out.data, in.data));
+    EXPECT_EQ(out.sampleSizes, in.sampleSizes);
+}
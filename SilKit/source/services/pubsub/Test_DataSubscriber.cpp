@@ -124,4 +124,52 @@ struct CreateSubscriberInternalMock
     }
 };
 
+TEST_F(Test_DataSubscriber, keep_latest_receive_queue_holds_the_latest_data_of_each_publisher)
+{
+    Config::DataSubscriber config;
+    config.keepLatest = true;
+    DataSubscriber keepLatestSubscriber{&participant, config, participant.GetTimeProvider(), matchingDataSpec, {}};
+    keepLatestSubscriber.SetServiceDescriptor(subscriberDescriptor);
+
+    Core::Discovery::ServiceDiscoveryHandler discoveryHandler;
+    EXPECT_CALL(participant.mockServiceDiscovery, RegisterSpecificServiceDiscoveryHandler(_, _, _, _))
+        .WillOnce(SaveArg<0>(&discoveryHandler));
+    keepLatestSubscriber.RegisterServiceDiscovery();
+
+    CreateSubscriberInternalMock createInternalA{&participant, {}};
+    CreateSubscriberInternalMock createInternalB{&participant, {}};
+    EXPECT_CALL(participant, CreateDataSubscriberInternal(_, _, _, _, _, _))
+        .WillOnce([&createInternalA](auto&&... args) { return createInternalA(args...); })
+        .WillOnce([&createInternalB](auto&&... args) { return createInternalB(args...); });
+
+    keepLatestSubscriber.EnableReceiveQueue(16, ReceiveQueueOverflowPolicy::DropNewest);
+
+    auto publisher2Descriptor = publisherDescriptor;
+    publisher2Descriptor.SetSupplementalDataItem(Core::Discovery::supplKeyDataPublisherPubUUID, publisher2Uuid);
+    discoveryHandler(Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated, publisherDescriptor);
+    discoveryHandler(Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated, publisher2Descriptor);
+    ASSERT_TRUE(createInternalA.dataSubscriberInternal);
+    ASSERT_TRUE(createInternalB.dataSubscriberInternal);
+
+    for (uint8_t value = 0; value < 3; ++value)
+    {
+        createInternalA.dataSubscriberInternal->ReceiveMsg(&publisher, WireDataMessageEvent{1ns, {10u, value}});
+        createInternalB.dataSubscriberInternal->ReceiveMsg(&publisher, WireDataMessageEvent{1ns, {20u, value}});
+    }
+
+    auto dataMessageEvents = keepLatestSubscriber.TakeAll();
+    std::vector<std::vector<uint8_t>> takenData;
+    for (const auto& dataMessageEvent : dataMessageEvents)
+    {
+        takenData.push_back(SilKit::Util::ToStdVector(dataMessageEvent.data));
+    }
+    EXPECT_THAT(takenData, UnorderedElementsAre(std::vector<uint8_t>{10u, 2u}, std::vector<uint8_t>{20u, 2u}));
+
+    DataMessageEvent dataMessageEvent;
+    EXPECT_FALSE(keepLatestSubscriber.TryTake(dataMessageEvent));
+    createInternalB.dataSubscriberInternal->ReceiveMsg(&publisher, WireDataMessageEvent{1ns, {20u, 3u}});
+    ASSERT_TRUE(keepLatestSubscriber.TryTake(dataMessageEvent));
+    EXPECT_EQ(SilKit::Util::ToStdVector(dataMessageEvent.data), (std::vector<uint8_t>{20u, 3u}));
+}
+
 } // anonymous namespace
@@ -21,6 +21,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "DataSubscriberInternal.hpp"
 
+#include "silkit/services/pubsub/IDataSubscriber.hpp"
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -40,6 +42,16 @@ using namespace SilKit;
 using namespace SilKit::Core;
 using namespace SilKit::Services::PubSub;
 
+class MockDataSubscriber : public IDataSubscriber
+{
+public:
+    MOCK_METHOD(void, SetDataMessageHandler, (DataMessageHandler), (override));
+    MOCK_METHOD(void, SetDataMessageBatchHandler, (DataMessageBatchHandler), (override));
+    MOCK_METHOD(void, EnableReceiveQueue, (size_t, ReceiveQueueOverflowPolicy), (override));
+    MOCK_METHOD(bool, TryTake, (DataMessageEvent&), (override));
+    MOCK_METHOD(std::vector<DataMessageEvent>, TakeAll, (), (override));
+};
+
 class Test_DataSubscriberInternal : public ::testing::Test
 {
 protected:
@@ -79,4 +91,159 @@ TEST_F(Test_DataSubscriberInternal, trigger_default_data_handler)
 
     subscriber.ReceiveMsg(&subscriberOther, msg);
 }
+
+TEST_F(Test_DataSubscriberInternal, delivers_data_to_all_added_subscribers)
+{
+    const WireDataMessageEvent msg{0ns, {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u}};
+
+    MockDataSubscriber parentA;
+    MockDataSubscriber parentB;
+    DataSubscriberInternal internalSubscriber{
+        &participant, participant.GetTimeProvider(), "Topic", {}, {},
+        SilKit::Util::bind_method(&callbacks, &Callbacks::ReceiveDataDefault), &parentA};
+    internalSubscriber.AddSubscriber(&parentB, SilKit::Util::bind_method(&callbacks, &Callbacks::ReceiveDataExplicit));
+
+    EXPECT_CALL(callbacks, ReceiveDataDefault(&parentA, ToDataMessageEvent(msg))).Times(1);
+    EXPECT_CALL(callbacks, ReceiveDataExplicit(&parentB, ToDataMessageEvent(msg))).Times(1);
+    internalSubscriber.ReceiveMsg(&subscriberOther, msg);
+
+    // Replacing the handler of one subscriber does not affect the other one
+    internalSubscriber.SetDataMessageHandler(&parentA,
+                                             SilKit::Util::bind_method(&callbacks, &Callbacks::ReceiveDataExplicit));
+    EXPECT_CALL(callbacks, ReceiveDataExplicit(&parentA, ToDataMessageEvent(msg))).Times(1);
+    EXPECT_CALL(callbacks, ReceiveDataExplicit(&parentB, ToDataMessageEvent(msg))).Times(1);
+    internalSubscriber.ReceiveMsg(&subscriberOther, msg);
+
+    EXPECT_FALSE(internalSubscriber.RemoveSubscriber(&parentA));
+    EXPECT_CALL(callbacks, ReceiveDataExplicit(&parentB, ToDataMessageEvent(msg))).Times(1);
+    internalSubscriber.ReceiveMsg(&subscriberOther, msg);
+
+    EXPECT_TRUE(internalSubscriber.RemoveSubscriber(&parentB));
+    internalSubscriber.ReceiveMsg(&subscriberOther, msg);
+}
+
+TEST_F(Test_DataSubscriberInternal, receive_queue_holds_the_received_data_without_copying_it)
+{
+    const WireDataMessageEvent msg{1ns, {0u, 1u, 2u, 3u}};
+
+    MockDataSubscriber parent;
+    DataSubscriberInternal internalSubscriber{
+        &participant, participant.GetTimeProvider(), "Topic", {}, {},
+        SilKit::Util::bind_method(&callbacks, &Callbacks::ReceiveDataDefault), &parent};
+
+    auto receiveQueue = std::make_shared<DataMessageReceiveQueue>(2, DataMessageReceiveQueue::OverflowPolicy::DropOldest);
+    internalSubscriber.SetReceiveQueue(&parent, receiveQueue, {});
+
+    EXPECT_CALL(callbacks, ReceiveDataDefault(_, _)).Times(0);
+    internalSubscriber.ReceiveMsg(&subscriberOther, msg);
+
+    WireDataMessageEvent taken;
+    ASSERT_TRUE(receiveQueue->TryPop(taken));
+    EXPECT_EQ(taken.timestamp, msg.timestamp);
+    EXPECT_EQ(taken.data.AsSpan().data(), msg.data.AsSpan().data());
+    EXPECT_FALSE(receiveQueue->TryPop(taken));
+}
+TEST_F(Test_DataSubscriberInternal, only_delivers_data_matching_the_content_filters)
+{
+    const WireDataMessageEvent matchingMsg{0ns, {1u, 2u, 3u}};
+    const WireDataMessageEvent otherMsg{0ns, {2u, 2u, 3u}};
+
+    DataSubscriberInternal filteringSubscriber{&participant,
+                                               participant.GetTimeProvider(),
+                                               "Topic",
+                                               {},
+                                               {},
+                                               SilKit::Util::bind_method(&callbacks, &Callbacks::ReceiveDataDefault),
+                                               nullptr,
+                                               {{0, {1u}, {}}}};
+
+    EXPECT_CALL(callbacks, ReceiveDataDefault(nullptr, ToDataMessageEvent(matchingMsg))).Times(1);
+    EXPECT_CALL(callbacks, ReceiveDataDefault(nullptr, ToDataMessageEvent(otherMsg))).Times(0);
+    filteringSubscriber.ReceiveMsg(&subscriberOther, matchingMsg);
+    filteringSubscriber.ReceiveMsg(&subscriberOther, otherMsg);
+}
+
+TEST_F(Test_DataSubscriberInternal, delivers_the_samples_of_a_batch_one_by_one)
+{
+    const std::vector<uint8_t> matchingSample{1u, 2u, 3u};
+    const std::vector<uint8_t> otherSample{2u, 2u, 3u};
+    const std::vector<uint8_t> emptySample{};
+    const std::vector<Util::Span<const uint8_t>> samples{matchingSample, otherSample, matchingSample};
+
+    DataSubscriberInternal filteringSubscriber{&participant,
+                                               participant.GetTimeProvider(),
+                                               "Topic",
+                                               {},
+                                               {},
+                                               SilKit::Util::bind_method(&callbacks, &Callbacks::ReceiveDataDefault),
+                                               nullptr,
+                                               {{0, {1u}, {}}}};
+
+    const DataMessageEvent matchingEvent{2ns, matchingSample};
+    EXPECT_CALL(callbacks, ReceiveDataDefault(nullptr, matchingEvent)).Times(2);
+    EXPECT_CALL(callbacks, ReceiveDataDefault(nullptr, DataMessageEvent{2ns, otherSample})).Times(0);
+    filteringSubscriber.ReceiveMsg(&subscriberOther, MakeWireDataMessageBatch(2ns, samples));
+
+    // Without content filters, empty samples are delivered as well
+    const std::vector<Util::Span<const uint8_t>> emptySamples{emptySample, emptySample};
+    EXPECT_CALL(callbacks, ReceiveDataDefault(nullptr, DataMessageEvent{2ns, emptySample})).Times(2);
+    subscriber.ReceiveMsg(&subscriberOther, MakeWireDataMessageBatch(2ns, emptySamples));
+}
+
+TEST_F(Test_DataSubscriberInternal, batch_handler_receives_the_whole_batch)
+{
+    const std::vector<uint8_t> sample1{1u, 2u, 3u};
+    const std::vector<uint8_t> sample2{4u};
+    const auto batch = MakeWireDataMessageBatch(3ns, std::vector<Util::Span<const uint8_t>>{sample1, sample2});
+    const WireDataMessageEvent msg{0ns, {5u}};
+
+    std::vector<std::vector<uint8_t>> received;
+    subscriber.SetDataMessageBatchHandler(nullptr, [&received](IDataSubscriber*, const DataMessageBatchEvent& event) {
+        EXPECT_EQ(event.timestamp, 3ns);
+        for (const auto& sample : event.data)
+        {
+            received.emplace_back(sample.begin(), sample.end());
+        }
+    });
+
+    EXPECT_CALL(callbacks, ReceiveDataDefault(nullptr, _)).Times(0);
+    subscriber.ReceiveMsg(&subscriberOther, batch);
+    EXPECT_EQ(received, (std::vector<std::vector<uint8_t>>{sample1, sample2}));
+
+    // Individually published data is still delivered to the data message handler
+    EXPECT_CALL(callbacks, ReceiveDataDefault(nullptr, ToDataMessageEvent(msg))).Times(1);
+    subscriber.ReceiveMsg(&subscriberOther, msg);
+}
+
+TEST_F(Test_DataSubscriberInternal, receive_queue_holds_the_samples_of_a_batch_individually)
+{
+    const std::vector<uint8_t> sample1{1u, 2u, 3u};
+    const std::vector<uint8_t> sample2{4u};
+    const auto batch = MakeWireDataMessageBatch(3ns, std::vector<Util::Span<const uint8_t>>{sample1, sample2});
+
+    MockDataSubscriber parent;
+    DataSubscriberInternal internalSubscriber{
+        &participant, participant.GetTimeProvider(), "Topic", {}, {},
+        SilKit::Util::bind_method(&callbacks, &Callbacks::ReceiveDataDefault), &parent};
+
+    auto receiveQueue =
+        std::make_shared<DataMessageReceiveQueue>(4, DataMessageReceiveQueue::OverflowPolicy::DropOldest);
+    internalSubscriber.SetReceiveQueue(&parent, receiveQueue, {});
+    // The batch handler is not used with the receive queue
+    internalSubscriber.SetDataMessageBatchHandler(&parent, [](IDataSubscriber*, const DataMessageBatchEvent&) {
+        FAIL() << "The batch handler must not be called";
+    });
+
+    EXPECT_CALL(callbacks, ReceiveDataDefault(_, _)).Times(0);
+    internalSubscriber.ReceiveMsg(&subscriberOther, batch);
+
+    WireDataMessageEvent taken;
+    ASSERT_TRUE(receiveQueue->TryPop(taken));
+    EXPECT_EQ(taken, (WireDataMessageEvent{3ns, sample1}));
+    EXPECT_EQ(taken.timestamp, 3ns);
+    ASSERT_TRUE(receiveQueue->TryPop(taken));
+    EXPECT_EQ(taken, (WireDataMessageEvent{3ns, sample2}));
+    EXPECT_FALSE(receiveQueue->TryPop(taken));
+}
+
 } // anonymous namespace
@@ -79,4 +79,61 @@ TEST_F(Test_PubSubMatching, match_mediatype)
     EXPECT_EQ(MatchMediaType(mediaTypeSub, mediaTypePub), false); // Empty publisher mediaType != wildcard, no match
 }
 
+TEST_F(Test_PubSubMatching, add_content_filters)
+{
+    PubSubSpec spec{"topic", "mediatype"};
+    EXPECT_TRUE(spec.ContentFilters().empty());
+
+    EXPECT_THROW(spec.AddContentFilter({0, {1, 2}, {0xff}}), SilKit::ConfigurationError);
+
+    spec.AddContentFilter({2, {1, 2}, {}});
+    spec.AddContentFilter({0, {1, 2}, {0xff, 0x0f}});
+    ASSERT_EQ(spec.ContentFilters().size(), 2u);
+    EXPECT_EQ(spec.ContentFilters()[0].offset, 2u);
+    EXPECT_EQ(spec.ContentFilters()[1].mask, (std::vector<uint8_t>{0xff, 0x0f}));
+}
+
+TEST_F(Test_PubSubMatching, match_content_filters)
+{
+    const std::vector<uint8_t> data{0x10, 0x2a, 0x33, 0x44};
+
+    EXPECT_TRUE(MatchContentFilters({}, data)); // No filters, match
+
+    EXPECT_TRUE(MatchContentFilters({{0, {0x10, 0x2a}, {}}}, data)); // Prefix, match
+    EXPECT_FALSE(MatchContentFilters({{0, {0x10, 0x2b}, {}}}, data)); // Different prefix, no match
+    EXPECT_TRUE(MatchContentFilters({{2, {0x33, 0x44}, {}}}, data)); // At the end, match
+    EXPECT_FALSE(MatchContentFilters({{3, {0x44, 0x00}, {}}}, data)); // Beyond the end, no match
+    EXPECT_FALSE(MatchContentFilters({{5, {}, {}}}, data)); // Offset beyond the end, no match
+
+    EXPECT_TRUE(MatchContentFilters({{1, {0x0a}, {0x0f}}}, data)); // Masked bits equal, match
+    EXPECT_FALSE(MatchContentFilters({{1, {0x0a}, {0xff}}}, data)); // Masked bits differ, no match
+
+    // All filters must match
+    EXPECT_TRUE(MatchContentFilters({{0, {0x10}, {}}, {3, {0x44}, {}}}, data));
+    EXPECT_FALSE(MatchContentFilters({{0, {0x10}, {}}, {3, {0x45}, {}}}, data));
+}
+
+TEST_F(Test_PubSubMatching, serialize_content_filters)
+{
+    const std::vector<DataContentFilter> contentFilters{{0, {0x01, 0xab}, {}}, {17, {0xff}, {0x0f}}};
+
+    const auto serialized = SerializeContentFilters(contentFilters);
+    EXPECT_EQ(serialized, "0:01ab:;17:ff:0f");
+
+    const auto deserialized = DeserializeContentFilters(serialized);
+    ASSERT_EQ(deserialized.size(), contentFilters.size());
+    for (size_t i = 0; i < contentFilters.size(); ++i)
+    {
+        EXPECT_EQ(deserialized[i].offset, contentFilters[i].offset);
+        EXPECT_EQ(deserialized[i].value, contentFilters[i].value);
+        EXPECT_EQ(deserialized[i].mask, contentFilters[i].mask);
+    }
+
+    EXPECT_TRUE(DeserializeContentFilters("").empty());
+    EXPECT_THROW(DeserializeContentFilters("0:01"), SilKit::SilKitError);
+    EXPECT_THROW(DeserializeContentFilters("x:01:"), SilKit::SilKitError);
+    EXPECT_THROW(DeserializeContentFilters("0:0g:"), SilKit::SilKitError);
+    EXPECT_THROW(DeserializeContentFilters("0:0102:ff"), SilKit::SilKitError);
+}
+
 } // anonymous namespace
@@ -32,8 +32,8 @@ namespace Rpc {
 
 //! \brief IMsgForRpcServer interface used by the Participant
 class IMsgForRpcServerInternal
-    : public Core::IReceiver<FunctionCall>
-    , public Core::ISender<FunctionCallResponse>
+    : public Core::IReceiver<FunctionCall, FunctionCallBatch>
+    , public Core::ISender<FunctionCallResponse, FunctionCallResponseBatch>
 {
 public:
     virtual ~IMsgForRpcServerInternal() noexcept = default;
@@ -19,6 +19,9 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <algorithm>
+#include <memory>
+
 #include "silkit/services/logging/ILogger.hpp"
 
 #include "RpcClient.hpp"
@@ -26,6 +29,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IParticipantInternal.hpp"
 #include "RpcDatatypeUtils.hpp"
 #include "Uuid.hpp"
+#include "traits/SilKitMsgTraits.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -50,21 +54,23 @@ auto ToRpcCallStatus(const FunctionCallResponse::Status status) -> RpcCallStatus
 
 RpcClient::RpcClient(Core::IParticipantInternal* participant, Services::Orchestration::ITimeProvider* timeProvider,
                      const SilKit::Services::Rpc::RpcSpec& dataSpec, const std::string& clientUUID,
-                     RpcCallResultHandler handler)
+                     RpcCallResultHandler handler, Config::RpcClient::DispatchMode dispatchMode)
     : _dataSpec{dataSpec}
     , _clientUUID{clientUUID}
     , _handler{std::move(handler)}
     , _logger{participant->GetLogger()}
     , _timeProvider{timeProvider}
     , _participant{participant}
+    , _dispatchMode{dispatchMode}
+    , _callIdBase{Util::Uuid::GenerateRandom().ab}
 {
 }
 
 RpcClient::~RpcClient()
 {
-    if (_isTimeoutHandlerSet)
+    if (_timeoutHandlerId.has_value())
     {
-        _timeProvider->RemoveNextSimStepHandler(_timeoutHandlerId);
+        _timeProvider->RemoveNextSimStepHandler(_timeoutHandlerId.value());
     }
 }
 
@@ -87,10 +93,12 @@ void RpcClient::RegisterServiceDiscovery()
         {
             if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated)
             {
+                AddServerTarget(serviceDescriptor.GetParticipantName());
                 _numCounterparts++;
             }
             else if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved)
             {
+                RemoveServerTarget(serviceDescriptor.GetParticipantName());
                 _numCounterparts--;
             }
         }
@@ -101,6 +109,83 @@ void RpcClient::RegisterServiceDiscovery()
         matchHandler, Core::Discovery::controllerTypeRpcServerInternal, _clientUUID, _dataSpec.Labels());
 }
 
+void RpcClient::AddServerTarget(const std::string& participantName)
+{
+    std::unique_lock<decltype(_serverTargetsMx)> lock{_serverTargetsMx};
+
+    auto it = std::find_if(_serverTargets.begin(), _serverTargets.end(), [&participantName](const ServerTarget& target) {
+        return target.participantName == participantName;
+    });
+    if (it == _serverTargets.end())
+    {
+        it = _serverTargets.insert(_serverTargets.end(), ServerTarget{participantName, 0, 0});
+    }
+    ++it->numServers;
+}
+
+void RpcClient::RemoveServerTarget(const std::string& participantName)
+{
+    std::unique_lock<decltype(_serverTargetsMx)> lock{_serverTargetsMx};
+
+    auto it = std::find_if(_serverTargets.begin(), _serverTargets.end(), [&participantName](const ServerTarget& target) {
+        return target.participantName == participantName;
+    });
+    if (it != _serverTargets.end() && --it->numServers == 0)
+    {
+        _serverTargets.erase(it);
+    }
+}
+
+bool RpcClient::SelectServerTarget(std::string& participantName, uint32_t& numServers)
+{
+    std::unique_lock<decltype(_serverTargetsMx)> lock{_serverTargetsMx};
+
+    if (_serverTargets.empty())
+    {
+        return false;
+    }
+
+    auto index = _nextServerTarget % _serverTargets.size();
+    if (_dispatchMode == Config::RpcClient::DispatchMode::LeastOutstandingCalls)
+    {
+        // NB: Starting the search at the next target in turn spreads the calls evenly if several targets are idle
+        for (size_t i = 1; i < _serverTargets.size(); ++i)
+        {
+            const auto candidate = (_nextServerTarget + i) % _serverTargets.size();
+            if (_serverTargets[candidate].numOutstandingCalls < _serverTargets[index].numOutstandingCalls)
+            {
+                index = candidate;
+            }
+        }
+    }
+    _nextServerTarget = index + 1;
+
+    auto& target = _serverTargets[index];
+    ++target.numOutstandingCalls;
+    participantName = target.participantName;
+    numServers = target.numServers;
+    return true;
+}
+
+void RpcClient::OnCallFinished(const std::string& targetParticipantName)
+{
+    if (targetParticipantName.empty())
+    {
+        return;
+    }
+
+    std::unique_lock<decltype(_serverTargetsMx)> lock{_serverTargetsMx};
+
+    auto it = std::find_if(_serverTargets.begin(), _serverTargets.end(),
+                           [&targetParticipantName](const ServerTarget& target) {
+        return target.participantName == targetParticipantName;
+    });
+    if (it != _serverTargets.end() && it->numOutstandingCalls > 0)
+    {
+        --it->numOutstandingCalls;
+    }
+}
+
 void RpcClient::Call(Util::Span<const uint8_t> data, void* userContext)
 {
     TriggerCall(std::move(data), false, {}, userContext);
@@ -111,92 +196,293 @@ void RpcClient::CallWithTimeout(Util::Span<const uint8_t> data, std::chrono::nan
     TriggerCall(std::move(data), true, timeout, userContext);
 }
 
-
-void RpcClient::TimeHandler(std::chrono::nanoseconds now, std::chrono::nanoseconds duration)
+void RpcClient::CallBatch(Util::Span<const Util::Span<const uint8_t>> data, Util::Span<void* const> userContexts)
 {
-    std::vector<TimeoutEntry> timeoutedEntries;
-
+    if (!userContexts.empty() && userContexts.size() != data.size())
     {
-        std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
+        throw SilKit::SilKitError{"RpcClient::CallBatch: The number of user contexts must match the number of calls"};
+    }
 
-        for (auto it = _timeoutEntries.begin(); it != _timeoutEntries.end();)
+    auto getUserContext = [&userContexts](size_t i) -> void* {
+        return userContexts.empty() ? nullptr : userContexts[i];
+    };
+
+    if (_dispatchMode == Config::RpcClient::DispatchMode::Broadcast)
+    {
+        const auto numReturns = static_cast<uint32_t>(_numCounterparts);
+        if (numReturns == 0 || !CanBroadcastBatches())
         {
-            it->timeLeft -= duration;
-            if (it->timeLeft <= static_cast<std::chrono::nanoseconds>(0))
+            // NB: Participants of older versions would silently drop the batch, therefore the calls are sent one by one
+            for (size_t i = 0; i < data.size(); ++i)
             {
-                timeoutedEntries.insert(timeoutedEntries.end(), std::make_move_iterator(it),
-                                        std::make_move_iterator(it + 1));
-                it = _timeoutEntries.erase(it);
-            }
-            else
-            {
-                ++it;
+                TriggerCall(data[i], false, {}, getUserContext(i));
             }
+            return;
         }
+
+        FunctionCallBatch batch;
+        batch.calls.reserve(data.size());
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            batch.calls.emplace_back(MakeCall(data[i], false, {}, getUserContext(i), numReturns, {}));
+        }
+
+        _participant->SendMsg(this, std::move(batch));
+        return;
     }
 
-    for (auto&& entry : timeoutedEntries)
+    // Each call is dispatched on its own, and the calls of each target participant are sent as one batch
+    const auto batchReceivers = _participant->GetParticipantNamesOfRemoteReceivers(
+        this, Core::SilKitMsgTraits<FunctionCallBatch>::SerdesName());
+    std::vector<std::pair<std::string, FunctionCallBatch>> batches;
+
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        std::string targetParticipantName;
+        uint32_t numReturns{0};
+        if (!SelectServerTarget(targetParticipantName, numReturns))
+        {
+            NotifyServerNotReachable(getUserContext(i));
+            continue;
+        }
+
+        auto msg = MakeCall(data[i], false, {}, getUserContext(i), numReturns, targetParticipantName);
+
+        const auto isBatchReceiver =
+            targetParticipantName == _participant->GetParticipantName()
+            || std::find(batchReceivers.begin(), batchReceivers.end(), targetParticipantName) != batchReceivers.end();
+        if (!isBatchReceiver)
+        {
+            _participant->SendMsg(this, targetParticipantName, std::move(msg));
+            continue;
+        }
+
+        auto it = std::find_if(batches.begin(), batches.end(),
+                               [&targetParticipantName](const std::pair<std::string, FunctionCallBatch>& batch) {
+            return batch.first == targetParticipantName;
+        });
+        if (it == batches.end())
+        {
+            it = batches.insert(batches.end(), std::make_pair(targetParticipantName, FunctionCallBatch{}));
+        }
+        it->second.calls.emplace_back(std::move(msg));
+    }
+
+    for (auto& batch : batches)
+    {
+        _participant->SendMsg(this, batch.first, std::move(batch.second));
+    }
+}
+
+bool RpcClient::CanBroadcastBatches()
+{
+    const auto numCallReceivers =
+        _participant->GetNumberOfRemoteReceivers(this, Core::SilKitMsgTraits<FunctionCall>::SerdesName());
+    const auto numBatchReceivers =
+        _participant->GetNumberOfRemoteReceivers(this, Core::SilKitMsgTraits<FunctionCallBatch>::SerdesName());
+    return numBatchReceivers >= numCallReceivers;
+}
+
+
+void RpcClient::TimeHandler(const Util::Optional<Services::HandlerId>& handlerId, std::chrono::nanoseconds now,
+                            std::chrono::nanoseconds duration)
+{
+    std::vector<Util::Uuid> timedOutCalls;
+    bool isTimeoutQueueEmpty{false};
+
     {
-        auto uuid = entry.callUuid;
+        std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
+
+        // NB: Ignore a handler which is not installed yet, or which is about to be removed
+        if (!handlerId.has_value() || handlerId != _timeoutHandlerId)
+        {
+            return;
+        }
 
+        _timeoutClock += duration;
+
+        // the entries are ordered by their expiry, i.e., only the calls that time out in this step are visited
+        const auto expiredEnd = _timeoutEntries.upper_bound(_timeoutClock);
+        for (auto it = _timeoutEntries.begin(); it != expiredEnd; ++it)
+        {
+            timedOutCalls.push_back(it->second);
+        }
+        _timeoutEntries.erase(_timeoutEntries.begin(), expiredEnd);
+
+        isTimeoutQueueEmpty = _timeoutEntries.empty();
+    }
+
+    for (const auto& uuid : timedOutCalls)
+    {
         std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
         auto it = _activeCalls.find(uuid);
-        auto userContext = it->second.GetUserContext();
 
         if (it != _activeCalls.end())
         {
+            auto userContext = it->second.GetUserContext();
+            auto targetParticipantName = it->second.GetTargetParticipantName();
             _activeCalls.erase(it);
             lock.unlock();
 
-            _handler(this, RpcCallResultEvent{now, userContext, RpcCallStatus::Timeout, {}});
+            OnCallFinished(targetParticipantName);
+
+            if (_handler)
+            {
+                _handler(this, RpcCallResultEvent{now, userContext, RpcCallStatus::Timeout, {}});
+            }
         }
     }
-    timeoutedEntries.clear();
+
+    if (isTimeoutQueueEmpty)
+    {
+        // NB: The handler is currently being invoked by the time provider, which does not allow removing it here
+        _participant->ExecuteDeferred([this] { RemoveTimeoutHandlerIfIdle(); });
+    }
 }
 
+void RpcClient::EraseTimeoutEntry(std::chrono::nanoseconds expiry, const Util::Uuid& callUuid)
+{
+    std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
 
-void RpcClient::TriggerCall(Util::Span<const uint8_t> data, bool hasTimeout, std::chrono::nanoseconds timeout,
-                            void* userContext)
+    const auto range = _timeoutEntries.equal_range(expiry);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == callUuid)
+        {
+            _timeoutEntries.erase(it);
+            break;
+        }
+    }
+}
+
+void RpcClient::AddTimeoutHandlerIfMissing()
+{
+    {
+        std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
+        if (_timeoutHandlerId.has_value())
+        {
+            return;
+        }
+    }
+
+    // NB: The time provider must be called without holding _timeoutQueueMx. If another call installs a handler in the
+    //     meantime, the handler installed here is removed again. It never counts any steps, because its id is only
+    //     known to it once it became the timeout handler.
+    const auto ownHandlerId = std::make_shared<Util::Optional<Services::HandlerId>>();
+    const auto handlerId = _timeProvider->AddNextSimStepHandler(
+        [this, ownHandlerId](std::chrono::nanoseconds now, std::chrono::nanoseconds duration) {
+        this->TimeHandler(*ownHandlerId, now, duration);
+    });
+
+    {
+        std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
+        if (!_timeoutHandlerId.has_value())
+        {
+            *ownHandlerId = handlerId;
+            _timeoutHandlerId = handlerId;
+            return;
+        }
+    }
+
+    _timeProvider->RemoveNextSimStepHandler(handlerId);
+}
+
+void RpcClient::RemoveTimeoutHandlerIfIdle()
 {
-    if (_numCounterparts == 0)
+    // NB: Without virtual time synchronization, adding a handler restarts the timer thread of the time provider, which
+    //     must not happen for every call. The handler is only removed while the simulation steps drive the timeouts.
+    if (!_timeProvider->IsSynchronizingVirtualTime())
+    {
+        return;
+    }
+
+    Services::HandlerId handlerId{};
+
     {
-        if (_handler)
+        std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
+
+        // NB: A call which is added after the handler id was reset installs a new handler
+        if (!_timeoutEntries.empty() || !_timeoutHandlerId.has_value())
         {
-            _handler(this,
-                     RpcCallResultEvent{_timeProvider->Now(), userContext, RpcCallStatus::ServerNotReachable, {}});
+            return;
         }
+
+        handlerId = _timeoutHandlerId.value();
+        _timeoutHandlerId.reset();
+    }
+
+    _timeProvider->RemoveNextSimStepHandler(handlerId);
+}
+
+
+void RpcClient::TriggerCall(Util::Span<const uint8_t> data, bool hasTimeout, std::chrono::nanoseconds timeout,
+                            void* userContext)
+{
+    std::string targetParticipantName;
+    auto numReturns = static_cast<uint32_t>(_numCounterparts);
+
+    const auto isServerReachable = _dispatchMode == Config::RpcClient::DispatchMode::Broadcast
+                                       ? numReturns != 0
+                                       : SelectServerTarget(targetParticipantName, numReturns);
+
+    if (!isServerReachable)
+    {
+        NotifyServerNotReachable(userContext);
+        return;
+    }
+
+    auto msg = MakeCall(data, hasTimeout, timeout, userContext, numReturns, targetParticipantName);
+
+    if (targetParticipantName.empty())
+    {
+        _participant->SendMsg(this, std::move(msg));
     }
     else
     {
-        const auto callUuid = Util::Uuid::GenerateRandom();
+        _participant->SendMsg(this, targetParticipantName, std::move(msg));
+    }
+}
 
-        FunctionCall msg{_timeProvider->Now(), callUuid, Util::ToStdVector(data)};
+auto RpcClient::MakeCall(Util::Span<const uint8_t> data, bool hasTimeout, std::chrono::nanoseconds timeout,
+                         void* userContext, uint32_t numReturns, const std::string& targetParticipantName)
+    -> FunctionCall
+{
+    const auto callUuid = Util::Uuid{_callIdBase, _nextCallSequenceNumber++};
+
+    FunctionCall msg{_timeProvider->Now(), callUuid, Util::ToStdVector(data)};
+
+    {
+        std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
 
+        if (hasTimeout)
         {
-            {
-                std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
-                _activeCalls.emplace(callUuid, RpcCallInfo{static_cast<int32_t>(_numCounterparts), userContext});
-            }
+            std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
 
-            if (hasTimeout)
-            {
-                {
-                    std::unique_lock<decltype(_timeoutQueueMx)> lockTimeout{_timeoutQueueMx};
-                    _timeoutEntries.push_back({timeout, callUuid});
-                }
-
-                if (!_isTimeoutHandlerSet)
-                {
-                    _timeoutHandlerId = _timeProvider->AddNextSimStepHandler(
-                        [this](std::chrono::nanoseconds now, std::chrono::nanoseconds duration) {
-                        this->TimeHandler(now, duration);
-                    });
-                    _isTimeoutHandlerSet = true;
-                }
-            }
+            const auto timeoutExpiry = _timeoutClock + timeout;
+            _activeCalls.emplace(callUuid, RpcCallInfo{static_cast<int32_t>(numReturns), userContext, true,
+                                                       timeoutExpiry, targetParticipantName});
+            _timeoutEntries.emplace(timeoutExpiry, callUuid);
         }
+        else
+        {
+            _activeCalls.emplace(callUuid, RpcCallInfo{static_cast<int32_t>(numReturns), userContext, false,
+                                                       std::chrono::nanoseconds{0}, targetParticipantName});
+        }
+    }
 
-        _participant->SendMsg(this, std::move(msg));
+    if (hasTimeout)
+    {
+        AddTimeoutHandlerIfMissing();
+    }
+
+    return msg;
+}
+
+void RpcClient::NotifyServerNotReachable(void* userContext)
+{
+    if (_handler)
+    {
+        _handler(this, RpcCallResultEvent{_timeProvider->Now(), userContext, RpcCallStatus::ServerNotReachable, {}});
     }
 }
 
@@ -210,13 +496,26 @@ void RpcClient::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const Functio
     ReceiveMessage(msg);
 }
 
+void RpcClient::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const FunctionCallResponseBatch& msg)
+{
+    for (const auto& response : msg.responses)
+    {
+        ReceiveMessage(response);
+    }
+}
+
 void RpcClient::ReceiveMessage(const FunctionCallResponse& msg)
 {
-    std::map<SilKit::Util::Uuid, SilKit::Services::Rpc::RpcClient::RpcCallInfo>::iterator it;
+    void* userContext{nullptr};
+    bool isCallFinished{false};
+    bool hasTimeout{false};
+    std::chrono::nanoseconds timeoutExpiry{0};
+    std::string targetParticipantName;
+
     {
         std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
 
-        it = _activeCalls.find(msg.callUuid);
+        auto it = _activeCalls.find(msg.callUuid);
 
         if (it == _activeCalls.end())
         {
@@ -225,20 +524,36 @@ void RpcClient::ReceiveMessage(const FunctionCallResponse& msg)
             _logger->Warn(warningMsg);
             return;
         }
-    };
+
+        userContext = it->second.GetUserContext();
+
+        // NB: If the call was made to multiple servers, multiple returns will be received. Only forget about the call
+        //     after all returns have been received.
+        if (it->second.DecrementRemainingReturnCount() <= 0)
+        {
+            isCallFinished = true;
+            hasTimeout = it->second.HasTimeout();
+            timeoutExpiry = it->second.GetTimeoutExpiry();
+            targetParticipantName = it->second.GetTargetParticipantName();
+
+            // NB: The iterators of the call table are not stable, therefore the call is removed under the same lock
+            _activeCalls.erase(it);
+        }
+    }
 
     if (_handler)
     {
-        _handler(this,
-                 RpcCallResultEvent{msg.timestamp, it->second.GetUserContext(), ToRpcCallStatus(msg.status), msg.data});
+        _handler(this, RpcCallResultEvent{msg.timestamp, userContext, ToRpcCallStatus(msg.status), msg.data});
     }
 
-    // NB: If the call was made to multiple servers, multiple returns will be received. Only forget about the call
-    //     after all returns have been received.
-    if (it->second.DecrementRemainingReturnCount() <= 0)
+    if (isCallFinished)
     {
-        std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
-        _activeCalls.erase(it);
+        OnCallFinished(targetParticipantName);
+
+        if (hasTimeout)
+        {
+            EraseTimeoutEntry(timeoutExpiry, msg.callUuid);
+        }
     }
 }
 
@@ -23,8 +23,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <vector>
 #include <future>
+#include <map>
 #include <queue>
 #include <set>
+#include <unordered_map>
 
 #include "silkit/services/rpc/IRpcClient.hpp"
 #include "silkit/services/rpc/IRpcCallHandle.hpp"
@@ -34,7 +36,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ITimeProvider.hpp"
 #include "IMsgForRpcClient.hpp"
 #include "IParticipantInternal.hpp"
+#include "ParticipantConfiguration.hpp"
 #include "RpcCallHandle.hpp"
+#include "Optional.hpp"
 #include "Uuid.hpp"
 
 namespace SilKit {
@@ -51,7 +55,8 @@ class RpcClient
 public:
     RpcClient(Core::IParticipantInternal* participant, Services::Orchestration::ITimeProvider* timeProvider,
               const SilKit::Services::Rpc::RpcSpec& dataSpec, const std::string& clientUUID,
-              RpcCallResultHandler handler);
+              RpcCallResultHandler handler,
+              Config::RpcClient::DispatchMode dispatchMode = Config::RpcClient::DispatchMode::Broadcast);
     ~RpcClient();
 
     void RegisterServiceDiscovery();
@@ -59,12 +64,15 @@ public:
     void Call(Util::Span<const uint8_t> data, void* userContext = nullptr) override;
     void CallWithTimeout(Util::Span<const uint8_t> data, std::chrono::nanoseconds timeout,
                          void* userContext = nullptr) override;
+    void CallBatch(Util::Span<const Util::Span<const uint8_t>> data,
+                   Util::Span<void* const> userContexts = {}) override;
 
     void SetCallResultHandler(RpcCallResultHandler handler) override;
 
     //! \brief Accepts messages originating from SIL Kit communications.
     void ReceiveMsg(const Core::IServiceEndpoint* from, const FunctionCallResponse& msg) override;
     void ReceiveMessage(const FunctionCallResponse& msg);
+    void ReceiveMsg(const Core::IServiceEndpoint* from, const FunctionCallResponseBatch& msg) override;
 
     //SilKit::Services::Orchestration::ITimeConsumer
     void SetTimeProvider(Services::Orchestration::ITimeProvider* provider) override;
@@ -76,14 +84,34 @@ public:
 private:
     void TriggerCall(Util::Span<const uint8_t> data, bool hasTimeout, std::chrono::nanoseconds timeout,
                      void* userContext);
-    void TimeHandler(std::chrono::nanoseconds now, std::chrono::nanoseconds duration);
+    //! Registers a new active call, which expects numReturns results, and returns its message.
+    auto MakeCall(Util::Span<const uint8_t> data, bool hasTimeout, std::chrono::nanoseconds timeout, void* userContext,
+                  uint32_t numReturns, const std::string& targetParticipantName) -> FunctionCall;
+    void NotifyServerNotReachable(void* userContext);
+    //! Returns true if all participants receiving the calls of this client understand batched calls.
+    bool CanBroadcastBatches();
+    //! The steps are only counted by the installed timeout handler, whose id is stored in _timeoutHandlerId
+    void TimeHandler(const Util::Optional<Services::HandlerId>& handlerId, std::chrono::nanoseconds now,
+                     std::chrono::nanoseconds duration);
+    void AddServerTarget(const std::string& participantName);
+    void RemoveServerTarget(const std::string& participantName);
+    //! Selects the participant receiving the next call and returns false if there is none.
+    bool SelectServerTarget(std::string& participantName, uint32_t& numServers);
+    void OnCallFinished(const std::string& targetParticipantName);
+    void EraseTimeoutEntry(std::chrono::nanoseconds expiry, const Util::Uuid& callUuid);
+    void AddTimeoutHandlerIfMissing();
+    void RemoveTimeoutHandlerIfIdle();
 
     class RpcCallInfo
     {
     public:
-        RpcCallInfo(int32_t remainingReturnCount, void* userContext)
+        RpcCallInfo(int32_t remainingReturnCount, void* userContext, bool hasTimeout,
+                    std::chrono::nanoseconds timeoutExpiry, std::string targetParticipantName)
             : _remainingReturnCount{remainingReturnCount}
             , _userContext{userContext}
+            , _hasTimeout{hasTimeout}
+            , _timeoutExpiry{timeoutExpiry}
+            , _targetParticipantName{std::move(targetParticipantName)}
         {
         }
 
@@ -97,9 +125,37 @@ private:
             return _userContext;
         }
 
+        bool HasTimeout() const
+        {
+            return _hasTimeout;
+        }
+
+        auto GetTimeoutExpiry() const -> std::chrono::nanoseconds
+        {
+            return _timeoutExpiry;
+        }
+
+        //! The participant the call was sent to, empty if the call was sent to all matching RpcServers
+        auto GetTargetParticipantName() const -> const std::string&
+        {
+            return _targetParticipantName;
+        }
+
     private:
         int32_t _remainingReturnCount = 0;
         void* _userContext = nullptr;
+        bool _hasTimeout = false;
+        std::chrono::nanoseconds _timeoutExpiry{0};
+        std::string _targetParticipantName;
+    };
+
+    //! A participant with RpcServers matching this client, which is a candidate for the next call unless the client
+    //! broadcasts its calls.
+    struct ServerTarget
+    {
+        std::string participantName;
+        uint32_t numServers{0};
+        uint32_t numOutstandingCalls{0};
     };
 
     SilKit::Services::Rpc::RpcSpec _dataSpec;
@@ -114,21 +170,28 @@ private:
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
     Core::IParticipantInternal* _participant{nullptr};
 
+    Config::RpcClient::DispatchMode _dispatchMode;
+    std::mutex _serverTargetsMx;
+    std::vector<ServerTarget> _serverTargets;
+    size_t _nextServerTarget{0};
+
+    // The call ids consist of a random client id and a per-client sequence number, which is much cheaper than a random
+    // Uuid per call and keeps the call ids unique among all clients
+    const uint64_t _callIdBase;
+    std::atomic<uint64_t> _nextCallSequenceNumber{0};
+
     std::mutex _activeCallsMx;
     std::mutex _timeoutQueueMx;
-    std::map<Util::Uuid, RpcCallInfo> _activeCalls;
-
-    struct TimeoutEntry
-    {
-        std::chrono::nanoseconds timeLeft;
-        Util::Uuid callUuid;
-    };
+    std::unordered_map<Util::Uuid, RpcCallInfo, Util::UuidHash> _activeCalls;
 
+    // The sum of the step durations seen by the timeout handler. The expiry of a call is this time plus its timeout,
+    // so that a step only has to visit the calls that actually time out.
+    std::chrono::nanoseconds _timeoutClock{0};
+    std::multimap<std::chrono::nanoseconds, Util::Uuid> _timeoutEntries{};
 
-    std::vector<TimeoutEntry> _timeoutEntries{};
-    std::function<void(std::chrono::nanoseconds now, std::chrono::nanoseconds duration)> _timeoutHandler{};
-    Services::HandlerId _timeoutHandlerId{};
-    std::atomic<bool> _isTimeoutHandlerSet{false};
+    // The timeout handler is only installed while timeouts are pending. NB: The time provider must not be called while
+    // _timeoutQueueMx is held, because the time provider invokes the handler with its own lock held.
+    Util::Optional<Services::HandlerId> _timeoutHandlerId{};
 };
 
 // ================================================================================
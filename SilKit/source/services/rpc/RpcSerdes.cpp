@@ -49,6 +49,31 @@ inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buff
     return buffer;
 }
 
+inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer, const FunctionCallBatch& msg)
+{
+    buffer << msg.calls;
+    return buffer;
+}
+
+inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer, FunctionCallBatch& msg)
+{
+    buffer >> msg.calls;
+    return buffer;
+}
+
+inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer,
+                                               const FunctionCallResponseBatch& msg)
+{
+    buffer << msg.responses;
+    return buffer;
+}
+
+inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer, FunctionCallResponseBatch& msg)
+{
+    buffer >> msg.responses;
+    return buffer;
+}
+
 using SilKit::Core::MessageBuffer;
 
 void Serialize(MessageBuffer& buffer, const FunctionCall& msg)
@@ -59,6 +84,14 @@ void Serialize(MessageBuffer& buffer, const FunctionCallResponse& msg)
 {
     buffer << msg;
 }
+void Serialize(MessageBuffer& buffer, const FunctionCallBatch& msg)
+{
+    buffer << msg;
+}
+void Serialize(MessageBuffer& buffer, const FunctionCallResponseBatch& msg)
+{
+    buffer << msg;
+}
 
 void Deserialize(MessageBuffer& buffer, FunctionCall& out)
 {
@@ -68,6 +101,14 @@ void Deserialize(MessageBuffer& buffer, FunctionCallResponse& out)
 {
     buffer >> out;
 }
+void Deserialize(MessageBuffer& buffer, FunctionCallBatch& out)
+{
+    buffer >> out;
+}
+void Deserialize(MessageBuffer& buffer, FunctionCallResponseBatch& out)
+{
+    buffer >> out;
+}
 } // namespace Rpc
 } // namespace Services
 } // namespace SilKit
@@ -32,9 +32,13 @@ namespace Rpc {
 
 void Serialize(SilKit::Core::MessageBuffer& buffer, const FunctionCall& msg);
 void Serialize(SilKit::Core::MessageBuffer& buffer, const FunctionCallResponse& msg);
+void Serialize(SilKit::Core::MessageBuffer& buffer, const FunctionCallBatch& msg);
+void Serialize(SilKit::Core::MessageBuffer& buffer, const FunctionCallResponseBatch& msg);
 
 void Deserialize(SilKit::Core::MessageBuffer& buffer, FunctionCall& out);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, FunctionCallResponse& out);
+void Deserialize(SilKit::Core::MessageBuffer& buffer, FunctionCallBatch& out);
+void Deserialize(SilKit::Core::MessageBuffer& buffer, FunctionCallResponseBatch& out);
 
 } // namespace Rpc
 } // namespace Services
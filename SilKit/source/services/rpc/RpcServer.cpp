@@ -25,7 +25,6 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "RpcServer.hpp"
 #include "RpcDatatypeUtils.hpp"
 #include "Uuid.hpp"
-#include "YamlParser.hpp"
 #include "Assert.hpp"
 #include "LabelMatching.hpp"
 
@@ -34,13 +33,25 @@ namespace Services {
 namespace Rpc {
 
 RpcServer::RpcServer(Core::IParticipantInternal* participant, Services::Orchestration::ITimeProvider* timeProvider,
-                     const SilKit::Services::Rpc::RpcSpec& dataSpec, RpcCallHandler handler)
+                     const SilKit::Services::Rpc::RpcSpec& dataSpec, RpcCallHandler handler, uint32_t executorThreads)
     : _dataSpec{dataSpec}
     , _handler{std::move(handler)}
     , _logger{participant->GetLogger()}
     , _timeProvider{timeProvider}
     , _participant{participant}
 {
+    if (executorThreads > 0)
+    {
+        _executor = std::make_shared<RpcServerExecutor>(executorThreads, "SilKitRpcServer", _logger);
+    }
+}
+
+RpcServer::~RpcServer()
+{
+    if (_executor)
+    {
+        _executor->Shutdown();
+    }
 }
 
 void RpcServer::RegisterServiceDiscovery()
@@ -49,7 +60,7 @@ void RpcServer::RegisterServiceDiscovery()
                                const SilKit::Core::ServiceDescriptor& serviceDescriptor) {
         if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated)
         {
-            auto getVal = [serviceDescriptor](const std::string& key) {
+            auto getVal = [&serviceDescriptor](const std::string& key) {
                 std::string tmp;
                 if (!serviceDescriptor.GetSupplementalDataItem(key, tmp))
                 {
@@ -62,7 +73,7 @@ void RpcServer::RegisterServiceDiscovery()
             auto clientMediaType = getVal(Core::Discovery::supplKeyRpcClientMediaType);
             auto clientUUID = getVal(Core::Discovery::supplKeyRpcClientUUID);
             std::string labelsStr = getVal(Core::Discovery::supplKeyRpcClientLabels);
-            auto clientLabels = SilKit::Config::Deserialize<std::vector<SilKit::Services::MatchingLabel>>(labelsStr);
+            const auto& clientLabels = _participant->GetServiceDiscovery()->GetMatchingLabels(labelsStr);
 
             if (functionName == _dataSpec.FunctionName() && MatchMediaType(clientMediaType, _dataSpec.MediaType())
                 && Util::MatchLabels(_dataSpec.Labels(), clientLabels))
@@ -91,6 +102,10 @@ void RpcServer::SubmitResult(IRpcCallHandle* callHandle, Util::Span<const uint8_
         throw SilKit::StateError{std::move(errorMsg)};
     }
 
+    // NB: The call handle is destroyed as soon as the result is submitted, therefore the call id must be taken from
+    //     the call handle before
+    const auto callUuid = static_cast<const RpcCallHandle*>(callHandle)->GetCallUuid();
+
     // counts the number of RpcServerInternal's living within this RpcServer that returned the FunctionCall
     uint32_t submitResultCounter = 0;
 
@@ -98,7 +113,7 @@ void RpcServer::SubmitResult(IRpcCallHandle* callHandle, Util::Span<const uint8_
         std::unique_lock<decltype(_internalRpcServersMx)> lock{_internalRpcServersMx};
         for (auto* internalRpcServer : _internalRpcServers)
         {
-            submitResultCounter += (internalRpcServer->SubmitResult(callHandle, resultData) ? 1 : 0);
+            submitResultCounter += (internalRpcServer->SubmitResult(callUuid, resultData) ? 1 : 0);
         }
     }
 
@@ -116,6 +131,7 @@ void RpcServer::AddInternalRpcServer(const std::string& clientUUID, std::string
 {
     auto internalRpcServer = dynamic_cast<RpcServerInternal*>(_participant->CreateRpcServerInternal(
         _dataSpec.FunctionName(), clientUUID, joinedMediaType, clientLabels, _handler, this));
+    internalRpcServer->SetExecutor(_executor);
 
     std::unique_lock<decltype(_internalRpcServersMx)> lock{_internalRpcServersMx};
     _internalRpcServers.push_back(internalRpcServer);
@@ -23,6 +23,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <vector>
 #include <future>
+#include <memory>
 
 #include "silkit/services/rpc/IRpcServer.hpp"
 #include "silkit/services/rpc/IRpcCallHandle.hpp"
@@ -31,6 +32,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IMsgForRpcServer.hpp"
 #include "IParticipantInternal.hpp"
 #include "RpcServerInternal.hpp"
+#include "RpcServerExecutor.hpp"
 #include "RpcCallHandle.hpp"
 
 namespace SilKit {
@@ -45,7 +47,8 @@ class RpcServer
 {
 public:
     RpcServer(Core::IParticipantInternal* participant, Services::Orchestration::ITimeProvider* timeProvider,
-              const SilKit::Services::Rpc::RpcSpec& dataSpec, RpcCallHandler handler);
+              const SilKit::Services::Rpc::RpcSpec& dataSpec, RpcCallHandler handler, uint32_t executorThreads = 0);
+    ~RpcServer();
 
     void RegisterServiceDiscovery();
 
@@ -74,6 +77,9 @@ private:
 
     std::mutex _internalRpcServersMx;
     std::vector<RpcServerInternal*> _internalRpcServers;
+
+    // Executes the call handler off the I/O thread, if configured
+    std::shared_ptr<RpcServerExecutor> _executor;
 };
 
 // ================================================================================
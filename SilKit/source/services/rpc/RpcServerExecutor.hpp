@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "silkit/services/logging/ILogger.hpp"
+
+#include "SetThreadName.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace Rpc {
+
+//! \brief A fixed number of worker threads which execute the call handlers of an RpcServer.
+//!
+//! The tasks are started in the order they were posted. With more than one worker, they may run concurrently and finish
+//! in any order.
+class RpcServerExecutor
+{
+public:
+    using Task = std::function<void()>;
+
+    RpcServerExecutor(size_t numWorkers, const std::string& threadName, Logging::ILogger* logger)
+        : _logger{logger}
+    {
+        _workers.reserve(numWorkers);
+        for (size_t i = 0; i < numWorkers; ++i)
+        {
+            _workers.emplace_back([this, threadName] {
+                Util::SetThreadName(threadName);
+                Run();
+            });
+        }
+    }
+
+    ~RpcServerExecutor()
+    {
+        Shutdown();
+    }
+
+    RpcServerExecutor(const RpcServerExecutor&) = delete;
+    RpcServerExecutor& operator=(const RpcServerExecutor&) = delete;
+
+public:
+    //! Enqueues a task. Tasks posted after the shutdown are dropped.
+    void Post(Task task)
+    {
+        {
+            std::unique_lock<decltype(_mutex)> lock{_mutex};
+            if (_stopRequested)
+            {
+                return;
+            }
+            _tasks.push_back(std::move(task));
+        }
+        _taskAvailable.notify_one();
+    }
+
+    //! Drops all pending tasks and waits for the running ones. Must not be called from within a task.
+    void Shutdown()
+    {
+        {
+            std::unique_lock<decltype(_mutex)> lock{_mutex};
+            _stopRequested = true;
+            _tasks.clear();
+        }
+        _taskAvailable.notify_all();
+
+        for (auto& worker : _workers)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+    }
+
+private:
+    void Run()
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        while (true)
+        {
+            _taskAvailable.wait(lock, [this] { return _stopRequested || !_tasks.empty(); });
+            if (_stopRequested)
+            {
+                return;
+            }
+
+            auto task = std::move(_tasks.front());
+            _tasks.pop_front();
+
+            lock.unlock();
+            // an exception of one call handler must neither affect the other calls nor terminate the worker
+            try
+            {
+                task();
+            }
+            catch (const std::exception& e)
+            {
+                _logger->Error(std::string{"RpcServer: Call handler threw an exception: "} + e.what());
+            }
+            catch (...)
+            {
+                _logger->Error("RpcServer: Call handler threw an unknown exception");
+            }
+            lock.lock();
+        }
+    }
+
+private:
+    Logging::ILogger* _logger;
+
+    std::mutex _mutex;
+    std::condition_variable _taskAvailable;
+    bool _stopRequested{false};
+    std::deque<Task> _tasks;
+
+    // The workers must be the last member. This ensures that they are started after all other members are initialized.
+    std::vector<std::thread> _workers;
+};
+
+} // namespace Rpc
+} // namespace Services
+} // namespace SilKit
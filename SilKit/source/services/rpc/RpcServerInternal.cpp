@@ -46,6 +46,14 @@ RpcServerInternal::RpcServerInternal(Core::IParticipantInternal* participant,
 {
 }
 
+RpcServerInternal::~RpcServerInternal()
+{
+    // NB: The executor is shared by all RpcServerInternals of the RpcServer, which shuts it down. The tasks posted by
+    //     this RpcServerInternal refer to it: the running ones are waited for, and the pending ones are dropped.
+    std::unique_lock<decltype(_liveness->mutex)> lock{_liveness->mutex};
+    _liveness->isAlive = false;
+}
+
 void RpcServerInternal::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const FunctionCall& msg)
 {
     ReceiveMessage(msg);
@@ -53,56 +61,162 @@ void RpcServerInternal::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const
 
 void RpcServerInternal::ReceiveMessage(const FunctionCall& msg)
 {
-    if (!_handler)
+    // NB: The copy of the call handle keeps the handle itself alive while the handler runs, even if it gets removed
+    //     from the active calls due to a call to SubmitResult in the handler.
+    auto callHandle = StartCall(msg, nullptr);
+    if (callHandle == nullptr)
     {
-        // Inform the client about the failed (unhandled) call
-        _participant->SendMsg(
-            this,
-            FunctionCallResponse{_timeProvider->Now(), msg.callUuid, {}, FunctionCallResponse::Status::InternalError});
-
-        // Log that a call was received that could not be handled
-        _participant->GetLogger()->Error("RpcServerInternal: FunctionCall received but no handler has been set");
-
         return;
     }
 
-    // NB: 'result' has type pair<iterator, bool> where the bool indicates if the call was actually inserted (i.e.
-    //     the key was _not_ already present in the map).
-    auto result = _activeCalls.emplace(msg.callUuid, std::make_shared<RpcCallHandle>(msg.callUuid));
-    if (!result.second)
+    if (_executor)
     {
-        // Inform the client about the failed (unhandled) call
-        _participant->SendMsg(
-            this,
-            FunctionCallResponse{_timeProvider->Now(), msg.callUuid, {}, FunctionCallResponse::Status::InternalError});
+        PostToExecutor([parent = _parent, handler = _handler, timestamp = msg.timestamp, callHandle,
+                        argumentData = msg.data] {
+            handler(parent, RpcCallEvent{timestamp, callHandle.get(), argumentData});
+        });
+        return;
+    }
+
+    _handler(_parent, RpcCallEvent{msg.timestamp, callHandle.get(), msg.data});
+}
 
-        // Log that a call was received that could not be handled
-        _participant->GetLogger()->Error("RpcServerInternal: Received FunctionCall with already active callUuid");
+void RpcServerInternal::ReceiveMsg(const Core::IServiceEndpoint* /*from*/, const FunctionCallBatch& msg)
+{
+    // NB: The results submitted while the calls of the batch are handled are sent back as a single batch, results
+    //     submitted later on are sent one by one
+    auto responseBatch = std::make_shared<ResponseBatch>();
+    responseBatch->msg.responses.reserve(msg.calls.size());
+
+    std::vector<std::shared_ptr<RpcCallHandle>> callHandles;
+    callHandles.reserve(msg.calls.size());
+    for (const auto& call : msg.calls)
+    {
+        callHandles.push_back(StartCall(call, responseBatch));
+    }
 
+    auto handleCalls = [this, parent = _parent, handler = _handler, responseBatch](
+                           const std::vector<FunctionCall>& calls,
+                           const std::vector<std::shared_ptr<RpcCallHandle>>& callHandles) {
+        for (size_t i = 0; i < calls.size(); ++i)
+        {
+            if (callHandles[i] != nullptr)
+            {
+                handler(parent, RpcCallEvent{calls[i].timestamp, callHandles[i].get(), calls[i].data});
+            }
+        }
+        FlushResponseBatch(*responseBatch);
+    };
+
+    if (_executor)
+    {
+        // NB: The calls of a batch are handled one after another by the same worker
+        PostToExecutor([handleCalls, calls = msg.calls, callHandles = std::move(callHandles)] {
+            handleCalls(calls, callHandles);
+        });
         return;
     }
 
-    // NB: Explicitly _copy_ the call handle to keep the handle itself alive even if it gets removed from the map
-    //     due to a call to SubmitResult in the handler.
-    std::shared_ptr<RpcCallHandle> callHandle = result.first->second;
-    _handler(_parent, RpcCallEvent{msg.timestamp, callHandle.get(), msg.data});
+    handleCalls(msg.calls, callHandles);
 }
 
-bool RpcServerInternal::SubmitResult(IRpcCallHandle* callHandlePtr, Util::Span<const uint8_t> resultData)
+void RpcServerInternal::PostToExecutor(std::function<void()> task)
 {
-    const auto& callHandle = static_cast<const RpcCallHandle&>(*callHandlePtr);
+    _executor->Post([liveness = _liveness, task = std::move(task)] {
+        // NB: The tasks of this RpcServerInternal may run concurrently, only its destruction is exclusive
+        std::shared_lock<decltype(liveness->mutex)> lock{liveness->mutex};
+        if (liveness->isAlive)
+        {
+            task();
+        }
+    });
+}
 
-    auto it = _activeCalls.find(callHandle.GetCallUuid());
-    if (it == _activeCalls.end())
+auto RpcServerInternal::StartCall(const FunctionCall& msg, std::shared_ptr<ResponseBatch> responseBatch)
+    -> std::shared_ptr<RpcCallHandle>
+{
+    if (!_handler)
     {
-        // The call is not known to this RpcServerInternal, therefore return false
-        return false;
+        SendCallError(msg.callUuid, "RpcServerInternal: FunctionCall received but no handler has been set");
+        return nullptr;
     }
 
+    {
+        std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
+
+        // NB: 'result' has type pair<iterator, bool> where the bool indicates if the call was actually inserted (i.e.
+        //     the key was _not_ already present in the map).
+        auto result = _activeCalls.emplace(msg.callUuid, ActiveCall{});
+        if (result.second)
+        {
+            result.first->second.callHandle = std::make_shared<RpcCallHandle>(msg.callUuid);
+            result.first->second.responseBatch = std::move(responseBatch);
+            return result.first->second.callHandle;
+        }
+    }
+
+    SendCallError(msg.callUuid, "RpcServerInternal: Received FunctionCall with already active callUuid");
+    return nullptr;
+}
+
+void RpcServerInternal::SendCallError(const Util::Uuid& callUuid, const std::string& errorMessage)
+{
+    // Inform the client about the failed (unhandled) call
     _participant->SendMsg(
-        this, FunctionCallResponse{_timeProvider->Now(), callHandle.GetCallUuid(), Util::ToStdVector(resultData),
-                                   FunctionCallResponse::Status::Success});
-    _activeCalls.erase(it);
+        this, FunctionCallResponse{_timeProvider->Now(), callUuid, {}, FunctionCallResponse::Status::InternalError});
+
+    // Log that a call was received that could not be handled
+    _participant->GetLogger()->Error(errorMessage);
+}
+
+void RpcServerInternal::FlushResponseBatch(ResponseBatch& responseBatch)
+{
+    FunctionCallResponseBatch msg;
+
+    {
+        std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
+        responseBatch.isCollecting = false;
+        msg = std::move(responseBatch.msg);
+    }
+
+    if (!msg.responses.empty())
+    {
+        _participant->SendMsg(this, std::move(msg));
+    }
+}
+
+bool RpcServerInternal::SubmitResult(const Util::Uuid& callUuid, Util::Span<const uint8_t> resultData)
+{
+    std::shared_ptr<ResponseBatch> responseBatch;
+
+    {
+        std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
+
+        auto it = _activeCalls.find(callUuid);
+        if (it == _activeCalls.end())
+        {
+            // The call is not known to this RpcServerInternal, therefore return false
+            return false;
+        }
+
+        responseBatch = std::move(it->second.responseBatch);
+        _activeCalls.erase(it);
+    }
+
+    FunctionCallResponse response{_timeProvider->Now(), callUuid, Util::ToStdVector(resultData),
+                                  FunctionCallResponse::Status::Success};
+
+    if (responseBatch)
+    {
+        std::unique_lock<decltype(_activeCallsMx)> lock{_activeCallsMx};
+        if (responseBatch->isCollecting)
+        {
+            responseBatch->msg.responses.emplace_back(std::move(response));
+            return true;
+        }
+    }
+
+    _participant->SendMsg(this, std::move(response));
 
     // The call was handled, therefore return true
     return true;
@@ -113,6 +227,11 @@ void RpcServerInternal::SetRpcHandler(RpcCallHandler handler)
     _handler = std::move(handler);
 }
 
+void RpcServerInternal::SetExecutor(std::shared_ptr<RpcServerExecutor> executor)
+{
+    _executor = std::move(executor);
+}
+
 void RpcServerInternal::SetTimeProvider(Services::Orchestration::ITimeProvider* provider)
 {
     _timeProvider = provider;
@@ -22,7 +22,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <vector>
-#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include "ITimeConsumer.hpp"
 #include "silkit/services/rpc/IRpcServer.hpp"
@@ -31,6 +34,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IParticipantInternal.hpp"
 #include "IMsgForRpcServerInternal.hpp"
 #include "RpcCallHandle.hpp"
+#include "RpcServerExecutor.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -46,18 +50,23 @@ public:
                       const std::string& functionName, const std::string& mediaType,
                       const std::vector<SilKit::Services::MatchingLabel>& labels, const std::string& clientUUID,
                       SilKit::Services::Rpc::RpcCallHandler handler, IRpcServer* parent);
+    ~RpcServerInternal();
 
     void SetRpcHandler(RpcCallHandler handler);
 
-    //! \brief Tries to submit the result to the call associated with the call handle.
-    //! \param callHandlePtr The call handle identifying the call to submit a result for
+    //! \brief Executes the call handler on the given executor instead of the I/O thread.
+    void SetExecutor(std::shared_ptr<RpcServerExecutor> executor);
+
+    //! \brief Tries to submit the result to the call with the given call id.
+    //! \param callUuid The id of the call to submit a result for, taken from its call handle
     //! \param resultData The result of the call
     //! \returns True if the call was handled, false if the call was unknown to this RpcServerInternal
-    bool SubmitResult(IRpcCallHandle* callHandlePtr, Util::Span<const uint8_t> resultData);
+    bool SubmitResult(const Util::Uuid& callUuid, Util::Span<const uint8_t> resultData);
 
     //! \brief Accepts messages originating from SIL Kit communications.
     void ReceiveMsg(const Core::IServiceEndpoint* from, const FunctionCall& msg) override;
     void ReceiveMessage(const FunctionCall& msg);
+    void ReceiveMsg(const Core::IServiceEndpoint* from, const FunctionCallBatch& msg) override;
 
     // SilKit::Services::Orchestration::ITimeConsumer
     void SetTimeProvider(Services::Orchestration::ITimeProvider* provider) override;
@@ -66,6 +75,37 @@ public:
     inline void SetServiceDescriptor(const Core::ServiceDescriptor& serviceDescriptor) override;
     inline auto GetServiceDescriptor() const -> const Core::ServiceDescriptor& override;
 
+private:
+    //! The responses to the calls of a FunctionCallBatch, which are collected while the calls are handled
+    struct ResponseBatch
+    {
+        bool isCollecting{true};
+        FunctionCallResponseBatch msg;
+    };
+
+    //! Guards the tasks posted to the shared executor against the destruction of this RpcServerInternal
+    struct Liveness
+    {
+        std::shared_timed_mutex mutex;
+        bool isAlive{true};
+    };
+
+    struct ActiveCall
+    {
+        std::shared_ptr<RpcCallHandle> callHandle;
+        //! Set if the call is part of a batch
+        std::shared_ptr<ResponseBatch> responseBatch;
+    };
+
+    //! Posts the task to the executor. The task is dropped if this RpcServerInternal is destroyed before it runs.
+    void PostToExecutor(std::function<void()> task);
+    //! Registers the call as active and returns its handle, or nullptr if the call cannot be handled.
+    auto StartCall(const FunctionCall& msg, std::shared_ptr<ResponseBatch> responseBatch)
+        -> std::shared_ptr<RpcCallHandle>;
+    void SendCallError(const Util::Uuid& callUuid, const std::string& errorMessage);
+    //! Stops collecting the responses of the batch and sends the ones collected so far.
+    void FlushResponseBatch(ResponseBatch& responseBatch);
+
 private:
     std::string _functionName;
     std::string _mediaType;
@@ -75,7 +115,12 @@ private:
     IRpcServer* _parent;
 
     Core::ServiceDescriptor _serviceDescriptor{};
-    std::map<Util::Uuid, std::shared_ptr<RpcCallHandle>> _activeCalls;
+    std::shared_ptr<RpcServerExecutor> _executor;
+    std::shared_ptr<Liveness> _liveness{std::make_shared<Liveness>()};
+
+    // NB: With an executor, SubmitResult is called from the worker threads
+    std::mutex _activeCallsMx;
+    std::unordered_map<Util::Uuid, ActiveCall, Util::UuidHash> _activeCalls;
     Services::Orchestration::ITimeProvider* _timeProvider{nullptr};
     Core::IParticipantInternal* _participant{nullptr};
 };
@@ -78,6 +78,17 @@ struct MockConnection
     {
     }
 
+    template <class SilKitServiceT>
+    void SetKeepLatestForLink(bool /*keepLatest*/, SilKitServiceT* /*service*/)
+    {
+    }
+
+    template <typename SilKitMessageT, class SilKitServiceT>
+    void SetReceiverFilterForLink(std::function<bool(const std::string&, const SilKitMessageT&)> /*receiverFilter*/,
+                                  SilKitServiceT* /*service*/)
+    {
+    }
+
     template <typename SilKitMessageT>
     void SendMsg(const SilKit::Core::IServiceEndpoint* /*from*/, SilKitMessageT&& /*msg*/)
     {
@@ -101,8 +112,29 @@ struct MockConnection
         Mock_SendMsg(from, std::move(msg));
     }
 
+    void SendMsg(const SilKit::Core::IServiceEndpoint* from, FunctionCallBatch msg)
+    {
+        for (auto& rpcServerInternal : services.rpcServerInternal)
+        {
+            rpcServerInternal->ReceiveMsg(from, msg);
+        }
+        Mock_SendMsg(from, std::move(msg));
+    }
+
+    void SendMsg(const SilKit::Core::IServiceEndpoint* from, FunctionCallResponseBatch msg)
+    {
+        for (auto& rpcClient : services.rpcClient)
+        {
+            rpcClient->ReceiveMsg(from, msg);
+        }
+        Mock_SendMsg(from, std::move(msg));
+    }
+
     MOCK_METHOD(void, Mock_SendMsg, (const SilKit::Core::IServiceEndpoint* /*from*/, FunctionCall /*msg*/));
     MOCK_METHOD(void, Mock_SendMsg, (const SilKit::Core::IServiceEndpoint* /*from*/, FunctionCallResponse /*msg*/));
+    MOCK_METHOD(void, Mock_SendMsg, (const SilKit::Core::IServiceEndpoint* /*from*/, FunctionCallBatch /*msg*/));
+    MOCK_METHOD(void, Mock_SendMsg,
+                (const SilKit::Core::IServiceEndpoint* /*from*/, FunctionCallResponseBatch /*msg*/));
 
     template <typename SilKitMessageT>
     void SendMsg(const SilKit::Core::IServiceEndpoint* /*from*/, const std::string& /*target*/,
@@ -110,6 +142,22 @@ struct MockConnection
     {
     }
 
+    void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& target, FunctionCall msg)
+    {
+        Mock_SendMsg(from, target, std::move(msg));
+    }
+
+    void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& target, FunctionCallBatch msg)
+    {
+        Mock_SendMsg(from, target, std::move(msg));
+    }
+
+    MOCK_METHOD(void, Mock_SendMsg,
+                (const SilKit::Core::IServiceEndpoint* /*from*/, const std::string& /*target*/, FunctionCall /*msg*/));
+    MOCK_METHOD(void, Mock_SendMsg,
+                (const SilKit::Core::IServiceEndpoint* /*from*/, const std::string& /*target*/,
+                 FunctionCallBatch /*msg*/));
+
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) {}
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> /*callback*/) {}
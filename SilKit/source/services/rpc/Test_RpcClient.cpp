@@ -124,4 +124,167 @@ TEST_F(Test_RpcClient, rpc_client_call_receives_internal_server_error_when_serve
     iRpcClient->Call(sampleData, userContext);
 }
 
+TEST_F(Test_RpcClient, rpc_client_call_ids_share_the_client_id_and_are_numbered_sequentially)
+{
+    CreateRpcServer();
+    IRpcClient* iRpcClient = CreateRpcClient();
+
+    std::vector<SilKit::Util::Uuid> callUuids;
+    EXPECT_CALL(participant->GetSilKitConnection(), Mock_SendMsg(testing::_, testing::A<FunctionCall>()))
+        .Times(3)
+        .WillRepeatedly([&callUuids](const SilKit::Core::IServiceEndpoint* /*from*/, const FunctionCall& msg) {
+        callUuids.push_back(msg.callUuid);
+    });
+
+    iRpcClient->Call(sampleData);
+    iRpcClient->Call(sampleData);
+    iRpcClient->Call(sampleData);
+
+    ASSERT_EQ(callUuids.size(), 3u);
+    EXPECT_EQ(callUuids[1].ab, callUuids[0].ab);
+    EXPECT_EQ(callUuids[2].ab, callUuids[0].ab);
+    EXPECT_EQ(callUuids[1].cd, callUuids[0].cd + 1);
+    EXPECT_EQ(callUuids[2].cd, callUuids[0].cd + 2);
+}
+
+// The time provider must outlive the participant, because the RpcClient removes its timeout handler when destroyed
+struct WithMockTimeProvider
+{
+    SilKit::Core::Tests::MockTimeProvider timeProvider;
+};
+
+class Test_RpcClientTimeout
+    : public WithMockTimeProvider
+    , public RpcTestBase
+{
+};
+
+TEST_F(Test_RpcClientTimeout, rpc_client_times_out_calls_in_order_of_their_expiry)
+{
+    using namespace std::chrono_literals;
+
+    IRpcServer* iRpcServer = CreateRpcServer();
+    IRpcClient* iRpcClient = CreateRpcClient();
+    iRpcClient->SetCallResultHandler(SilKit::Util::bind_method(&callbacks, &Callbacks::CallResultHandler));
+
+    // The server only answers the call it is told to answer
+    std::vector<IRpcCallHandle*> callHandles;
+    iRpcServer->SetCallHandler(
+        [&callHandles](IRpcServer* /*server*/, const RpcCallEvent& event) { callHandles.push_back(event.callHandle); });
+
+    participant->GetSilKitConnection().Test_SetTimeProvider(&timeProvider);
+
+    const auto contextA = reinterpret_cast<void*>(uintptr_t(1));
+    const auto contextB = reinterpret_cast<void*>(uintptr_t(2));
+    const auto contextC = reinterpret_cast<void*>(uintptr_t(3));
+
+    iRpcClient->CallWithTimeout(sampleData, 3ms, contextA);
+    iRpcClient->CallWithTimeout(sampleData, 1ms, contextB);
+    iRpcClient->CallWithTimeout(sampleData, 2ms, contextC);
+    ASSERT_EQ(callHandles.size(), 3u);
+
+    auto isResult = [](void* userContext, RpcCallStatus callStatus) {
+        return testing::Matcher<RpcCallResultEvent>{
+            testing::AllOf(testing::Field(&RpcCallResultEvent::userContext, userContext),
+                           testing::Field(&RpcCallResultEvent::callStatus, callStatus))};
+    };
+
+    testing::Sequence sequence;
+    EXPECT_CALL(callbacks, CallResultHandler(testing::Eq(iRpcClient), isResult(contextC, RpcCallStatus::Success)))
+        .InSequence(sequence);
+    EXPECT_CALL(callbacks, CallResultHandler(testing::Eq(iRpcClient), isResult(contextB, RpcCallStatus::Timeout)))
+        .InSequence(sequence);
+    EXPECT_CALL(callbacks, CallResultHandler(testing::Eq(iRpcClient), isResult(contextA, RpcCallStatus::Timeout)))
+        .InSequence(sequence);
+
+    // A call that received its result does not time out anymore
+    iRpcServer->SubmitResult(callHandles[2], sampleData);
+
+    timeProvider._handlers.InvokeAll(1ms, 1ms);
+    timeProvider._handlers.InvokeAll(2ms, 1ms);
+    timeProvider._handlers.InvokeAll(3ms, 1ms);
+}
+
+TEST_F(Test_RpcClient, rpc_client_call_batch_sends_one_message_and_delivers_the_results_per_call)
+{
+    IRpcServer* iRpcServer = CreateRpcServer();
+    iRpcServer->SetCallHandler([](IRpcServer* server, const RpcCallEvent& event) {
+        server->SubmitResult(event.callHandle, event.argumentData);
+    });
+
+    IRpcClient* iRpcClient = CreateRpcClient();
+    std::vector<std::pair<void*, std::vector<uint8_t>>> results;
+    iRpcClient->SetCallResultHandler([&results](IRpcClient*, const RpcCallResultEvent& event) {
+        EXPECT_EQ(event.callStatus, RpcCallStatus::Success);
+        results.emplace_back(event.userContext, SilKit::Util::ToStdVector(event.resultData));
+    });
+
+    auto& connection = participant->GetSilKitConnection();
+    EXPECT_CALL(connection, Mock_SendMsg(testing::_, testing::A<FunctionCall>())).Times(0);
+    EXPECT_CALL(connection, Mock_SendMsg(testing::_, testing::A<FunctionCallResponse>())).Times(0);
+    EXPECT_CALL(connection, Mock_SendMsg(testing::_, testing::A<FunctionCallBatch>()))
+        .WillOnce([](const SilKit::Core::IServiceEndpoint* /*from*/, const FunctionCallBatch& msg) {
+        EXPECT_EQ(msg.calls.size(), 3u);
+    });
+    EXPECT_CALL(connection, Mock_SendMsg(testing::_, testing::A<FunctionCallResponseBatch>()))
+        .WillOnce([](const SilKit::Core::IServiceEndpoint* /*from*/, const FunctionCallResponseBatch& msg) {
+        EXPECT_EQ(msg.responses.size(), 3u);
+    });
+
+    const std::vector<std::vector<uint8_t>> arguments{{1}, {2, 2}, {3, 3, 3}};
+    const std::vector<SilKit::Util::Span<const uint8_t>> argumentSpans{arguments.begin(), arguments.end()};
+    std::vector<void*> userContexts{reinterpret_cast<void*>(uintptr_t(1)), reinterpret_cast<void*>(uintptr_t(2)),
+                                    reinterpret_cast<void*>(uintptr_t(3))};
+
+    iRpcClient->CallBatch(argumentSpans, userContexts);
+
+    ASSERT_EQ(results.size(), 3u);
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        EXPECT_EQ(results[i].first, userContexts[i]);
+        EXPECT_EQ(results[i].second, arguments[i]);
+    }
+
+    EXPECT_THROW(iRpcClient->CallBatch(argumentSpans, SilKit::Util::Span<void* const>{userContexts.data(), 2}),
+                 SilKit::SilKitError);
+}
+
+TEST(Test_RpcClientDispatch, round_robin_dispatch_sends_each_call_to_one_participant_in_turns)
+{
+    auto configuration = std::make_shared<SilKit::Config::ParticipantConfiguration>();
+
+    SilKit::Config::RpcClient rpcClientConfig;
+    rpcClientConfig.name = "RpcClient";
+    rpcClientConfig.dispatchMode = SilKit::Config::RpcClient::DispatchMode::RoundRobin;
+    configuration->rpcClients.push_back(rpcClientConfig);
+
+    auto participant = MakeMockConnectionParticipant(configuration, "RpcClientTest");
+    auto& connection = participant->GetSilKitConnection();
+
+    SilKit::Services::Rpc::RpcSpec dataSpec{"FunctionA", "application/octet-stream"};
+    participant->CreateRpcServer("RpcServer", dataSpec, nullptr);
+    auto* rpcClient = participant->CreateRpcClient("RpcClient", dataSpec, nullptr);
+
+    // Announce a matching RpcServer of another participant
+    ASSERT_EQ(connection.services.rpcServerInternal.size(), 1u);
+    auto remoteServerDescriptor = connection.services.rpcServerInternal[0]->GetServiceDescriptor();
+    remoteServerDescriptor.SetParticipantNameAndComputeId("RemoteParticipant");
+    participant->GetServiceDiscovery()->NotifyServiceCreated(remoteServerDescriptor);
+
+    std::vector<std::string> targets;
+    EXPECT_CALL(connection, Mock_SendMsg(testing::_, testing::A<FunctionCall>())).Times(0);
+    EXPECT_CALL(connection, Mock_SendMsg(testing::_, testing::_, testing::A<FunctionCall>()))
+        .Times(4)
+        .WillRepeatedly([&targets](const SilKit::Core::IServiceEndpoint* /*from*/, const std::string& target,
+                                   const FunctionCall& /*msg*/) { targets.push_back(target); });
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        rpcClient->Call(std::vector<uint8_t>{1, 2, 3});
+    }
+
+    EXPECT_THAT(targets,
+                testing::ElementsAre("RpcClientTest", "RemoteParticipant", "RpcClientTest", "RemoteParticipant"));
+}
+
 } // anonymous namespace
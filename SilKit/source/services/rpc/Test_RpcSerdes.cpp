@@ -61,3 +61,46 @@ TEST(Test_RpcSerdes, SimRpc_functioncall_response)
     Deserialize(buffer, out);
     EXPECT_EQ(in, out);
 }
+
+TEST(Test_RpcSerdes, SimRpc_functioncall_batch)
+{
+    using namespace SilKit::Services::Rpc;
+    using namespace SilKit::Core;
+
+    SilKit::Core::MessageBuffer buffer;
+    FunctionCallBatch in, out;
+    for (uint64_t i = 0; i < 3; ++i)
+    {
+        FunctionCall call;
+        call.callUuid = {1234565, 0x789abcdf + i};
+        call.data = std::vector<uint8_t>(i * 10, 'D');
+        call.timestamp = 12345ns;
+        in.calls.push_back(std::move(call));
+    }
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+    EXPECT_EQ(in, out);
+}
+
+TEST(Test_RpcSerdes, SimRpc_functioncall_response_batch)
+{
+    using namespace SilKit::Services::Rpc;
+    using namespace SilKit::Core;
+
+    SilKit::Core::MessageBuffer buffer;
+    FunctionCallResponseBatch in, out;
+    for (uint64_t i = 0; i < 3; ++i)
+    {
+        FunctionCallResponse response;
+        response.callUuid = {1234565, 0x789abcdf + i};
+        response.data = std::vector<uint8_t>(i * 10, 'D');
+        response.timestamp = 12345ns;
+        response.status = FunctionCallResponse::Status::Success;
+        in.responses.push_back(std::move(response));
+    }
+
+    Serialize(buffer, in);
+    Deserialize(buffer, out);
+    EXPECT_EQ(in, out);
+}
@@ -20,10 +20,16 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "RpcClient.hpp"
+#include "RpcServerExecutor.hpp"
+#include "RpcServerInternal.hpp"
 
 #include <chrono>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -71,4 +77,169 @@ TEST_F(Test_RpcServer, rpc_server_call_response_sends_message_with_timestamp_and
     iRpcClient->Call(sampleData);
 }
 
+auto MakeParticipantWithExecutorThreads(uint32_t executorThreads) -> std::unique_ptr<MockConnectionParticipant>
+{
+    auto configuration = std::make_shared<SilKit::Config::ParticipantConfiguration>();
+
+    SilKit::Config::RpcServer rpcServerConfig;
+    rpcServerConfig.name = "RpcServer";
+    rpcServerConfig.executorThreads = executorThreads;
+    configuration->rpcServers.push_back(rpcServerConfig);
+
+    return MakeMockConnectionParticipant(configuration, "RpcServerTest");
+}
+
+// Waits until the predicate holds, or fails after a generous timeout
+template <typename PredicateT>
+bool WaitFor(std::mutex& mutex, std::condition_variable& cv, PredicateT&& predicate)
+{
+    std::unique_lock<std::mutex> lock{mutex};
+    return cv.wait_for(lock, std::chrono::seconds{10}, std::forward<PredicateT>(predicate));
+}
+
+TEST(Test_RpcServerExecutor, single_executor_thread_handles_calls_in_arrival_order_off_the_io_thread)
+{
+    // The state is declared before the participant, so the executor threads are joined before it is destroyed
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<uint8_t> handledCalls;
+    std::vector<std::thread::id> handlerThreads;
+    int numResults{0};
+
+    auto participant = MakeParticipantWithExecutorThreads(1);
+    EXPECT_CALL(participant->GetSilKitConnection(), Mock_SendMsg(testing::_, testing::A<FunctionCall>()))
+        .Times(testing::AnyNumber());
+    EXPECT_CALL(participant->GetSilKitConnection(), Mock_SendMsg(testing::_, testing::A<FunctionCallResponse>()))
+        .Times(testing::AnyNumber());
+
+    SilKit::Services::Rpc::RpcSpec dataSpec{"FunctionA", "application/octet-stream"};
+    participant->CreateRpcServer("RpcServer", dataSpec, [&](IRpcServer* server, RpcCallEvent event) {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            handledCalls.push_back(event.argumentData[0]);
+            handlerThreads.push_back(std::this_thread::get_id());
+        }
+        server->SubmitResult(event.callHandle, event.argumentData);
+    });
+
+    auto* client = participant->CreateRpcClient("RpcClient", dataSpec, [&](IRpcClient*, const RpcCallResultEvent&) {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            ++numResults;
+        }
+        cv.notify_all();
+    });
+
+    constexpr uint8_t numCalls{20};
+    for (uint8_t i = 0; i < numCalls; ++i)
+    {
+        client->Call(std::vector<uint8_t>{i});
+    }
+
+    ASSERT_TRUE(WaitFor(mutex, cv, [&] { return numResults == numCalls; }));
+
+    // The calls are handled in the order they arrived, but not on the thread that received them
+    ASSERT_EQ(handledCalls.size(), numCalls);
+    for (uint8_t i = 0; i < numCalls; ++i)
+    {
+        EXPECT_EQ(handledCalls[i], i);
+        EXPECT_NE(handlerThreads[i], std::this_thread::get_id());
+    }
+}
+
+TEST(Test_RpcServerExecutor, multiple_executor_threads_handle_calls_concurrently)
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    int numRunningHandlers{0};
+    int numConcurrentHandlers{0};
+    int numResults{0};
+
+    auto participant = MakeParticipantWithExecutorThreads(2);
+    EXPECT_CALL(participant->GetSilKitConnection(), Mock_SendMsg(testing::_, testing::A<FunctionCall>()))
+        .Times(testing::AnyNumber());
+    EXPECT_CALL(participant->GetSilKitConnection(), Mock_SendMsg(testing::_, testing::A<FunctionCallResponse>()))
+        .Times(testing::AnyNumber());
+
+    SilKit::Services::Rpc::RpcSpec dataSpec{"FunctionA", "application/octet-stream"};
+    participant->CreateRpcServer("RpcServer", dataSpec, [&](IRpcServer* server, RpcCallEvent event) {
+        {
+            // Every handler waits until the other one is running, too
+            std::unique_lock<std::mutex> lock{mutex};
+            ++numRunningHandlers;
+            cv.notify_all();
+            if (cv.wait_for(lock, std::chrono::seconds{10}, [&] { return numRunningHandlers == 2; }))
+            {
+                ++numConcurrentHandlers;
+            }
+        }
+        server->SubmitResult(event.callHandle, event.argumentData);
+    });
+
+    auto* client = participant->CreateRpcClient("RpcClient", dataSpec, [&](IRpcClient*, const RpcCallResultEvent&) {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            ++numResults;
+        }
+        cv.notify_all();
+    });
+
+    client->Call(std::vector<uint8_t>{1, 2, 3});
+    client->Call(std::vector<uint8_t>{1, 2, 3});
+
+    ASSERT_TRUE(WaitFor(mutex, cv, [&] { return numResults == 2; }));
+    EXPECT_EQ(numConcurrentHandlers, 2);
+}
+
+TEST(Test_RpcServerExecutor, destroyed_rpc_server_internal_drops_only_its_own_pending_calls)
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool isReleased{false};
+    int numHandledCallsA{0};
+    int numHandledCallsB{0};
+
+    SilKit::Core::Tests::MockTimeProvider timeProvider;
+    auto participant = MakeParticipantWithExecutorThreads(1);
+    // The executor is shared by the RpcServerInternals of an RpcServer
+    auto executor = std::make_shared<RpcServerExecutor>(1, "Test", participant->GetLogger());
+
+    auto makeInternal = [&](const std::string& clientUUID, RpcCallHandler handler) {
+        auto internal = std::make_unique<RpcServerInternal>(participant.get(), &timeProvider, "FunctionA",
+                                                            "application/octet-stream",
+                                                            std::vector<SilKit::Services::MatchingLabel>{}, clientUUID,
+                                                            std::move(handler), nullptr);
+        internal->SetExecutor(executor);
+        return internal;
+    };
+    auto internalA = makeInternal("A", [&](IRpcServer*, RpcCallEvent) {
+        std::unique_lock<std::mutex> lock{mutex};
+        ++numHandledCallsA;
+    });
+    auto internalB = makeInternal("B", [&](IRpcServer*, RpcCallEvent) {
+        {
+            // The first call blocks the only worker until the test releases it
+            std::unique_lock<std::mutex> lock{mutex};
+            cv.wait(lock, [&] { return isReleased; });
+            ++numHandledCallsB;
+        }
+        cv.notify_all();
+    });
+
+    internalB->ReceiveMessage(FunctionCall{std::chrono::nanoseconds{1}, SilKit::Util::Uuid{1, 1}, {1}});
+    internalA->ReceiveMessage(FunctionCall{std::chrono::nanoseconds{2}, SilKit::Util::Uuid{2, 2}, {2}});
+    internalB->ReceiveMessage(FunctionCall{std::chrono::nanoseconds{3}, SilKit::Util::Uuid{3, 3}, {3}});
+
+    // The pending call of A is dropped, while the executor keeps handling the calls of B
+    internalA.reset();
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        isReleased = true;
+    }
+    cv.notify_all();
+
+    ASSERT_TRUE(WaitFor(mutex, cv, [&] { return numHandledCallsB == 2; }));
+    EXPECT_EQ(numHandledCallsA, 0);
+}
+
 } // anonymous namespace
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CommandlineParser.hpp"
+
+namespace VSilKit {
+namespace Benchmark {
+
+//! \brief The measurement of one phase of a benchmark scenario.
+struct PhaseResult
+{
+    std::string name;
+    std::uint64_t numEvents{};
+    std::chrono::nanoseconds duration{};
+    //! A benchmark specific count, e.g., of the invoked handlers, which shows that the phase did the expected work
+    std::uint64_t count{};
+};
+
+//! \brief The parameters and phases of one benchmark scenario.
+struct ScenarioResult
+{
+    std::vector<std::pair<std::string, std::uint64_t>> parameters;
+    std::vector<PhaseResult> phases;
+};
+
+//! Runs the function, which returns the count of the phase, and measures its duration.
+template <typename FunctionT>
+auto MeasurePhase(std::string name, std::uint64_t numEvents, FunctionT&& function) -> PhaseResult
+{
+    using Clock = std::chrono::steady_clock;
+
+    const auto start = Clock::now();
+    const std::uint64_t count = function();
+    const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+    return PhaseResult{std::move(name), numEvents, duration, count};
+}
+
+//! Parses a comma separated list of counts, e.g., "10,100,1000".
+inline auto ParseCountList(const std::string& str) -> std::vector<std::uint64_t>
+{
+    std::vector<std::uint64_t> values;
+    std::stringstream stream{str};
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        values.push_back(std::stoull(item));
+    }
+    return values;
+}
+
+//! Writes the results as JSON. The count of each phase is written under the given name.
+inline void WriteJson(std::ostream& out, const std::string& benchmarkName, const std::string& countName,
+                      const std::vector<ScenarioResult>& results)
+{
+    out << "{\n  \"benchmark\": \"" << benchmarkName << "\",\n  \"scenarios\": [";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& result = results[i];
+        out << (i == 0 ? "\n" : ",\n") << "    {\n";
+        for (const auto& parameter : result.parameters)
+        {
+            out << "      \"" << parameter.first << "\": " << parameter.second << ",\n";
+        }
+        out << "      \"phases\": [";
+        for (size_t j = 0; j < result.phases.size(); ++j)
+        {
+            const auto& phase = result.phases[j];
+            const auto nsPerEvent =
+                phase.numEvents == 0 ? 0.0 : static_cast<double>(phase.duration.count()) / phase.numEvents;
+            out << (j == 0 ? "\n" : ",\n") << "        {"
+                << "\"name\": \"" << phase.name << "\", "
+                << "\"events\": " << phase.numEvents << ", "
+                << "\"totalNs\": " << phase.duration.count() << ", "
+                << "\"nsPerEvent\": " << nsPerEvent << ", "
+                << "\"" << countName << "\": " << phase.count << "}";
+        }
+        out << "\n      ]\n    }";
+    }
+    out << "\n  ]\n}\n";
+}
+
+//! Adds the --help and --output options, which are handled by WriteResults.
+inline void AddCommonOptions(SilKit::Util::CommandlineParser& commandlineParser)
+{
+    using CliParser = SilKit::Util::CommandlineParser;
+
+    commandlineParser.Add<CliParser::Flag>("help", "h", "[--help]", "-h, --help: Get this help.");
+    commandlineParser.Add<CliParser::Option>(
+        "output", "o", "", "[--output <filePath>]",
+        "-o, --output <filePath>: Write the JSON results to the given file instead of stdout.");
+}
+
+//! Writes the results to stdout or to the file given by --output. Returns the exit code of the benchmark.
+inline auto WriteResults(SilKit::Util::CommandlineParser& commandlineParser, const std::string& benchmarkName,
+                         const std::string& countName, const std::vector<ScenarioResult>& results) -> int
+{
+    using CliParser = SilKit::Util::CommandlineParser;
+
+    const auto outputPath = commandlineParser.Get<CliParser::Option>("output").Value();
+    if (outputPath.empty())
+    {
+        WriteJson(std::cout, benchmarkName, countName, results);
+        return 0;
+    }
+
+    std::ofstream out{outputPath};
+    WriteJson(out, benchmarkName, countName, results);
+    if (!out)
+    {
+        std::cerr << "Error: Failed to write '" << outputPath << "'" << std::endl;
+        return -1;
+    }
+    return 0;
+}
+
+} // namespace Benchmark
+} // namespace VSilKit
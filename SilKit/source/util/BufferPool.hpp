@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace SilKit {
+namespace Util {
+
+//! \brief A pool of byte buffers which are reused once they are not referenced anymore.
+//!
+//! A buffer returns to the pool when the last reference to it is released, from any thread. The buffers keep their
+//! capacity, so that acquiring a buffer of a size that was used before does not allocate memory. If no unused buffer is
+//! large enough, a new one is allocated and the smaller ones stay in the pool.
+class BufferPool : public std::enable_shared_from_this<BufferPool>
+{
+public:
+    using Buffer = std::vector<uint8_t>;
+
+    //! Creates a pool which keeps at most maxPooledBuffers unused buffers. Surplus buffers are freed.
+    static auto Create(size_t maxPooledBuffers) -> std::shared_ptr<BufferPool>
+    {
+        return std::shared_ptr<BufferPool>{new BufferPool{maxPooledBuffers}};
+    }
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+public:
+    //! Returns a buffer of the given size. Its contents are unspecified.
+    auto Acquire(size_t size) -> std::shared_ptr<Buffer>
+    {
+        std::unique_ptr<Buffer> buffer;
+        {
+            std::unique_lock<decltype(_mutex)> lock{_mutex};
+            // use the smallest buffer which is large enough, resizing a smaller one would reallocate its memory
+            auto it = _buffers.end();
+            for (auto candidate = _buffers.begin(); candidate != _buffers.end(); ++candidate)
+            {
+                if ((*candidate)->capacity() >= size
+                    && (it == _buffers.end() || (*candidate)->capacity() < (*it)->capacity()))
+                {
+                    it = candidate;
+                }
+            }
+            if (it != _buffers.end())
+            {
+                buffer = std::move(*it);
+                _buffers.erase(it);
+            }
+        }
+        if (!buffer)
+        {
+            buffer = std::make_unique<Buffer>();
+        }
+        buffer->resize(size);
+
+        std::weak_ptr<BufferPool> weakPool = shared_from_this();
+        return std::shared_ptr<Buffer>{buffer.release(), [weakPool](Buffer* released) {
+            auto pool = weakPool.lock();
+            if (pool)
+            {
+                pool->Release(std::unique_ptr<Buffer>{released});
+            }
+            else
+            {
+                delete released;
+            }
+        }};
+    }
+
+    //! Returns the number of unused buffers in the pool.
+    auto GetNumPooledBuffers() const -> size_t
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        return _buffers.size();
+    }
+
+private:
+    explicit BufferPool(size_t maxPooledBuffers)
+        : _maxPooledBuffers{maxPooledBuffers}
+    {
+    }
+
+    void Release(std::unique_ptr<Buffer> buffer)
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        if (_buffers.size() < _maxPooledBuffers)
+        {
+            _buffers.push_back(std::move(buffer));
+            return;
+        }
+
+        // keep the larger buffers, which can serve more sizes without a reallocation
+        auto smallest = std::min_element(_buffers.begin(), _buffers.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs->capacity() < rhs->capacity();
+        });
+        if (smallest != _buffers.end() && (*smallest)->capacity() < buffer->capacity())
+        {
+            *smallest = std::move(buffer);
+        }
+    }
+
+private:
+    size_t _maxPooledBuffers;
+
+    mutable std::mutex _mutex;
+    std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+} // namespace Util
+} // namespace SilKit
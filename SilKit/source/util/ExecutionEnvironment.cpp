@@ -8,6 +8,7 @@
 #include "FileHelpers.hpp"
 
 #include <array>
+#include <fstream>
 #include <string>
 #include <thread>
 #include <vector>
@@ -332,6 +333,49 @@ auto GetProcessorCount() -> std::string
 }
 
 
+// Function: GetResidentMemoryBytes
+
+#if defined(__unix__) || defined(__APPLE__)
+#if defined(__linux__)
+
+auto GetResidentMemoryBytesImpl() -> std::uint64_t
+{
+    // The second field of statm is the number of resident pages
+    std::ifstream statm{"/proc/self/statm"};
+    std::uint64_t totalPages{};
+    std::uint64_t residentPages{};
+    if (!(statm >> totalPages >> residentPages))
+    {
+        return 0;
+    }
+    return residentPages * static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+}
+
+#else
+
+auto GetResidentMemoryBytesImpl() -> std::uint64_t
+{
+    return 0;
+}
+
+#endif
+#endif
+
+#ifdef _WIN32
+
+auto GetResidentMemoryBytesImpl() -> std::uint64_t
+{
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters)) != TRUE)
+    {
+        return 0;
+    }
+    return static_cast<std::uint64_t>(counters.WorkingSetSize);
+}
+
+#endif
+
+
 } // namespace
 
 
@@ -351,4 +395,10 @@ auto GetExecutionEnvironment() -> ExecutionEnvironment
 }
 
 
+auto GetResidentMemoryBytes() -> std::uint64_t
+{
+    return GetResidentMemoryBytesImpl();
+}
+
+
 } // namespace VSilKit
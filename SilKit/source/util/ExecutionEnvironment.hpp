@@ -6,6 +6,8 @@
 
 #include <string>
 
+#include <cstdint>
+
 namespace VSilKit {
 
 struct ExecutionEnvironment
@@ -22,4 +24,7 @@ struct ExecutionEnvironment
 
 auto GetExecutionEnvironment() -> ExecutionEnvironment;
 
+//! Returns the resident memory (working set) of the current process in bytes, or zero if it cannot be determined
+auto GetResidentMemoryBytes() -> std::uint64_t;
+
 } // namespace VSilKit
\ No newline at end of file
@@ -0,0 +1,206 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace SilKit {
+namespace Util {
+
+/*! \brief Handle to a deduplicated, reference-counted string stored in a process-wide pool.
+ *
+ * All handles to equal strings share one pool entry. Copying a handle only increments the reference
+ * count and comparing two handles for equality is a pointer comparison. The pool entry is released
+ * once the last handle referring to it is destroyed. The empty string does not occupy a pool entry.
+ */
+class InternedString
+{
+public:
+    InternedString() = default;
+    inline explicit InternedString(const std::string& value);
+    inline InternedString(const InternedString& other) noexcept;
+    inline InternedString(InternedString&& other) noexcept;
+    inline InternedString& operator=(const InternedString& other) noexcept;
+    inline InternedString& operator=(InternedString&& other) noexcept;
+    inline ~InternedString();
+
+    inline auto Str() const -> const std::string&;
+    inline bool Empty() const;
+
+    //! \brief The number of distinct strings currently held by the process-wide pool.
+    inline static auto PoolSize() -> size_t;
+
+    friend bool operator==(const InternedString& lhs, const InternedString& rhs)
+    {
+        return lhs._entry == rhs._entry;
+    }
+
+    friend bool operator!=(const InternedString& lhs, const InternedString& rhs)
+    {
+        return lhs._entry != rhs._entry;
+    }
+
+private:
+    using Entries = std::unordered_map<std::string, std::atomic<uint32_t>>;
+    using Entry = Entries::value_type;
+
+    struct Pool
+    {
+        std::mutex mutex;
+        Entries entries;
+    };
+
+    inline static auto GetPool() -> Pool&;
+    inline static auto Acquire(const std::string& value) -> Entry*;
+    inline static void Release(Entry* entry);
+
+private:
+    Entry* _entry{nullptr};
+};
+
+// ================================================================================
+//  Inline Implementations
+// ================================================================================
+
+InternedString::InternedString(const std::string& value)
+    : _entry{Acquire(value)}
+{
+}
+
+InternedString::InternedString(const InternedString& other) noexcept
+    : _entry{other._entry}
+{
+    if (_entry != nullptr)
+    {
+        _entry->second.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+InternedString::InternedString(InternedString&& other) noexcept
+    : _entry{other._entry}
+{
+    other._entry = nullptr;
+}
+
+InternedString& InternedString::operator=(const InternedString& other) noexcept
+{
+    if (_entry != other._entry)
+    {
+        InternedString copy{other};
+        std::swap(_entry, copy._entry);
+    }
+    return *this;
+}
+
+InternedString& InternedString::operator=(InternedString&& other) noexcept
+{
+    std::swap(_entry, other._entry);
+    return *this;
+}
+
+InternedString::~InternedString()
+{
+    Release(_entry);
+}
+
+auto InternedString::Str() const -> const std::string&
+{
+    static const std::string empty;
+    return _entry == nullptr ? empty : _entry->first;
+}
+
+bool InternedString::Empty() const
+{
+    return _entry == nullptr;
+}
+
+auto InternedString::PoolSize() -> size_t
+{
+    auto& pool = GetPool();
+    std::lock_guard<std::mutex> lock{pool.mutex};
+    return pool.entries.size();
+}
+
+auto InternedString::GetPool() -> Pool&
+{
+    // Intentionally leaked, handles in objects with static storage duration may outlive any static pool.
+    static auto* pool = new Pool{};
+    return *pool;
+}
+
+auto InternedString::Acquire(const std::string& value) -> Entry*
+{
+    if (value.empty())
+    {
+        return nullptr;
+    }
+
+    auto& pool = GetPool();
+    std::lock_guard<std::mutex> lock{pool.mutex};
+
+    auto it = pool.entries.find(value);
+    if (it == pool.entries.end())
+    {
+        it = pool.entries.emplace(std::piecewise_construct, std::forward_as_tuple(value), std::forward_as_tuple(0u))
+                 .first;
+    }
+
+    it->second.fetch_add(1, std::memory_order_relaxed);
+    return &*it;
+}
+
+void InternedString::Release(Entry* entry)
+{
+    if (entry == nullptr)
+    {
+        return;
+    }
+
+    // Dropping a reference that is not the last one does not need the pool lock. Other handles can only be
+    // created from an existing handle or through Acquire, which holds the lock.
+    auto count = entry->second.load(std::memory_order_relaxed);
+    while (count > 1)
+    {
+        if (entry->second.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+
+    auto& pool = GetPool();
+    std::lock_guard<std::mutex> lock{pool.mutex};
+
+    if (entry->second.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        pool.entries.erase(pool.entries.find(entry->first));
+    }
+}
+
+} // namespace Util
+} // namespace SilKit
@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "silkit/services/logging/ILogger.hpp"
+
+#include "SetThreadName.hpp"
+
+namespace SilKit {
+namespace Util {
+
+//! \brief A thread which periodically invokes the callbacks of all its users.
+//!
+//! All users of the same period and thread name share a single thread per process, which exists as long as any user
+//! holds it. This keeps the number of threads independent of the number of participants in a process, e.g., for the
+//! watchdogs of the time synchronization and the metrics timers. The callbacks run one after another, so they must
+//! not block. Users with blocking work, like the handlers of the watchdog, hand it off to their own threads.
+class SharedPeriodicThread
+{
+public:
+    using Callback = std::function<void()>;
+
+    //! Returns the thread for the given period and thread name.
+    static auto Get(std::chrono::milliseconds period, const std::string& threadName)
+        -> std::shared_ptr<SharedPeriodicThread>
+    {
+        static std::mutex instancesMutex;
+        static std::map<std::pair<std::chrono::milliseconds, std::string>, std::weak_ptr<SharedPeriodicThread>>
+            instances;
+
+        std::unique_lock<decltype(instancesMutex)> lock{instancesMutex};
+        auto& weakInstance = instances[std::make_pair(period, threadName)];
+        auto instance = weakInstance.lock();
+        if (!instance)
+        {
+            instance = std::shared_ptr<SharedPeriodicThread>{new SharedPeriodicThread{period, threadName}};
+            weakInstance = instance;
+        }
+        return instance;
+    }
+
+    ~SharedPeriodicThread()
+    {
+        {
+            std::unique_lock<decltype(_state->mutex)> lock{_state->mutex};
+            _state->stopRequested = true;
+        }
+        _state->stopCondition.notify_all();
+
+        if (std::this_thread::get_id() == _thread.get_id())
+        {
+            // The last user released the thread from within a callback. The thread cannot join itself, it ends on its
+            // own after the callback returns, because it only accesses the state it shares with this object.
+            _thread.detach();
+        }
+        else
+        {
+            _thread.join();
+        }
+    }
+
+    SharedPeriodicThread(const SharedPeriodicThread&) = delete;
+    SharedPeriodicThread& operator=(const SharedPeriodicThread&) = delete;
+
+public:
+    //! Registers a callback under the given key. It is invoked once per period, starting with the next period.
+    //! Exceptions thrown by the callback are logged to the given logger, if any.
+    void Add(const void* key, Callback callback, Services::Logging::ILogger* logger)
+    {
+        std::unique_lock<decltype(_state->mutex)> lock{_state->mutex};
+        _state->entries.emplace_back(std::make_shared<const Entry>(Entry{key, std::move(callback), logger}));
+    }
+
+    //! Unregisters the callback of the given key. The callback is not running anymore when this function returns,
+    //! unless it is called from within a callback of this thread.
+    void Remove(const void* key)
+    {
+        auto& state = *_state;
+
+        std::unique_lock<decltype(state.mutex)> lock{state.mutex};
+        state.entries.erase(
+            std::remove_if(state.entries.begin(), state.entries.end(),
+                           [key](const std::shared_ptr<const Entry>& entry) { return entry->key == key; }),
+            state.entries.end());
+
+        if (std::this_thread::get_id() != _thread.get_id())
+        {
+            state.callbackFinished.wait(lock, [&state, key] { return state.runningKey != key; });
+        }
+    }
+
+private:
+    struct Entry
+    {
+        const void* key;
+        Callback callback;
+        Services::Logging::ILogger* logger;
+    };
+
+    //! Everything the thread accesses. It is shared with the thread, which may outlive this object (see destructor).
+    struct State
+    {
+        State(std::chrono::milliseconds period, std::string threadName)
+            : period{period}
+            , threadName{std::move(threadName)}
+        {
+        }
+
+        const std::chrono::milliseconds period;
+        const std::string threadName;
+
+        std::mutex mutex;
+        std::condition_variable stopCondition;
+        std::condition_variable callbackFinished;
+        bool stopRequested{false};
+        std::vector<std::shared_ptr<const Entry>> entries;
+        const void* runningKey{nullptr};
+    };
+
+    SharedPeriodicThread(std::chrono::milliseconds period, std::string threadName)
+        : _state{std::make_shared<State>(period, std::move(threadName))}
+        , _thread{&SharedPeriodicThread::Run, _state}
+    {
+    }
+
+    static void Run(std::shared_ptr<State> statePtr)
+    {
+        auto& state = *statePtr;
+
+        SetThreadName(state.threadName);
+
+        std::unique_lock<decltype(state.mutex)> lock{state.mutex};
+        while (!state.stopCondition.wait_for(lock, state.period, [&state] { return state.stopRequested; }))
+        {
+            // The callbacks run without holding the lock, so they can add and remove callbacks themselves
+            const auto entries = state.entries;
+            for (const auto& entry : entries)
+            {
+                if (state.stopRequested)
+                {
+                    // the last user released the thread from within a previous callback of this period
+                    break;
+                }
+                if (std::find(state.entries.begin(), state.entries.end(), entry) == state.entries.end())
+                {
+                    // removed by a previous callback of this period
+                    continue;
+                }
+
+                state.runningKey = entry->key;
+                lock.unlock();
+                Invoke(state, *entry);
+                lock.lock();
+                state.runningKey = nullptr;
+                state.callbackFinished.notify_all();
+            }
+        }
+    }
+
+    static void Invoke(const State& state, const Entry& entry)
+    {
+        // an exception of one user must neither affect the other users nor terminate the thread
+        try
+        {
+            entry.callback();
+        }
+        catch (const std::exception& e)
+        {
+            LogCallbackException(state, entry, e.what());
+        }
+        catch (...)
+        {
+            LogCallbackException(state, entry, "unknown exception");
+        }
+    }
+
+    static void LogCallbackException(const State& state, const Entry& entry, const char* what)
+    {
+        if (entry.logger != nullptr)
+        {
+            entry.logger->Error(std::string{"SharedPeriodicThread '"} + state.threadName
+                                + "': Callback threw an exception: " + what);
+        }
+    }
+
+private:
+    std::shared_ptr<State> _state;
+
+    // The thread must be the last member. This ensures that it is started after the state is initialized.
+    std::thread _thread;
+};
+
+} // namespace Util
+} // namespace SilKit
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace SilKit {
+namespace Util {
+
+//! \brief A bounded lock-free queue for one producer thread and one consumer thread.
+//!
+//! If the queue is full, either the pushed element or the oldest element in the queue is discarded. To discard the
+//! oldest element, the producer advances the read position, which is the only position both threads modify. The slot
+//! of an element is only accessed by the thread which advanced the read position past it, or by the producer after
+//! the consumer finished with it. The consumer never waits, the producer waits for the consumer to finish taking an
+//! element only if it needs the slot of that element.
+template <typename T>
+class SpscRingBuffer
+{
+public:
+    enum class OverflowPolicy
+    {
+        DropOldest,
+        DropNewest,
+    };
+
+    SpscRingBuffer(size_t capacity, OverflowPolicy overflowPolicy)
+        : _slots(capacity + 1)
+        , _capacity{capacity}
+        , _overflowPolicy{overflowPolicy}
+    {
+    }
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+public:
+    //! Enqueues an element. Returns false if an element was discarded. Must only be called by the producer.
+    bool Push(T element)
+    {
+        const auto tail = _tail.load(std::memory_order_relaxed);
+        auto head = _head.load();
+
+        bool discarded{false};
+        if (tail - head == _capacity)
+        {
+            if (_overflowPolicy == OverflowPolicy::DropNewest || _capacity == 0)
+            {
+                return false;
+            }
+            // The slot of the new element is the one of the element the consumer took last. It could still be reading
+            // it, so wait before discarding the oldest element, which must only happen if the new one is stored.
+            while (IsConsumerReading(tail))
+            {
+                std::this_thread::yield();
+            }
+            // if the consumer takes the oldest element concurrently, it already made room
+            if (_head.compare_exchange_strong(head, head + 1))
+            {
+                discarded = true;
+            }
+        }
+
+        _slots[SlotIndex(tail)] = std::move(element);
+        _tail.store(tail + 1);
+        return !discarded;
+    }
+
+    //! Dequeues the oldest element. Returns false if the queue is empty. Must only be called by the consumer.
+    bool TryPop(T& element)
+    {
+        auto head = _head.load();
+        do
+        {
+            if (head == _tail.load())
+            {
+                _consumerReading.store(notReading);
+                return false;
+            }
+            _consumerReading.store(head);
+        } while (!_head.compare_exchange_weak(head, head + 1));
+
+        element = std::move(_slots[SlotIndex(head)]);
+        _slots[SlotIndex(head)] = T{};
+        _consumerReading.store(notReading);
+        return true;
+    }
+
+    auto Capacity() const -> size_t
+    {
+        return _capacity;
+    }
+
+private:
+    auto SlotIndex(size_t position) const -> size_t
+    {
+        return position % _slots.size();
+    }
+
+    bool IsConsumerReading(size_t position) const
+    {
+        const auto consumerReading = _consumerReading.load();
+        return consumerReading != notReading && SlotIndex(consumerReading) == SlotIndex(position);
+    }
+
+private:
+    static constexpr size_t notReading{(std::numeric_limits<size_t>::max)()};
+
+    std::vector<T> _slots;
+    size_t _capacity;
+    OverflowPolicy _overflowPolicy;
+
+    std::atomic<size_t> _head{0};
+    std::atomic<size_t> _tail{0};
+    std::atomic<size_t> _consumerReading{notReading};
+};
+
+template <typename T>
+constexpr size_t SpscRingBuffer<T>::notReading;
+
+} // namespace Util
+} // namespace SilKit
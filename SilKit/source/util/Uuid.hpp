@@ -26,6 +26,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <cstdint>
 
+#include "Hash.hpp"
+
 namespace SilKit {
 namespace Util {
 
@@ -47,5 +49,14 @@ auto operator<<(std::ostream& ostream, const Uuid& uuid) -> std::ostream&;
 
 auto to_string(const Uuid& uuid) -> std::string;
 
+//! Hash function for using Uuids as keys of unordered containers.
+struct UuidHash
+{
+    std::size_t operator()(const Uuid& uuid) const
+    {
+        return static_cast<std::size_t>(Hash::HashCombine(uuid.ab, uuid.cd));
+    }
+};
+
 } // namespace Util
 } // namespace SilKit
\ No newline at end of file
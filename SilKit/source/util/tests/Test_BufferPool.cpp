@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include "BufferPool.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+namespace {
+
+using SilKit::Util::BufferPool;
+
+TEST(Test_BufferPool, released_buffers_are_reused)
+{
+    auto pool = BufferPool::Create(4);
+
+    auto buffer = pool->Acquire(1024);
+    ASSERT_EQ(buffer->size(), 1024u);
+    const auto* data = buffer->data();
+    EXPECT_EQ(pool->GetNumPooledBuffers(), 0u);
+
+    buffer.reset();
+    EXPECT_EQ(pool->GetNumPooledBuffers(), 1u);
+
+    // a smaller buffer fits into the capacity of the released one
+    buffer = pool->Acquire(512);
+    EXPECT_EQ(buffer->size(), 512u);
+    EXPECT_EQ(buffer->data(), data);
+    EXPECT_EQ(pool->GetNumPooledBuffers(), 0u);
+}
+
+TEST(Test_BufferPool, prefers_buffers_which_are_large_enough)
+{
+    auto pool = BufferPool::Create(4);
+
+    auto large = pool->Acquire(4096);
+    auto small = pool->Acquire(16);
+    const auto* largeData = large->data();
+    large.reset();
+    small.reset();
+
+    auto buffer = pool->Acquire(2048);
+    EXPECT_EQ(buffer->data(), largeData);
+}
+
+TEST(Test_BufferPool, allocates_a_new_buffer_if_none_is_large_enough)
+{
+    auto pool = BufferPool::Create(4);
+
+    auto small = pool->Acquire(16);
+    const auto* smallData = small->data();
+    small.reset();
+
+    // the small buffer is not resized, but stays available for small sizes
+    auto large = pool->Acquire(4096);
+    const auto* largeData = large->data();
+    EXPECT_NE(largeData, smallData);
+    EXPECT_EQ(pool->GetNumPooledBuffers(), 1u);
+    large.reset();
+    EXPECT_EQ(pool->GetNumPooledBuffers(), 2u);
+
+    small = pool->Acquire(16);
+    large = pool->Acquire(4096);
+    EXPECT_EQ(small->data(), smallData);
+    EXPECT_EQ(large->data(), largeData);
+    EXPECT_EQ(pool->GetNumPooledBuffers(), 0u);
+}
+
+TEST(Test_BufferPool, a_full_pool_keeps_the_larger_buffers)
+{
+    auto pool = BufferPool::Create(1);
+
+    pool->Acquire(16).reset();
+    auto large = pool->Acquire(4096);
+    const auto* largeData = large->data();
+    large.reset();
+    EXPECT_EQ(pool->GetNumPooledBuffers(), 1u);
+
+    // the pooled buffer is the large one, the small one was freed
+    large = pool->Acquire(4096);
+    EXPECT_EQ(large->data(), largeData);
+    EXPECT_EQ(pool->GetNumPooledBuffers(), 0u);
+}
+
+TEST(Test_BufferPool, keeps_at_most_the_maximum_number_of_buffers)
+{
+    auto pool = BufferPool::Create(2);
+
+    std::vector<std::shared_ptr<BufferPool::Buffer>> buffers;
+    for (auto i = 0; i < 5; ++i)
+    {
+        buffers.push_back(pool->Acquire(8));
+    }
+    buffers.clear();
+
+    EXPECT_EQ(pool->GetNumPooledBuffers(), 2u);
+}
+
+TEST(Test_BufferPool, buffers_may_outlive_the_pool)
+{
+    auto pool = BufferPool::Create(2);
+    auto buffer = pool->Acquire(8);
+    pool.reset();
+
+    (*buffer)[7] = 42;
+    buffer.reset();
+}
+
+} // namespace
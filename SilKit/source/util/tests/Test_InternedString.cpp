@@ -0,0 +1,106 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "InternedString.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using SilKit::Util::InternedString;
+
+TEST(Test_InternedString, equal_strings_share_one_entry)
+{
+    const auto poolSize = InternedString::PoolSize();
+
+    InternedString a{std::string{"Test_InternedString::equal"}};
+    InternedString b{std::string{"Test_InternedString::equal"}};
+    InternedString c{std::string{"Test_InternedString::other"}};
+
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(&a.Str(), &b.Str());
+    EXPECT_EQ(a.Str(), "Test_InternedString::equal");
+    EXPECT_EQ(InternedString::PoolSize(), poolSize + 2);
+}
+
+TEST(Test_InternedString, empty_string_has_no_entry)
+{
+    const auto poolSize = InternedString::PoolSize();
+
+    InternedString a;
+    InternedString b{std::string{}};
+
+    EXPECT_TRUE(a.Empty());
+    EXPECT_TRUE(b.Empty());
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.Str(), "");
+    EXPECT_EQ(InternedString::PoolSize(), poolSize);
+}
+
+TEST(Test_InternedString, entry_is_released_with_last_handle)
+{
+    const auto poolSize = InternedString::PoolSize();
+    {
+        InternedString a{std::string{"Test_InternedString::release"}};
+        {
+            InternedString b{a};
+            InternedString c;
+            c = b;
+            InternedString d{std::move(c)};
+            EXPECT_TRUE(c.Empty());
+            EXPECT_EQ(d, a);
+        }
+        EXPECT_EQ(InternedString::PoolSize(), poolSize + 1);
+    }
+    EXPECT_EQ(InternedString::PoolSize(), poolSize);
+}
+
+TEST(Test_InternedString, concurrent_acquire_and_release)
+{
+    const auto poolSize = InternedString::PoolSize();
+
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([] {
+            for (auto i = 0; i < 10000; ++i)
+            {
+                InternedString a{"Test_InternedString::concurrent" + std::to_string(i % 7)};
+                InternedString b{a};
+                EXPECT_EQ(a, b);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(InternedString::PoolSize(), poolSize);
+}
+
+} // namespace
@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <future>
+
+#include "SharedPeriodicThread.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using SilKit::Util::SharedPeriodicThread;
+using SilKit::Services::Logging::Level;
+
+using testing::HasSubstr;
+
+class MockLogger : public SilKit::Services::Logging::ILogger
+{
+public:
+    MOCK_METHOD2(Log, void(Level, const std::string&));
+    MOCK_METHOD1(Trace, void(const std::string&));
+    MOCK_METHOD1(Debug, void(const std::string&));
+    MOCK_METHOD1(Info, void(const std::string&));
+    MOCK_METHOD1(Warn, void(const std::string&));
+    MOCK_METHOD1(Error, void(const std::string&));
+    MOCK_METHOD1(Critical, void(const std::string&));
+
+    MOCK_CONST_METHOD0(GetLogLevel, Level());
+};
+
+TEST(Test_SharedPeriodicThread, users_of_the_same_period_share_the_thread)
+{
+    auto thread1 = SharedPeriodicThread::Get(5ms, "Test");
+    auto thread2 = SharedPeriodicThread::Get(5ms, "Test");
+    auto thread3 = SharedPeriodicThread::Get(7ms, "Test");
+
+    EXPECT_EQ(thread1, thread2);
+    EXPECT_NE(thread1, thread3);
+}
+
+TEST(Test_SharedPeriodicThread, users_of_different_thread_names_do_not_share_the_thread)
+{
+    auto thread1 = SharedPeriodicThread::Get(5ms, "Test");
+    auto thread2 = SharedPeriodicThread::Get(5ms, "Other");
+
+    EXPECT_NE(thread1, thread2);
+}
+
+TEST(Test_SharedPeriodicThread, invokes_all_callbacks_until_removed)
+{
+    auto thread = SharedPeriodicThread::Get(1ms, "Test");
+
+    std::atomic<int> numCalls1{0};
+    std::atomic<int> numCalls2{0};
+    std::promise<void> bothCalled;
+    std::atomic<bool> bothCalledSet{false};
+
+    thread->Add(&numCalls1, [&numCalls1] { ++numCalls1; }, nullptr);
+    thread->Add(&numCalls2, [&] {
+        // throwing callbacks do not affect the other users
+        if (++numCalls2 == 1)
+        {
+            throw std::runtime_error{"callback failed"};
+        }
+        if (numCalls1 > 1 && !bothCalledSet.exchange(true))
+        {
+            bothCalled.set_value();
+        }
+    }, nullptr);
+
+    ASSERT_EQ(bothCalled.get_future().wait_for(10s), std::future_status::ready);
+
+    thread->Remove(&numCalls1);
+    const auto numCallsAfterRemove = numCalls1.load();
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(numCalls1, numCallsAfterRemove);
+
+    thread->Remove(&numCalls2);
+}
+
+TEST(Test_SharedPeriodicThread, thread_is_recreated_after_the_last_user_is_gone)
+{
+    std::promise<void> called;
+    {
+        auto thread = SharedPeriodicThread::Get(3ms, "Test");
+        thread->Add(&called, [] {}, nullptr);
+        thread->Remove(&called);
+    }
+
+    auto thread = SharedPeriodicThread::Get(3ms, "Test");
+    std::atomic<bool> calledSet{false};
+    thread->Add(&called, [&] {
+        if (!calledSet.exchange(true))
+        {
+            called.set_value();
+        }
+    }, nullptr);
+    EXPECT_EQ(called.get_future().wait_for(10s), std::future_status::ready);
+    thread->Remove(&called);
+}
+
+TEST(Test_SharedPeriodicThread, exceptions_of_callbacks_are_logged)
+{
+    auto thread = SharedPeriodicThread::Get(1ms, "Test");
+
+    MockLogger logger;
+    std::promise<void> logged;
+    std::atomic<bool> loggedSet{false};
+    EXPECT_CALL(logger, Error(HasSubstr("callback failed"))).WillRepeatedly([&](const std::string&) {
+        if (!loggedSet.exchange(true))
+        {
+            logged.set_value();
+        }
+    });
+
+    thread->Add(&logger, [] { throw std::runtime_error{"callback failed"}; }, &logger);
+    EXPECT_EQ(logged.get_future().wait_for(10s), std::future_status::ready);
+    thread->Remove(&logger);
+}
+
+TEST(Test_SharedPeriodicThread, callbacks_can_add_and_remove_callbacks)
+{
+    auto thread = SharedPeriodicThread::Get(1ms, "Test");
+
+    std::atomic<int> numCalls{0};
+    std::atomic<int> numAddedCalls{0};
+    std::promise<void> addedCalled;
+
+    const int addedKey{};
+    thread->Add(&numCalls, [&] {
+        if (++numCalls == 1)
+        {
+            // both would deadlock if the callbacks were invoked while holding the lock of the thread
+            thread->Add(&addedKey, [&] {
+                if (++numAddedCalls == 1)
+                {
+                    addedCalled.set_value();
+                }
+            }, nullptr);
+            thread->Remove(&numCalls);
+        }
+    }, nullptr);
+
+    ASSERT_EQ(addedCalled.get_future().wait_for(10s), std::future_status::ready);
+    thread->Remove(&addedKey);
+    EXPECT_EQ(numCalls, 1);
+}
+
+TEST(Test_SharedPeriodicThread, remove_waits_for_the_running_callback)
+{
+    auto thread = SharedPeriodicThread::Get(1ms, "Test");
+
+    std::promise<void> started;
+    std::atomic<bool> startedSet{false};
+    std::atomic<bool> finished{false};
+    thread->Add(&finished, [&] {
+        if (!startedSet.exchange(true))
+        {
+            started.set_value();
+            std::this_thread::sleep_for(50ms);
+            finished = true;
+        }
+    }, nullptr);
+
+    ASSERT_EQ(started.get_future().wait_for(10s), std::future_status::ready);
+    thread->Remove(&finished);
+    EXPECT_TRUE(finished);
+}
+
+TEST(Test_SharedPeriodicThread, last_user_can_release_the_thread_from_a_callback)
+{
+    auto thread = SharedPeriodicThread::Get(1ms, "Test");
+
+    std::promise<void> released;
+    std::atomic<bool> releasedSet{false};
+    thread->Add(&released, [&] {
+        if (!releasedSet.exchange(true))
+        {
+            // the destructor of the thread runs on the thread itself and must not join it
+            thread->Remove(&released);
+            thread.reset();
+            released.set_value();
+        }
+    }, nullptr);
+
+    ASSERT_EQ(released.get_future().wait_for(10s), std::future_status::ready);
+
+    // a new thread is started for the next user
+    std::promise<void> called;
+    std::atomic<bool> calledSet{false};
+    auto newThread = SharedPeriodicThread::Get(1ms, "Test");
+    newThread->Add(&called, [&] {
+        if (!calledSet.exchange(true))
+        {
+            called.set_value();
+        }
+    }, nullptr);
+    EXPECT_EQ(called.get_future().wait_for(10s), std::future_status::ready);
+    newThread->Remove(&called);
+}
+
+} // namespace
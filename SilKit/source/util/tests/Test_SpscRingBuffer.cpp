@@ -0,0 +1,211 @@
+// SPDX-FileCopyrightText: 2024 Vector Informatik GmbH
+//
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "SpscRingBuffer.hpp"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+namespace {
+
+using SilKit::Util::SpscRingBuffer;
+using OverflowPolicy = SpscRingBuffer<int>::OverflowPolicy;
+
+auto PopAll(SpscRingBuffer<int>& ringBuffer) -> std::vector<int>
+{
+    std::vector<int> elements;
+    int element{};
+    while (ringBuffer.TryPop(element))
+    {
+        elements.push_back(element);
+    }
+    return elements;
+}
+
+TEST(Test_SpscRingBuffer, pops_in_push_order)
+{
+    SpscRingBuffer<int> ringBuffer{3, OverflowPolicy::DropNewest};
+
+    int element{};
+    EXPECT_FALSE(ringBuffer.TryPop(element));
+
+    for (auto round = 0; round < 3; ++round)
+    {
+        EXPECT_TRUE(ringBuffer.Push(1));
+        EXPECT_TRUE(ringBuffer.Push(2));
+        EXPECT_THAT(PopAll(ringBuffer), testing::ElementsAre(1, 2));
+    }
+}
+
+TEST(Test_SpscRingBuffer, drop_newest_discards_the_pushed_element)
+{
+    SpscRingBuffer<int> ringBuffer{3, OverflowPolicy::DropNewest};
+
+    for (auto i = 1; i <= 3; ++i)
+    {
+        EXPECT_TRUE(ringBuffer.Push(i));
+    }
+    EXPECT_FALSE(ringBuffer.Push(4));
+
+    EXPECT_THAT(PopAll(ringBuffer), testing::ElementsAre(1, 2, 3));
+}
+
+TEST(Test_SpscRingBuffer, drop_oldest_discards_the_oldest_element)
+{
+    SpscRingBuffer<int> ringBuffer{3, OverflowPolicy::DropOldest};
+
+    for (auto i = 1; i <= 3; ++i)
+    {
+        EXPECT_TRUE(ringBuffer.Push(i));
+    }
+    EXPECT_FALSE(ringBuffer.Push(4));
+    EXPECT_FALSE(ringBuffer.Push(5));
+
+    EXPECT_THAT(PopAll(ringBuffer), testing::ElementsAre(3, 4, 5));
+}
+
+TEST(Test_SpscRingBuffer, popped_elements_are_released_from_the_buffer)
+{
+    SpscRingBuffer<std::shared_ptr<int>> ringBuffer{2, SpscRingBuffer<std::shared_ptr<int>>::OverflowPolicy::DropOldest};
+
+    auto shared = std::make_shared<int>(42);
+    ringBuffer.Push(shared);
+    EXPECT_EQ(shared.use_count(), 2);
+
+    std::shared_ptr<int> popped;
+    ASSERT_TRUE(ringBuffer.TryPop(popped));
+    popped.reset();
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(Test_SpscRingBuffer, concurrent_producer_and_consumer_keep_the_order)
+{
+    for (auto overflowPolicy : {OverflowPolicy::DropOldest, OverflowPolicy::DropNewest})
+    {
+        SpscRingBuffer<int> ringBuffer{8, overflowPolicy};
+        const int numElements{100000};
+        std::atomic<bool> producerDone{false};
+
+        std::thread producer{[&ringBuffer, &producerDone, numElements] {
+            for (auto i = 1; i <= numElements; ++i)
+            {
+                ringBuffer.Push(i);
+            }
+            producerDone = true;
+        }};
+
+        // The elements are strictly increasing, even if some of them were discarded
+        int last{0};
+        int element{0};
+        while (true)
+        {
+            const auto done = producerDone.load();
+            if (ringBuffer.TryPop(element))
+            {
+                EXPECT_GT(element, last);
+                last = element;
+            }
+            else if (done)
+            {
+                break;
+            }
+        }
+
+        producer.join();
+        EXPECT_LE(last, numElements);
+    }
+}
+
+//! Yields while the consumer takes it out of the buffer, which lets the producer run while the consumer reads its slot
+struct YieldingElement
+{
+    static thread_local bool isConsumer;
+
+    int value{};
+
+    YieldingElement() = default;
+    YieldingElement(int value)
+        : value{value}
+    {
+    }
+    YieldingElement(YieldingElement&& other) noexcept
+        : value{other.value}
+    {
+    }
+    YieldingElement& operator=(YieldingElement&& other) noexcept
+    {
+        if (isConsumer)
+        {
+            std::this_thread::yield();
+        }
+        value = other.value;
+        return *this;
+    }
+};
+
+thread_local bool YieldingElement::isConsumer{false};
+
+TEST(Test_SpscRingBuffer, concurrent_drop_oldest_discards_one_element_per_failed_push)
+{
+    // The slot of a new element in a full queue is the one the consumer took last, small queues hit this most often
+    for (size_t capacity : {1u, 2u, 3u})
+    {
+        using YieldingRingBuffer = SpscRingBuffer<YieldingElement>;
+        YieldingRingBuffer ringBuffer{capacity, YieldingRingBuffer::OverflowPolicy::DropOldest};
+        const int numElements{20000};
+        std::atomic<bool> producerDone{false};
+        int numFailedPushes{0};
+
+        std::thread producer{[&ringBuffer, &producerDone, &numFailedPushes, capacity, numElements] {
+            for (auto i = 1; i <= numElements; ++i)
+            {
+                if (!ringBuffer.Push(i))
+                {
+                    ++numFailedPushes;
+                }
+                // Fill the queue while the consumer is taking an element
+                if (i % (capacity + 1) == 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+            producerDone = true;
+        }};
+
+        YieldingElement::isConsumer = true;
+        int numPopped{0};
+        int last{0};
+        YieldingElement element;
+        while (true)
+        {
+            const auto done = producerDone.load();
+            if (ringBuffer.TryPop(element))
+            {
+                EXPECT_GT(element.value, last);
+                last = element.value;
+                ++numPopped;
+            }
+            else if (done)
+            {
+                break;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        YieldingElement::isConsumer = false;
+
+        producer.join();
+        // Every element is either taken or reported as discarded, and the latest element is never discarded
+        EXPECT_EQ(numPopped + numFailedPushes, numElements);
+        EXPECT_EQ(last, numElements);
+    }
+}
+
+} // namespace
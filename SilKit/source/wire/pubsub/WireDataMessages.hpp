@@ -27,6 +27,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "SharedVector.hpp"
 
 #include <chrono>
+#include <sstream>
 #include <vector>
 
 namespace SilKit {
@@ -39,12 +40,26 @@ struct WireDataMessageEvent
     Util::SharedVector<uint8_t> data;
 };
 
+/*! \brief Several data samples of one publisher, which are transmitted as a single message
+ *
+ * The samples are stored back to back in data, sampleSizes holds the size of each of them.
+ */
+struct WireDataMessageBatch
+{
+    std::chrono::nanoseconds timestamp;
+    Util::SharedVector<uint8_t> data;
+    std::vector<uint32_t> sampleSizes;
+};
+
 inline auto ToDataMessageEvent(const WireDataMessageEvent& wireDataMessageEvent) -> DataMessageEvent;
 inline auto MakeWireDataMessageEvent(const DataMessageEvent& dataMessageEvent) -> WireDataMessageEvent;
 
 inline std::string to_string(const WireDataMessageEvent& msg);
 inline std::ostream& operator<<(std::ostream& out, const WireDataMessageEvent& msg);
 
+inline std::string to_string(const WireDataMessageBatch& msg);
+inline std::ostream& operator<<(std::ostream& out, const WireDataMessageBatch& msg);
+
 // ================================================================================
 //  Inline Implementations
 // ================================================================================
@@ -69,6 +84,19 @@ std::ostream& operator<<(std::ostream& out, const WireDataMessageEvent& msg)
     return out << ToDataMessageEvent(msg);
 }
 
+std::string to_string(const WireDataMessageBatch& msg)
+{
+    std::stringstream out;
+    out << msg;
+    return out.str();
+}
+
+std::ostream& operator<<(std::ostream& out, const WireDataMessageBatch& msg)
+{
+    return out << "PubSub::WireDataMessageBatch{samples=" << msg.sampleSizes.size()
+               << ", size=" << msg.data.AsSpan().size() << "}";
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace SilKit
@@ -64,8 +64,26 @@ struct FunctionCallResponse
     Status status;
 };
 
+/*! \brief Several Rpcs of one client, which are transmitted as a single message
+ *
+ * The calls are handled in the order they are contained in the batch.
+ */
+struct FunctionCallBatch
+{
+    std::vector<FunctionCall> calls;
+};
+
+/*! \brief The responses to several Rpcs of one client, which are transmitted as a single message
+ */
+struct FunctionCallResponseBatch
+{
+    std::vector<FunctionCallResponse> responses;
+};
+
 inline bool operator==(const FunctionCall& lhs, const FunctionCall& rhs);
 inline bool operator==(const FunctionCallResponse& lhs, const FunctionCallResponse& rhs);
+inline bool operator==(const FunctionCallBatch& lhs, const FunctionCallBatch& rhs);
+inline bool operator==(const FunctionCallResponseBatch& lhs, const FunctionCallResponseBatch& rhs);
 
 inline std::string to_string(const FunctionCall& msg);
 inline std::ostream& operator<<(std::ostream& out, const FunctionCall& msg);
@@ -76,6 +94,12 @@ inline std::ostream& operator<<(std::ostream& out, const FunctionCallResponse::S
 inline std::string to_string(const FunctionCallResponse& msg);
 inline std::ostream& operator<<(std::ostream& out, const FunctionCallResponse& msg);
 
+inline std::string to_string(const FunctionCallBatch& msg);
+inline std::ostream& operator<<(std::ostream& out, const FunctionCallBatch& msg);
+
+inline std::string to_string(const FunctionCallResponseBatch& msg);
+inline std::ostream& operator<<(std::ostream& out, const FunctionCallResponseBatch& msg);
+
 // ================================================================================
 //  Inline Implementations
 // ================================================================================
@@ -90,6 +114,16 @@ bool operator==(const FunctionCallResponse& lhs, const FunctionCallResponse& rhs
     return lhs.callUuid == rhs.callUuid && lhs.data == rhs.data && lhs.status == rhs.status;
 }
 
+bool operator==(const FunctionCallBatch& lhs, const FunctionCallBatch& rhs)
+{
+    return lhs.calls == rhs.calls;
+}
+
+bool operator==(const FunctionCallResponseBatch& lhs, const FunctionCallResponseBatch& rhs)
+{
+    return lhs.responses == rhs.responses;
+}
+
 std::string to_string(const FunctionCall& msg)
 {
     std::stringstream out;
@@ -139,6 +173,40 @@ std::ostream& operator<<(std::ostream& out, const FunctionCallResponse& msg)
                << ", size=" << msg.data.size() << ", status=" << msg.status << "}";
 }
 
+std::string to_string(const FunctionCallBatch& msg)
+{
+    std::stringstream out;
+    out << msg;
+    return out.str();
+}
+
+std::ostream& operator<<(std::ostream& out, const FunctionCallBatch& msg)
+{
+    out << "rpc::FunctionCallBatch{calls=" << msg.calls.size();
+    if (!msg.calls.empty())
+    {
+        out << ", firstCallUUID=" << msg.calls.front().callUuid;
+    }
+    return out << "}";
+}
+
+std::string to_string(const FunctionCallResponseBatch& msg)
+{
+    std::stringstream out;
+    out << msg;
+    return out.str();
+}
+
+std::ostream& operator<<(std::ostream& out, const FunctionCallResponseBatch& msg)
+{
+    out << "rpc::FunctionCallResponseBatch{responses=" << msg.responses.size();
+    if (!msg.responses.empty())
+    {
+        out << ", firstCallUUID=" << msg.responses.front().callUuid;
+    }
+    return out << "}";
+}
+
 } // namespace Rpc
 } // namespace Services
 } // namespace SilKit
@@ -26,6 +26,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <chrono>
 #include <memory>
 #include <algorithm>
+#include <vector>
 
 namespace SilKit {
 namespace Util {
@@ -45,6 +46,9 @@ public:
 
     SharedVector(const Span<const T> span, size_t minimumSize = 0, T padValue = T{});
 
+    //! Shares the given vector without copying it. The vector must not be modified afterwards.
+    SharedVector(std::shared_ptr<std::vector<T>> data);
+
     auto AsSpan() const& -> Span<const T>;
 
 private:
@@ -77,6 +81,12 @@ SharedVector<T>::SharedVector(const Span<const T> span, const size_t minimumSize
     _data->resize((std::max)(_data->size(), minimumSize), padValue);
 }
 
+template <typename T>
+SharedVector<T>::SharedVector(std::shared_ptr<std::vector<T>> data)
+    : _data{std::move(data)}
+{
+}
+
 template <typename T>
 auto SharedVector<T>::AsSpan() const& -> Span<const T>
 {